@@ -0,0 +1,76 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_STATISTICS_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_STATISTICS_H
+
+#include <nlohmann/json.hpp>
+#include <atomic>
+#include <cstddef>
+
+/** Counters an allocator updates on every operation. Each counter is a separate relaxed atomic,
+ *  so a reader takes no allocator mutex and gets values that may be a few operations apart from each other
+ */
+class allocation_statistics final
+{
+
+public:
+
+    struct snapshot final
+    {
+        size_t bytes_in_use = 0;
+        size_t peak_bytes_in_use = 0;
+        size_t allocations_count = 0;
+        size_t deallocations_count = 0;
+        size_t failed_allocations_count = 0;
+        size_t free_bytes = 0;
+        size_t largest_free_block = 0;
+        size_t free_blocks_count = 0;
+
+        /** 1 - largest free block / free bytes: 0 when all free space is one block, close to 1 when it is dust */
+        double external_fragmentation() const noexcept;
+
+        nlohmann::json to_json() const;
+    };
+
+private:
+
+    std::atomic<size_t> _bytes_in_use{0};
+    std::atomic<size_t> _peak_bytes_in_use{0};
+    std::atomic<size_t> _allocations_count{0};
+    std::atomic<size_t> _deallocations_count{0};
+    std::atomic<size_t> _failed_allocations_count{0};
+    std::atomic<size_t> _free_bytes{0};
+    std::atomic<size_t> _largest_free_block{0};
+    std::atomic<size_t> _free_blocks_count{0};
+
+public:
+
+    void on_allocate(
+        size_t bytes) noexcept;
+
+    void on_deallocate(
+        size_t bytes) noexcept;
+
+    void on_failure() noexcept;
+
+    /** A block grown or shrunk in place, no allocation or deallocation is counted */
+    void on_resize(
+        size_t old_bytes,
+        size_t new_bytes) noexcept;
+
+    /** Bytes given back at once without separate deallocations, like a rollback of a bump allocator */
+    void on_release(
+        size_t bytes) noexcept;
+
+    void set_free_space(
+        size_t free_bytes,
+        size_t largest_free_block,
+        size_t free_blocks_count) noexcept;
+
+    snapshot get() const noexcept;
+
+};
+
+void to_json(
+    nlohmann::json &j,
+    allocation_statistics::snapshot const &stats);
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_STATISTICS_H
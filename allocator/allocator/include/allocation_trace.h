@@ -0,0 +1,142 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_TRACE_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_TRACE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory_resource>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/** Sequence of allocate and deallocate events stored as a magic header followed by fixed-size records.
+ *  Allocations are numbered in the order they happened and a deallocation names that number instead of an address,
+ *  so the same trace replays against any allocator
+ */
+class allocation_trace final
+{
+
+public:
+
+    enum class event_kind : uint8_t
+    {
+        allocate,
+        deallocate
+    };
+
+    struct event
+    {
+        event_kind kind;
+        uint8_t alignment_power;
+        uint16_t thread;
+        uint32_t reserved;
+        uint64_t id;
+        uint64_t size;
+    };
+
+    static_assert(sizeof(event) == 24, "events are written to the stream as they lie in memory");
+
+    static_assert(std::endian::native == std::endian::little, "trace files are little endian");
+
+    static constexpr const char magic[8] = { 'm', 'p', 'o', 's', 't', 'r', 'c', '1' };
+
+public:
+
+    std::vector<event> events;
+
+public:
+
+    /** Writes the header and all events */
+    void write(
+        std::ostream &stream) const;
+
+    /** Throws std::runtime_error when the stream holds no trace or ends in the middle of an event */
+    static allocation_trace read(
+        std::istream &stream);
+
+    /** Events are appended to a stream that already has the header */
+    static void write_events(
+        std::ostream &stream,
+        event const *events,
+        size_t count);
+
+    static void write_header(
+        std::ostream &stream);
+
+};
+
+/** Passes every request to the upstream resource and appends it to a trace stream.
+ *  Events are buffered and written in batches under one mutex, threads get small numbers in order of their first request.
+ *  Deallocations of blocks allocated before recording started are passed through but not recorded
+ */
+class allocation_trace_recorder final:
+    public std::pmr::memory_resource
+{
+
+private:
+
+    static constexpr const size_t buffer_capacity = 4096;
+
+    std::pmr::memory_resource *_upstream;
+
+    std::ostream &_stream;
+
+    std::mutex _mutex;
+
+    std::vector<allocation_trace::event> _buffer;
+
+    std::unordered_map<void *, uint64_t> _live;
+
+    std::unordered_map<std::thread::id, uint16_t> _threads;
+
+    uint64_t _next_id = 0;
+
+public:
+
+    /** Writes the trace header right away, a null upstream means the default resource */
+    explicit allocation_trace_recorder(
+        std::ostream &stream,
+        std::pmr::memory_resource *upstream = nullptr);
+
+    allocation_trace_recorder(
+        allocation_trace_recorder const &other) = delete;
+
+    allocation_trace_recorder &operator=(
+        allocation_trace_recorder const &other) = delete;
+
+    ~allocation_trace_recorder() noexcept override;
+
+public:
+
+    void flush();
+
+private:
+
+    void *do_allocate(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate(
+        void *at,
+        size_t size,
+        size_t alignment) override;
+
+    bool do_is_equal(
+        std::pmr::memory_resource const &other) const noexcept override;
+
+    /** mutex must be held */
+    void record(
+        allocation_trace::event_kind kind,
+        uint64_t id,
+        size_t size,
+        size_t alignment);
+
+    /** mutex must be held */
+    void flush_unlocked();
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATION_TRACE_H
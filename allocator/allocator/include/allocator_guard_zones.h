@@ -0,0 +1,128 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GUARD_ZONES_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GUARD_ZONES_H
+
+#include "allocator_dbg_helper.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/** Hardening of every smart_mem_resource, opted in with the MP_OS_ALLOCATOR_HARDENING CMake option.
+ *  CMake defines MP_OS_ALLOCATOR_HARDENED for all targets of non-release configurations then
+ */
+
+/** Layout of a guarded block inside the block an allocator hands out:
+ *  | front red zone | header | user bytes | back red zone |
+ *  The header right before the user bytes holds a canary that tells live, freed and foreign blocks apart.
+ *  User bytes come filled with fresh_fill and are overwritten with freed_fill when retired, so a write
+ *  after free shows up when the block leaves the quarantine. Every violation throws std::logic_error
+ *  with a dump of the damaged bytes, the block stays where it is then
+ */
+class allocator_guard_zones final:
+    private allocator_dbg_helper
+{
+
+public:
+
+    static constexpr const size_t red_zone_size = 16;
+
+    static constexpr const unsigned char red_zone_fill = 0xFB;
+
+    static constexpr const unsigned char fresh_fill = 0xCD;
+
+    static constexpr const unsigned char freed_fill = 0xDD;
+
+    /** Freed blocks go back to the allocator once the quarantine holds more of them than this */
+    static constexpr const size_t quarantine_blocks_limit = 64;
+
+    static constexpr const size_t quarantine_bytes_limit = size_t(1) << 16;
+
+    /** Freed blocks held back from reuse, oldest first */
+    class quarantine final
+    {
+
+    private:
+
+        std::mutex _mutex;
+
+        std::deque<std::pair<void *, size_t>> _blocks;
+
+        size_t _bytes = 0;
+
+    public:
+
+        /** Queues a retired block with its alignment, moves the blocks over the limits into evicted */
+        void push(
+            void *user,
+            size_t alignment,
+            std::vector<std::pair<void *, size_t>> &evicted);
+
+        std::vector<std::pair<void *, size_t>> drain();
+
+    };
+
+private:
+
+    struct block_header
+    {
+        size_t size;
+        size_t front;
+        uintptr_t canary;
+    };
+
+    static constexpr const uintptr_t live_magic = 0x5AFE'B10C'A11C'ED00;
+
+    static constexpr const uintptr_t freed_magic = 0xDEAD'B10C'F4EE'D000;
+
+public:
+
+    /** Bytes to request from the allocator for a guarded block of size bytes */
+    static size_t total_size(
+        size_t size,
+        size_t alignment);
+
+    /** Lays the zones out in a raw block of total_size(size, alignment) bytes, returns the user pointer */
+    static void *arm(
+        void *raw,
+        size_t size,
+        size_t alignment) noexcept;
+
+    /** Checks the canary and both red zones, then poisons the user bytes and marks the block freed */
+    static void retire(
+        void *user);
+
+    /** Checks that a retired block has not been written to since, before it goes back to the allocator */
+    static void check_retired(
+        void *user);
+
+    static void *raw(
+        void *user) noexcept;
+
+    static size_t size(
+        void *user) noexcept;
+
+private:
+
+    static size_t front_size(
+        size_t alignment) noexcept;
+
+    static block_header &header(
+        void *user) noexcept;
+
+    /** Offset of the first byte differing from fill, size when there is none */
+    static size_t find_damage(
+        unsigned char const *zone,
+        size_t size,
+        unsigned char fill) noexcept;
+
+    [[noreturn]] static void report(
+        void *user,
+        std::string const &what,
+        unsigned char *zone,
+        size_t zone_size);
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GUARD_ZONES_H
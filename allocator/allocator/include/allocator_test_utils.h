@@ -1,6 +1,7 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_TEST_UTILS_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_TEST_UTILS_H
 
+#include <allocation_statistics.h>
 #include <cstddef>
 #include <vector>
 #include <string>
@@ -25,6 +26,23 @@ public:
         
     };
 
+    /** Receives the blocks of one pass over an allocator in address order. A pass cut short by a concurrent
+     *  change is started over, reset() comes before the first block of every pass
+     */
+    class block_visitor
+    {
+
+    public:
+
+        virtual ~block_visitor() noexcept = default;
+
+        virtual void reset() = 0;
+
+        virtual void visit(
+            block_info const &block) = 0;
+
+    };
+
 public:
     
     virtual ~allocator_test_utils() noexcept = default;
@@ -33,8 +51,35 @@ public:
     //synchronized interface, delegates to _inner version
     virtual std::vector<block_info> get_blocks_info() const = 0;
 
+    //kept up to date by every operation, readable without the allocator mutex
+    virtual allocation_statistics::snapshot get_statistics() const noexcept = 0;
+
+    nlohmann::json get_statistics_json() const;
+
+    //streams blocks without building a vector, the default one walks get_blocks_info()
+    virtual void visit_blocks(
+        block_visitor &visitor) const;
+
 protected:
 
+    /** Optimistic passes over the blocks before a reader gives up and takes the allocator mutex */
+    static constexpr const size_t optimistic_passes = 8;
+
+    class blocks_collector final:
+        public block_visitor
+    {
+
+    public:
+
+        std::vector<block_info> blocks;
+
+        void reset() override;
+
+        void visit(
+            block_info const &block) override;
+
+    };
+
     //without synchronization, real implementation
     virtual std::vector<block_info> get_blocks_info_inner() const = 0;
 
@@ -13,7 +13,10 @@ public:
     {
         first_fit,
         the_best_fit,
-        the_worst_fit
+        the_worst_fit,
+        /** Free blocks binned by power-of-two size class, lookup is a bit scan.
+         *  Allocators without size classes serve it as their closest fit */
+        segregated_fit
     };
 
 public:
@@ -0,0 +1,72 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ARENA_CHAIN_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ARENA_CHAIN_H
+
+#include <pp_allocator.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/** Extra arenas an allocator in growth mode takes from its parent allocator once its own space runs out.
+ *  Every arena is an allocator of the same kind, the owner keeps the chain in its metadata and calls it
+ *  under its own mutex. An arena left without occupied blocks goes back to the parent allocator,
+ *  unless it is the one the last allocation was served from
+ */
+class arena_chain final
+{
+
+public:
+
+    struct arena
+    {
+        std::unique_ptr<smart_mem_resource> resource;
+        void const *begin;
+        void const *end;
+        size_t occupied_blocks = 0;
+    };
+
+private:
+
+    /** _current value while the owner own space serves allocations */
+    static constexpr const size_t owner = static_cast<size_t>(-1);
+
+    std::vector<arena> _arenas;
+
+    size_t _current = owner;
+
+public:
+
+    /** Tries the most recently used arena first, then the owner space and the rest of the arenas from the newest one.
+     *  owner_allocate returns nullptr when the owner space has no fit, grow builds a new empty arena.
+     *  nullptr when even a new arena cannot serve the request
+     */
+    void *allocate(
+        size_t size,
+        size_t alignment,
+        std::function<void *()> const &owner_allocate,
+        std::function<arena()> const &grow);
+
+    /** false when the pointer lies in none of the arenas. Arenas tell aligned blocks by their own headers */
+    bool deallocate(
+        void *at);
+
+    /** Arena holding the pointer, nullptr when none does */
+    smart_mem_resource *find(
+        void const *at) const noexcept;
+
+    void for_each(
+        std::function<void(smart_mem_resource &)> const &visitor) const;
+
+private:
+
+    void *allocate_in(
+        size_t index,
+        size_t size,
+        size_t alignment) noexcept;
+
+    void switch_to(
+        size_t index) noexcept;
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ARENA_CHAIN_H
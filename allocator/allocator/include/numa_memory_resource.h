@@ -0,0 +1,172 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_NUMA_MEMORY_RESOURCE_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_NUMA_MEMORY_RESOURCE_H
+
+#include <allocation_statistics.h>
+#include <sharded_memory_resource.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/** An allocator of any kind per NUMA node, each thread allocates from the one of the node it runs on.
+ *  Node allocators take their space as whole pages placed on their node with mbind, a block freed on another node
+ *  goes back to its owner by address like in sharded_memory_resource. Pages prefer their node and fall back
+ *  to other nodes once it runs out of memory, strict binding makes them fail instead. On a single node,
+ *  outside Linux, or where the kernel refuses the policy, the space is still served, just without a placement guarantee
+ */
+class numa_memory_resource final:
+    public smart_mem_resource
+{
+
+public:
+
+    struct node_usage final
+    {
+        size_t node;
+
+        /** Whether every page taken for the node so far got the node policy */
+        bool bound;
+
+        size_t reserved_bytes;
+
+        /** Zeroes for allocators that keep no statistics */
+        allocation_statistics::snapshot statistics;
+    };
+
+private:
+
+    /** Parent allocator of a single node allocator, maps pages and sets the node policy on them */
+    class node_upstream final:
+        public std::pmr::memory_resource
+    {
+
+    private:
+
+        size_t _node;
+
+        bool _strict;
+
+        size_t _page_size;
+
+        std::atomic<bool> _bound = true;
+
+    public:
+
+        node_upstream(
+            size_t node,
+            bool strict);
+
+        bool bound() const noexcept;
+
+    private:
+
+        void *do_allocate(
+            size_t bytes,
+            size_t alignment) override;
+
+        void do_deallocate(
+            void *at,
+            size_t bytes,
+            size_t alignment) override;
+
+        bool do_is_equal(
+            std::pmr::memory_resource const &other) const noexcept override;
+
+    };
+
+    /** Empty on a single node, the node allocator takes its space from the parent allocator then */
+    std::vector<std::unique_ptr<node_upstream>> _upstreams;
+
+    sharded_memory_resource _nodes;
+
+public:
+
+    /** nodes_count 0 takes the nodes the system has online. parent_allocator serves the single node case,
+     *  nullptr stands for the default memory resource. strict_binding keeps pages on their node even when
+     *  it runs out of memory, so allocations fail rather than spill to another node
+     */
+    explicit numa_memory_resource(
+        sharded_memory_resource::shard_factory const &make_node_allocator,
+        size_t nodes_count = 0,
+        std::pmr::memory_resource *parent_allocator = nullptr,
+        bool strict_binding = false);
+
+    numa_memory_resource(
+        numa_memory_resource const &other) = delete;
+
+    numa_memory_resource &operator=(
+        numa_memory_resource const &other) = delete;
+
+    numa_memory_resource(
+        numa_memory_resource &&other) = delete;
+
+    numa_memory_resource &operator=(
+        numa_memory_resource &&other) = delete;
+
+    ~numa_memory_resource() noexcept override = default;
+
+public:
+
+    size_t nodes_count() const noexcept;
+
+    std::vector<node_usage> get_node_usage() const;
+
+    /** Node of the pointer, nodes_count() when it belongs to none */
+    size_t node_of(
+        void const *at) const;
+
+    /** Highest online node plus one, 1 when the system tells nothing */
+    static size_t system_nodes_count() noexcept;
+
+    /** Node the calling thread runs on right now, 0 when the system tells nothing */
+    static size_t current_node() noexcept;
+
+private:
+
+    void *do_allocate_sm(
+        size_t size) override;
+
+    void do_deallocate_sm(
+        void *at) override;
+
+    void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    bool do_try_expand_sm(
+        void *at,
+        size_t new_size) override;
+
+    bool do_shrink_sm(
+        void *at,
+        size_t new_size) override;
+
+    void do_allocate_batch_sm(
+        size_t size,
+        size_t count,
+        void **out) override;
+
+    void do_deallocate_batch_sm(
+        void *const *at,
+        size_t count) override;
+
+    bool do_is_equal(
+        std::pmr::memory_resource const &other) const noexcept override;
+
+private:
+
+    static std::vector<std::unique_ptr<node_upstream>> make_upstreams(
+        size_t nodes_count,
+        bool strict_binding);
+
+    static std::vector<std::pmr::memory_resource *> parents_of(
+        std::vector<std::unique_ptr<node_upstream>> const &upstreams,
+        std::pmr::memory_resource *parent_allocator);
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_NUMA_MEMORY_RESOURCE_H
@@ -7,9 +7,52 @@
 
 #include <memory_resource>
 #include <memory>
+#include <cstddef>
+#include <limits>
+#include <allocator_guard_zones.h>
 
 struct smart_mem_resource : public std::pmr::memory_resource
 {
+public:
+
+    /** Grows the block at at to new_size bytes without moving it. false leaves the block as it was,
+     *  the caller allocates a new one and copies then
+     */
+    bool try_expand(void* at, size_t new_size);
+
+    /** Gives the part of the block beyond new_size back to the allocator without moving the block.
+     *  false when nothing could be given back, the block stays usable either way
+     */
+    bool shrink(void* at, size_t new_size);
+
+    /** Fills out with count blocks of size bytes each, taken under one lock where the allocator can.
+     *  All or nothing: on failure the blocks already taken are given back and the exception propagates.
+     *  Every block is freed on its own later, through deallocate or deallocate_batch
+     */
+    void allocate_batch(size_t size, size_t count, void** out, size_t alignment = default_alignment);
+
+    void deallocate_batch(void* const* at, size_t count, size_t alignment = default_alignment);
+
+    /** Gives the blocks held back by the hardening quarantine to the allocator, does nothing in plain builds */
+    void flush_quarantine();
+
+    /** Bytes a hardened build adds to every block of the given alignment, 0 in plain builds */
+    static size_t guard_overhead(size_t alignment = default_alignment) noexcept;
+
+protected:
+
+    /** Alignments up to this one are served by the plain do_allocate_sm/do_deallocate_sm pair,
+     *  stricter (extended) alignments go through do_allocate_aligned_sm/do_deallocate_aligned_sm
+     */
+    static constexpr const size_t default_alignment = alignof(std::max_align_t);
+
+    static constexpr size_t align_up(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static void* align_up(void* ptr, size_t alignment) noexcept;
+
 private:
     virtual void do_deallocate_sm(void*) =0;
 
@@ -18,6 +61,35 @@ private:
     virtual void* do_allocate_sm(size_t) =0;
 
     void * do_allocate(size_t _Bytes, size_t _Align) final;
+
+    /** Default implementation over-allocates through do_allocate_sm and keeps the original pointer
+     *  right before the aligned block. Allocators that know their block layout should override both
+     *  functions and place the block on the requested boundary directly
+     */
+    virtual void* do_allocate_aligned_sm(size_t size, size_t alignment);
+
+    virtual void do_deallocate_aligned_sm(void* at, size_t alignment);
+
+    /** Default implementations can resize nothing in place */
+    virtual bool do_try_expand_sm(void* at, size_t new_size);
+
+    virtual bool do_shrink_sm(void* at, size_t new_size);
+
+    /** Default implementations go through do_allocate_sm/do_deallocate_sm block by block */
+    virtual void do_allocate_batch_sm(size_t size, size_t count, void** out);
+
+    virtual void do_deallocate_batch_sm(void* const* at, size_t count);
+
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    /** Every block is guarded, resizing in place and batches go block by block through these two */
+    void* allocate_guarded(size_t size, size_t alignment);
+
+    void deallocate_guarded(void* at, size_t alignment);
+
+    void release_guarded(std::vector<std::pair<void*, size_t>> const& blocks);
+
+    allocator_guard_zones::quarantine _quarantine;
+#endif
 };
 
 
@@ -57,6 +129,11 @@ public:
     [[nodiscard]] T* allocate(size_t n);
     void deallocate(T* p, size_t n = 1);
 
+    /** Resizes the array of n objects at p to new_n objects in place, false when the resource cannot do it
+     *  and the array keeps its old size. Containers call it before falling back to allocate, move and deallocate
+     */
+    bool resize_in_place(T* p, size_t n, size_t new_n);
+
     template<class U, class... Args>
     void construct(U* p, Args&&... args);
 
@@ -67,6 +144,13 @@ public:
 
     void deallocate_bytes(void* p, size_t bytes = 1, size_t alignment = alignof(std::max_align_t));
 
+    /** count separate blocks of nbytes each in one call, for bulk loads that know how many nodes they need.
+     *  Resources other than smart_mem_resource get the blocks one by one
+     */
+    void allocate_bytes_batch(void** out, size_t count, size_t nbytes, size_t alignment = alignof(std::max_align_t));
+
+    void deallocate_bytes_batch(void* const* p, size_t count, size_t bytes = 1, size_t alignment = alignof(std::max_align_t));
+
     template< class U >
     [[nodiscard]] U* allocate_object( std::size_t n = 1 );
 
@@ -166,6 +250,44 @@ void *pp_allocator<T>::allocate_bytes(size_t nbytes, size_t alignment)
     return resource()->allocate(nbytes, alignment);
 }
 
+template<typename T>
+void pp_allocator<T>::allocate_bytes_batch(void **out, size_t count, size_t nbytes, size_t alignment)
+{
+    if (auto* smart = dynamic_cast<smart_mem_resource*>(resource()); smart != nullptr)
+    {
+        smart->allocate_batch(nbytes, count, out, alignment);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        try
+        {
+            out[i] = allocate_bytes(nbytes, alignment);
+        }
+        catch (...)
+        {
+            deallocate_bytes_batch(out, i, nbytes, alignment);
+            throw;
+        }
+    }
+}
+
+template<typename T>
+void pp_allocator<T>::deallocate_bytes_batch(void *const *p, size_t count, size_t bytes, size_t alignment)
+{
+    if (auto* smart = dynamic_cast<smart_mem_resource*>(resource()); smart != nullptr)
+    {
+        smart->deallocate_batch(p, count, alignment);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        deallocate_bytes(p[i], bytes, alignment);
+    }
+}
+
 template<typename T>
 template<class U>
 void pp_allocator<T>::destroy(U *p)
@@ -186,6 +308,21 @@ void pp_allocator<T>::deallocate(T *p, size_t n)
     _mem->deallocate(p, n * sizeof(T), alignof(T));
 }
 
+template<typename T>
+bool pp_allocator<T>::resize_in_place(T *p, size_t n, size_t new_n)
+{
+    auto* smart = dynamic_cast<smart_mem_resource*>(_mem);
+
+    if (smart == nullptr || p == nullptr || (std::numeric_limits<size_t>::max() / sizeof(T)) < new_n)
+    {
+        return false;
+    }
+
+    return new_n >= n
+        ? smart->try_expand(p, new_n * sizeof(T))
+        : smart->shrink(p, new_n * sizeof(T));
+}
+
 template<typename T>
 T *pp_allocator<T>::allocate(size_t n)
 {
@@ -0,0 +1,58 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_SEQUENCED_MUTEX_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_SEQUENCED_MUTEX_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+/** Mutex that counts its lock periods, so a reader can walk the data it guards without taking it (a sequence lock).
+ *  The holder writes every field a reader may walk through store(), the reader remembers read_begin(),
+ *  loads every field through load() and trusts what it has read only
+ *  when read_validate() confirms that nobody held the mutex meanwhile. Whatever it has read may be garbage
+ *  before that, so the walk has to check every pointer it follows against the bounds of the data
+ */
+class sequenced_mutex final
+{
+
+private:
+
+    std::mutex _mutex;
+
+    /** Odd while the mutex is held */
+    std::atomic<uint64_t> _sequence{0};
+
+public:
+
+    void lock();
+
+    bool try_lock();
+
+    void unlock() noexcept;
+
+    /** Sequence value to pass to read_validate, an odd one never validates */
+    uint64_t read_begin() const noexcept;
+
+    bool read_validate(
+        uint64_t seen) const noexcept;
+
+    /** Field of the guarded data read while a holder of the mutex may be writing it */
+    template<typename T>
+    static T load(
+        T const &field) noexcept
+    {
+        return std::atomic_ref<T>(const_cast<T &>(field)).load(std::memory_order_relaxed);
+    }
+
+    /** Field of the guarded data written by the holder of the mutex while a reader may be loading it */
+    template<typename T>
+    static void store(
+        T &field,
+        std::type_identity_t<T> value) noexcept
+    {
+        std::atomic_ref<T>(field).store(value, std::memory_order_relaxed);
+    }
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_SEQUENCED_MUTEX_H
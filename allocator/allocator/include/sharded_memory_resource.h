@@ -0,0 +1,210 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_SHARDED_MEMORY_RESOURCE_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_SHARDED_MEMORY_RESOURCE_H
+
+#include <pp_allocator.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/** Front end spreading threads over several allocators of any kind, so they rarely meet on one mutex.
+ *  A thread allocates from its home shard and falls back to the others when it is full. A block is freed
+ *  through the shard whose space holds its address: every shard takes its space from the parent allocator
+ *  through a recorder that remembers the address ranges it handed out, arenas of growable shards included
+ */
+class sharded_memory_resource final:
+    public smart_mem_resource
+{
+
+public:
+
+    /** Builds a shard taking all its space from the given parent allocator */
+    using shard_factory = std::function<std::unique_ptr<smart_mem_resource>(std::pmr::memory_resource *parent_allocator)>;
+
+    /** Home shard of the calling thread, taken modulo the shards count */
+    using shard_selector = std::function<size_t()>;
+
+private:
+
+    /** Parent allocator of a single shard */
+    class shard_upstream final:
+        public std::pmr::memory_resource
+    {
+
+    private:
+
+        sharded_memory_resource &_owner;
+
+        size_t _shard;
+
+        std::pmr::memory_resource *_parent_allocator;
+
+    public:
+
+        shard_upstream(
+            sharded_memory_resource &owner,
+            size_t shard,
+            std::pmr::memory_resource *parent_allocator) noexcept;
+
+    private:
+
+        void *do_allocate(
+            size_t bytes,
+            size_t alignment) override;
+
+        void do_deallocate(
+            void *at,
+            size_t bytes,
+            size_t alignment) override;
+
+        bool do_is_equal(
+            std::pmr::memory_resource const &other) const noexcept override;
+
+    };
+
+    struct address_range
+    {
+        std::byte const *begin;
+        std::byte const *end;
+        size_t shard;
+    };
+
+    using range_table = std::vector<address_range>;
+
+    /** Sorted by begin. A shard taking or returning space publishes a changed copy under a new version,
+     *  a thread keeps the copy it has looked owners up in until the version changes, so frees take no lock
+     */
+    std::atomic<std::shared_ptr<range_table const>> _ranges{ std::make_shared<range_table const>() };
+
+    /** Unique among all the range tables ever published, the table is published first */
+    std::atomic<uint64_t> _ranges_version{ next_ranges_version() };
+
+    /** Taken by the shards that change the ranges only */
+    std::mutex _ranges_mutex;
+
+    std::vector<std::unique_ptr<shard_upstream>> _upstreams;
+
+    shard_selector _select_home;
+
+    /** Declared last so every shard returns its space while the recorders still exist */
+    std::vector<std::unique_ptr<smart_mem_resource>> _shards;
+
+public:
+
+    /** nullptr parent_allocator stands for the default memory resource */
+    sharded_memory_resource(
+        size_t shards_count,
+        shard_factory const &make_shard,
+        std::pmr::memory_resource *parent_allocator = nullptr);
+
+    /** A shard per parent allocator, each shard takes its space from its own one.
+     *  Without select_home threads are numbered as with the other constructor
+     */
+    sharded_memory_resource(
+        std::vector<std::pmr::memory_resource *> const &parent_allocators,
+        shard_factory const &make_shard,
+        shard_selector select_home = {});
+
+    sharded_memory_resource(
+        sharded_memory_resource const &other) = delete;
+
+    sharded_memory_resource &operator=(
+        sharded_memory_resource const &other) = delete;
+
+    sharded_memory_resource(
+        sharded_memory_resource &&other) = delete;
+
+    sharded_memory_resource &operator=(
+        sharded_memory_resource &&other) = delete;
+
+    ~sharded_memory_resource() noexcept override = default;
+
+public:
+
+    size_t shards_count() const noexcept;
+
+    smart_mem_resource &shard(
+        size_t index) const noexcept;
+
+    /** Shard the calling thread allocates from. Threads get consecutive numbers on their first allocation,
+     *  so as many threads as shards never share one
+     */
+    size_t home_shard() const;
+
+    /** Bytes the shard has taken from its parent allocator so far */
+    size_t reserved_bytes(
+        size_t index) const;
+
+    /** Shard whose space holds the pointer, shards_count() when none does */
+    size_t owner_of(
+        void const *at) const;
+
+private:
+
+    void *do_allocate_sm(
+        size_t size) override;
+
+    void do_deallocate_sm(
+        void *at) override;
+
+    void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    bool do_try_expand_sm(
+        void *at,
+        size_t new_size) override;
+
+    bool do_shrink_sm(
+        void *at,
+        size_t new_size) override;
+
+    void do_allocate_batch_sm(
+        size_t size,
+        size_t count,
+        void **out) override;
+
+    void do_deallocate_batch_sm(
+        void *const *at,
+        size_t count) override;
+
+    bool do_is_equal(
+        std::pmr::memory_resource const &other) const noexcept override;
+
+private:
+
+    /** Tries the home shard first, then the rest of them in order */
+    void *allocate_from_shards(
+        size_t size,
+        size_t alignment);
+
+    smart_mem_resource &owning_shard(
+        void const *at) const;
+
+    static uint64_t next_ranges_version() noexcept;
+
+    /** Range table of the calling thread, valid until its next call */
+    range_table const &current_ranges() const;
+
+    /** Called under _ranges_mutex */
+    void publish_ranges(
+        std::shared_ptr<range_table const> ranges);
+
+    void add_range(
+        void const *begin,
+        size_t size,
+        size_t shard);
+
+    void remove_range(
+        void const *begin);
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_SHARDED_MEMORY_RESOURCE_H
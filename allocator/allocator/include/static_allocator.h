@@ -0,0 +1,609 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_STATIC_ALLOCATOR_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_STATIC_ALLOCATOR_H
+
+#include <allocator_test_utils.h>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/** Fit policies of static_heap. The search keeps a candidate while prefers() says so,
+ *  stops_at_first ends it at the first block that fits
+ */
+struct first_fit_policy
+{
+    static constexpr bool stops_at_first = true;
+
+    static constexpr bool prefers(size_t, size_t) noexcept
+    {
+        return false;
+    }
+};
+
+struct best_fit_policy
+{
+    static constexpr bool stops_at_first = false;
+
+    static constexpr bool prefers(size_t candidate, size_t best) noexcept
+    {
+        return candidate < best;
+    }
+};
+
+struct worst_fit_policy
+{
+    static constexpr bool stops_at_first = false;
+
+    static constexpr bool prefers(size_t candidate, size_t best) noexcept
+    {
+        return candidate > best;
+    }
+};
+
+/** Lock policies of static_heap, for a heap used by one thread only, by a few threads, and for short
+ *  critical sections under heavy contention
+ */
+struct no_lock_policy
+{
+    void lock() noexcept {}
+
+    void unlock() noexcept {}
+};
+
+struct mutex_lock_policy
+{
+    std::mutex mutex;
+
+    void lock()
+    {
+        mutex.lock();
+    }
+
+    void unlock() noexcept
+    {
+        mutex.unlock();
+    }
+};
+
+struct spin_lock_policy
+{
+    std::atomic<bool> locked = false;
+
+    void lock() noexcept
+    {
+        while (locked.exchange(true, std::memory_order_acquire))
+        {
+            while (locked.load(std::memory_order_relaxed))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void unlock() noexcept
+    {
+        locked.store(false, std::memory_order_release);
+    }
+};
+
+/** Address-ordered free list heap like allocator_sorted_list, with the fit strategy and the lock chosen at compile time.
+ *  No virtual call and no fit mode check stands between a container and the fit search, so the search gets inlined.
+ *  Block sizes are rounded up to the fundamental alignment, every block is aligned for any object
+ */
+template<typename fit_policy, typename lock_policy = mutex_lock_policy>
+class static_heap final
+{
+
+private:
+
+    /** next points to the next free block for free blocks and to the heap itself for occupied ones */
+    struct block_metadata
+    {
+        size_t size;
+        void *next;
+    };
+
+    static constexpr const size_t alignment = alignof(std::max_align_t);
+
+    static constexpr const size_t block_metadata_size = (sizeof(block_metadata) + alignment - 1) & ~(alignment - 1);
+
+    std::pmr::memory_resource *_parent_allocator;
+
+    std::byte *_begin;
+
+    std::byte *_end;
+
+    void *_first_free;
+
+    mutable lock_policy _lock;
+
+public:
+
+    /** nullptr parent_allocator stands for the default memory resource */
+    explicit static_heap(
+        size_t space_size,
+        std::pmr::memory_resource *parent_allocator = nullptr);
+
+    static_heap(
+        static_heap const &other) = delete;
+
+    static_heap &operator=(
+        static_heap const &other) = delete;
+
+    static_heap(
+        static_heap &&other) = delete;
+
+    static_heap &operator=(
+        static_heap &&other) = delete;
+
+    ~static_heap() noexcept;
+
+public:
+
+    [[nodiscard]] void *allocate(
+        size_t size);
+
+    void deallocate(
+        void *at);
+
+    /** All or nothing, like smart_mem_resource::allocate_batch, and under one lock */
+    void allocate_batch(
+        size_t size,
+        size_t count,
+        void **out);
+
+    void deallocate_batch(
+        void *const *at,
+        size_t count);
+
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const;
+
+private:
+
+    void *allocate_unlocked(
+        size_t size) noexcept;
+
+    void deallocate_unlocked(
+        void *at);
+
+    static block_metadata *as_block(
+        void *at) noexcept;
+
+};
+
+/** Typed handle to a static_heap with the interface of pp_allocator, usable as the allocator of standard containers.
+ *  Copies and rebound copies share the heap, which has to outlive them
+ */
+template<typename T, typename heap_type>
+class static_allocator
+{
+
+    template<typename U, typename other_heap_type>
+    friend class static_allocator;
+
+private:
+
+    heap_type *_heap;
+
+public:
+
+    using value_type = T;
+
+    using propagate_on_container_swap = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = static_allocator<U, heap_type>;
+    };
+
+public:
+
+    explicit static_allocator(
+        heap_type &heap) noexcept;
+
+    template<typename U>
+    static_allocator(
+        static_allocator<U, heap_type> const &other) noexcept;
+
+public:
+
+    [[nodiscard]] T *allocate(
+        size_t n);
+
+    void deallocate(
+        T *p,
+        size_t n = 1);
+
+    [[nodiscard]] void *allocate_bytes(
+        size_t nbytes,
+        size_t alignment = alignof(std::max_align_t));
+
+    void deallocate_bytes(
+        void *p,
+        size_t bytes = 1,
+        size_t alignment = alignof(std::max_align_t));
+
+    void allocate_bytes_batch(
+        void **out,
+        size_t count,
+        size_t nbytes,
+        size_t alignment = alignof(std::max_align_t));
+
+    void deallocate_bytes_batch(
+        void *const *p,
+        size_t count,
+        size_t bytes = 1,
+        size_t alignment = alignof(std::max_align_t));
+
+    template<class U, class... Args>
+    void construct(
+        U *p,
+        Args &&... args);
+
+    template<class U>
+    void destroy(
+        U *p);
+
+    template<class U, class... CtorArgs>
+    [[nodiscard]] U *new_object(
+        CtorArgs &&... ctor_args);
+
+    template<class U>
+    void delete_object(
+        U *p);
+
+    heap_type &heap() const noexcept;
+
+};
+
+template<typename T, typename U, typename heap_type>
+bool operator==(
+    static_allocator<T, heap_type> const &lhs,
+    static_allocator<U, heap_type> const &rhs) noexcept
+{
+    return &lhs.heap() == &rhs.heap();
+}
+
+template<typename fit_policy, typename lock_policy>
+static_heap<fit_policy, lock_policy>::static_heap(
+    size_t space_size,
+    std::pmr::memory_resource *parent_allocator)
+    : _parent_allocator(parent_allocator == nullptr ? std::pmr::get_default_resource() : parent_allocator)
+{
+    space_size = (space_size + alignment - 1) & ~(alignment - 1);
+
+    if (space_size < block_metadata_size)
+    {
+        throw std::logic_error("static_heap: space size is too small to hold a single block");
+    }
+
+    _begin = static_cast<std::byte *>(_parent_allocator->allocate(space_size, alignment));
+    _end = _begin + space_size;
+
+    _first_free = new (_begin) block_metadata{ .size = space_size - block_metadata_size, .next = nullptr };
+}
+
+template<typename fit_policy, typename lock_policy>
+static_heap<fit_policy, lock_policy>::~static_heap() noexcept
+{
+    _parent_allocator->deallocate(_begin, _end - _begin, alignment);
+}
+
+template<typename fit_policy, typename lock_policy>
+void *static_heap<fit_policy, lock_policy>::allocate(
+    size_t size)
+{
+    void *result;
+
+    {
+        std::lock_guard lock(_lock);
+        result = allocate_unlocked(size);
+    }
+
+    if (result == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return result;
+}
+
+template<typename fit_policy, typename lock_policy>
+void static_heap<fit_policy, lock_policy>::deallocate(
+    void *at)
+{
+    std::lock_guard lock(_lock);
+    deallocate_unlocked(at);
+}
+
+template<typename fit_policy, typename lock_policy>
+void static_heap<fit_policy, lock_policy>::allocate_batch(
+    size_t size,
+    size_t count,
+    void **out)
+{
+    std::lock_guard lock(_lock);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if ((out[i] = allocate_unlocked(size)) == nullptr)
+        {
+            while (i-- > 0)
+            {
+                deallocate_unlocked(out[i]);
+            }
+            throw std::bad_alloc();
+        }
+    }
+}
+
+template<typename fit_policy, typename lock_policy>
+void static_heap<fit_policy, lock_policy>::deallocate_batch(
+    void *const *at,
+    size_t count)
+{
+    std::lock_guard lock(_lock);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        deallocate_unlocked(at[i]);
+    }
+}
+
+template<typename fit_policy, typename lock_policy>
+std::vector<allocator_test_utils::block_info> static_heap<fit_policy, lock_policy>::get_blocks_info() const
+{
+    std::lock_guard lock(_lock);
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (auto *cursor = _begin; cursor != _end; )
+    {
+        auto *block = reinterpret_cast<block_metadata *>(cursor);
+        res.push_back({ .block_size = block_metadata_size + block->size, .is_block_occupied = block->next == this });
+        cursor += block_metadata_size + block->size;
+    }
+
+    return res;
+}
+
+template<typename fit_policy, typename lock_policy>
+void *static_heap<fit_policy, lock_policy>::allocate_unlocked(
+    size_t size) noexcept
+{
+    if (size > static_cast<size_t>(_end - _begin))
+    {
+        return nullptr;
+    }
+
+    size = size == 0 ? alignment : (size + alignment - 1) & ~(alignment - 1);
+
+    block_metadata *prev = nullptr;
+    block_metadata *found = nullptr;
+    block_metadata *found_prev = nullptr;
+
+    for (auto *block = static_cast<block_metadata *>(_first_free); block != nullptr; prev = block, block = static_cast<block_metadata *>(block->next))
+    {
+        if (block->size < size)
+        {
+            continue;
+        }
+
+        if (found == nullptr || fit_policy::prefers(block->size, found->size))
+        {
+            found = block;
+            found_prev = prev;
+
+            if constexpr (fit_policy::stops_at_first)
+            {
+                break;
+            }
+        }
+    }
+
+    if (found == nullptr)
+    {
+        return nullptr;
+    }
+
+    void *next_free = found->next;
+
+    // a rest too small for a header goes to the block as well
+    if (found->size - size >= block_metadata_size)
+    {
+        auto *rest = reinterpret_cast<block_metadata *>(reinterpret_cast<std::byte *>(found) + block_metadata_size + size);
+        *rest = { .size = found->size - size - block_metadata_size, .next = next_free };
+        next_free = rest;
+        found->size = size;
+    }
+
+    (found_prev == nullptr ? _first_free : found_prev->next) = next_free;
+    found->next = this;
+
+    return reinterpret_cast<std::byte *>(found) + block_metadata_size;
+}
+
+template<typename fit_policy, typename lock_policy>
+void static_heap<fit_policy, lock_policy>::deallocate_unlocked(
+    void *at)
+{
+    auto *block = as_block(at);
+
+    if (reinterpret_cast<std::byte *>(block) < _begin || reinterpret_cast<std::byte *>(at) >= _end || block->next != this)
+    {
+        throw std::logic_error("static_heap: block does not belong to the heap");
+    }
+
+    block_metadata *prev = nullptr;
+    auto *next = static_cast<block_metadata *>(_first_free);
+
+    while (next != nullptr && next < block)
+    {
+        prev = next;
+        next = static_cast<block_metadata *>(next->next);
+    }
+
+    block->next = next;
+    (prev == nullptr ? _first_free : prev->next) = block;
+
+    if (next != nullptr && reinterpret_cast<std::byte *>(block) + block_metadata_size + block->size == reinterpret_cast<std::byte *>(next))
+    {
+        block->size += block_metadata_size + next->size;
+        block->next = next->next;
+    }
+
+    if (prev != nullptr && reinterpret_cast<std::byte *>(prev) + block_metadata_size + prev->size == reinterpret_cast<std::byte *>(block))
+    {
+        prev->size += block_metadata_size + block->size;
+        prev->next = block->next;
+    }
+}
+
+template<typename fit_policy, typename lock_policy>
+typename static_heap<fit_policy, lock_policy>::block_metadata *static_heap<fit_policy, lock_policy>::as_block(
+    void *at) noexcept
+{
+    return reinterpret_cast<block_metadata *>(static_cast<std::byte *>(at) - block_metadata_size);
+}
+
+template<typename T, typename heap_type>
+static_allocator<T, heap_type>::static_allocator(
+    heap_type &heap) noexcept
+    : _heap(&heap) {}
+
+template<typename T, typename heap_type>
+template<typename U>
+static_allocator<T, heap_type>::static_allocator(
+    static_allocator<U, heap_type> const &other) noexcept
+    : _heap(other._heap) {}
+
+template<typename T, typename heap_type>
+T *static_allocator<T, heap_type>::allocate(
+    size_t n)
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "static_allocator: over-aligned types are not supported");
+
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+    {
+        throw std::bad_array_new_length();
+    }
+
+    return static_cast<T *>(_heap->allocate(n * sizeof(T)));
+}
+
+template<typename T, typename heap_type>
+void static_allocator<T, heap_type>::deallocate(
+    T *p,
+    size_t)
+{
+    _heap->deallocate(p);
+}
+
+template<typename T, typename heap_type>
+void *static_allocator<T, heap_type>::allocate_bytes(
+    size_t nbytes,
+    size_t alignment)
+{
+    if (alignment > alignof(std::max_align_t))
+    {
+        throw std::bad_alloc();
+    }
+
+    return _heap->allocate(nbytes);
+}
+
+template<typename T, typename heap_type>
+void static_allocator<T, heap_type>::deallocate_bytes(
+    void *p,
+    size_t,
+    size_t)
+{
+    _heap->deallocate(p);
+}
+
+template<typename T, typename heap_type>
+void static_allocator<T, heap_type>::allocate_bytes_batch(
+    void **out,
+    size_t count,
+    size_t nbytes,
+    size_t alignment)
+{
+    if (alignment > alignof(std::max_align_t))
+    {
+        throw std::bad_alloc();
+    }
+
+    _heap->allocate_batch(nbytes, count, out);
+}
+
+template<typename T, typename heap_type>
+void static_allocator<T, heap_type>::deallocate_bytes_batch(
+    void *const *p,
+    size_t count,
+    size_t,
+    size_t)
+{
+    _heap->deallocate_batch(p, count);
+}
+
+template<typename T, typename heap_type>
+template<class U, class... Args>
+void static_allocator<T, heap_type>::construct(
+    U *p,
+    Args &&... args)
+{
+    std::construct_at(p, std::forward<Args>(args)...);
+}
+
+template<typename T, typename heap_type>
+template<class U>
+void static_allocator<T, heap_type>::destroy(
+    U *p)
+{
+    std::destroy_at(p);
+}
+
+template<typename T, typename heap_type>
+template<class U, class... CtorArgs>
+U *static_allocator<T, heap_type>::new_object(
+    CtorArgs &&... ctor_args)
+{
+    U *p = static_allocator<U, heap_type>(*this).allocate(1);
+
+    try
+    {
+        construct(p, std::forward<CtorArgs>(ctor_args)...);
+    }
+    catch (...)
+    {
+        _heap->deallocate(p);
+        throw;
+    }
+
+    return p;
+}
+
+template<typename T, typename heap_type>
+template<class U>
+void static_allocator<T, heap_type>::delete_object(
+    U *p)
+{
+    destroy(p);
+    _heap->deallocate(p);
+}
+
+template<typename T, typename heap_type>
+heap_type &static_allocator<T, heap_type>::heap() const noexcept
+{
+    return *_heap;
+}
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_STATIC_ALLOCATOR_H
@@ -0,0 +1,119 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_THREAD_LOCAL_CACHE_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_THREAD_LOCAL_CACHE_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/** Per-thread stock of small blocks kept in front of an allocator's shared free list.
+ *  Blocks in a stock are still occupied from the allocator's point of view, the allocator hands them
+ *  out and takes them back without its own mutex and moves them to and from the shared list in batches.
+ *  Blocks of finished threads are parked until the allocator collects them.
+ */
+class thread_local_cache final
+{
+
+public:
+
+    static constexpr const size_t size_class_step = 16;
+
+    static constexpr const size_t size_classes_count = 16;
+
+    /** Blocks moved between the shared list and a thread stock at once */
+    static constexpr const size_t batch_size = 8;
+
+    static constexpr const size_t bin_capacity = 4 * batch_size;
+
+private:
+
+    struct bin
+    {
+        std::array<void *, bin_capacity> blocks;
+        size_t count = 0;
+    };
+
+    struct thread_stock
+    {
+        mutable std::mutex mutex;
+        std::array<bin, size_classes_count> bins;
+    };
+
+    /** Outlives the cache while some thread still references it, so a finishing thread never touches a dead allocator */
+    struct registry
+    {
+        mutable std::mutex mutex;
+        bool alive = true;
+        std::vector<std::shared_ptr<thread_stock>> stocks;
+        std::vector<void *> parked;
+    };
+
+    struct thread_stocks;
+
+    std::shared_ptr<registry> _registry;
+
+public:
+
+    thread_local_cache();
+
+    thread_local_cache(
+        thread_local_cache const &other) = delete;
+
+    thread_local_cache &operator=(
+        thread_local_cache const &other) = delete;
+
+    thread_local_cache(
+        thread_local_cache &&other) = delete;
+
+    thread_local_cache &operator=(
+        thread_local_cache &&other) = delete;
+
+    ~thread_local_cache() noexcept;
+
+public:
+
+    /** size_classes_count for sizes that are not cached */
+    static size_t size_class(
+        size_t size) noexcept;
+
+    static size_t class_size(
+        size_t size_class) noexcept;
+
+    /** Block of the class from the calling thread stock, nullptr when the stock has none */
+    void *pop(
+        size_t size_class);
+
+    /** Stores refilled blocks into the calling thread stock, the caller guarantees they fit */
+    void fill(
+        size_t size_class,
+        void *const *blocks,
+        size_t count);
+
+    /** Stores a block into the calling thread stock. On overflow the oldest batch_size blocks of the class are
+     *  written into overflow and their count is returned, the caller gives them back to the shared list
+     */
+    size_t push(
+        size_t size_class,
+        void *block,
+        void **overflow);
+
+    /** Moves parked blocks of finished threads into out, with all_threads blocks of live threads as well */
+    void collect(
+        std::vector<void *> &out,
+        bool all_threads);
+
+    /** Calls visitor with sorted pointers of every cached block while no thread can take or return one.
+     *  Like collect, must be called under the allocator mutex, which always comes first in the lock order
+     */
+    void visit(
+        std::function<void(std::vector<void *> const &)> const &visitor) const;
+
+private:
+
+    thread_stock &local_stock();
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_THREAD_LOCAL_CACHE_H
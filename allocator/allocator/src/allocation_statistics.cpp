@@ -0,0 +1,103 @@
+#include "../include/allocation_statistics.h"
+
+double allocation_statistics::snapshot::external_fragmentation() const noexcept
+{
+    if (free_bytes == 0)
+    {
+        return 0.0;
+    }
+
+    return 1.0 - static_cast<double>(largest_free_block) / static_cast<double>(free_bytes);
+}
+
+nlohmann::json allocation_statistics::snapshot::to_json() const
+{
+    return nlohmann::json{
+        {"bytes_in_use", bytes_in_use},
+        {"peak_bytes_in_use", peak_bytes_in_use},
+        {"allocations_count", allocations_count},
+        {"deallocations_count", deallocations_count},
+        {"failed_allocations_count", failed_allocations_count},
+        {"free_bytes", free_bytes},
+        {"largest_free_block", largest_free_block},
+        {"free_blocks_count", free_blocks_count},
+        {"external_fragmentation", external_fragmentation()}};
+}
+
+void allocation_statistics::on_allocate(
+    size_t bytes) noexcept
+{
+    size_t in_use = _bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t peak = _peak_bytes_in_use.load(std::memory_order_relaxed);
+
+    while (peak < in_use && !_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed));
+
+    _allocations_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void allocation_statistics::on_deallocate(
+    size_t bytes) noexcept
+{
+    _bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+    _deallocations_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void allocation_statistics::on_resize(
+    size_t old_bytes,
+    size_t new_bytes) noexcept
+{
+    if (new_bytes < old_bytes)
+    {
+        _bytes_in_use.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+        return;
+    }
+
+    size_t in_use = _bytes_in_use.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed) + new_bytes - old_bytes;
+    size_t peak = _peak_bytes_in_use.load(std::memory_order_relaxed);
+
+    while (peak < in_use && !_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed));
+}
+
+void allocation_statistics::on_failure() noexcept
+{
+    _failed_allocations_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void allocation_statistics::on_release(
+    size_t bytes) noexcept
+{
+    _bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void allocation_statistics::set_free_space(
+    size_t free_bytes,
+    size_t largest_free_block,
+    size_t free_blocks_count) noexcept
+{
+    _free_bytes.store(free_bytes, std::memory_order_relaxed);
+    _largest_free_block.store(largest_free_block, std::memory_order_relaxed);
+    _free_blocks_count.store(free_blocks_count, std::memory_order_relaxed);
+}
+
+allocation_statistics::snapshot allocation_statistics::get() const noexcept
+{
+    snapshot result;
+
+    result.bytes_in_use = _bytes_in_use.load(std::memory_order_relaxed);
+    result.peak_bytes_in_use = _peak_bytes_in_use.load(std::memory_order_relaxed);
+    result.allocations_count = _allocations_count.load(std::memory_order_relaxed);
+    result.deallocations_count = _deallocations_count.load(std::memory_order_relaxed);
+    result.failed_allocations_count = _failed_allocations_count.load(std::memory_order_relaxed);
+    result.free_bytes = _free_bytes.load(std::memory_order_relaxed);
+    result.largest_free_block = _largest_free_block.load(std::memory_order_relaxed);
+    result.free_blocks_count = _free_blocks_count.load(std::memory_order_relaxed);
+
+    return result;
+}
+
+void to_json(
+    nlohmann::json &j,
+    allocation_statistics::snapshot const &stats)
+{
+    j = stats.to_json();
+}
@@ -0,0 +1,145 @@
+#include "../include/allocation_trace.h"
+#include <algorithm>
+#include <stdexcept>
+
+void allocation_trace::write(
+    std::ostream &stream) const
+{
+    write_header(stream);
+    write_events(stream, events.data(), events.size());
+}
+
+allocation_trace allocation_trace::read(
+    std::istream &stream)
+{
+    char header[sizeof(magic)];
+
+    if (!stream.read(header, sizeof(header)) || !std::equal(std::begin(header), std::end(header), std::begin(magic)))
+    {
+        throw std::runtime_error("allocation_trace: stream does not start with a trace header");
+    }
+
+    allocation_trace res;
+    event current;
+
+    while (stream.read(reinterpret_cast<char *>(&current), sizeof(current)))
+    {
+        res.events.push_back(current);
+    }
+
+    if (stream.gcount() != 0)
+    {
+        throw std::runtime_error("allocation_trace: trace ends in the middle of an event");
+    }
+
+    return res;
+}
+
+void allocation_trace::write_events(
+    std::ostream &stream,
+    event const *events,
+    size_t count)
+{
+    stream.write(reinterpret_cast<char const *>(events), static_cast<std::streamsize>(count * sizeof(event)));
+}
+
+void allocation_trace::write_header(
+    std::ostream &stream)
+{
+    stream.write(magic, sizeof(magic));
+}
+
+allocation_trace_recorder::allocation_trace_recorder(
+    std::ostream &stream,
+    std::pmr::memory_resource *upstream) :
+        _upstream(upstream == nullptr ? std::pmr::get_default_resource() : upstream),
+        _stream(stream)
+{
+    _buffer.reserve(buffer_capacity);
+    allocation_trace::write_header(_stream);
+}
+
+allocation_trace_recorder::~allocation_trace_recorder() noexcept
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void allocation_trace_recorder::flush()
+{
+    std::lock_guard lock(_mutex);
+    flush_unlocked();
+    _stream.flush();
+}
+
+void *allocation_trace_recorder::do_allocate(
+    size_t size,
+    size_t alignment)
+{
+    void *res = _upstream->allocate(size, alignment);
+
+    std::lock_guard lock(_mutex);
+
+    uint64_t const id = _next_id++;
+    _live.emplace(res, id);
+    record(allocation_trace::event_kind::allocate, id, size, alignment);
+
+    return res;
+}
+
+void allocation_trace_recorder::do_deallocate(
+    void *at,
+    size_t size,
+    size_t alignment)
+{
+    {
+        std::lock_guard lock(_mutex);
+
+        if (auto it = _live.find(at); it != _live.end())
+        {
+            record(allocation_trace::event_kind::deallocate, it->second, size, alignment);
+            _live.erase(it);
+        }
+    }
+
+    _upstream->deallocate(at, size, alignment);
+}
+
+bool allocation_trace_recorder::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+void allocation_trace_recorder::record(
+    allocation_trace::event_kind kind,
+    uint64_t id,
+    size_t size,
+    size_t alignment)
+{
+    auto [thread, inserted] = _threads.emplace(std::this_thread::get_id(), static_cast<uint16_t>(_threads.size()));
+
+    _buffer.push_back({
+        .kind = kind,
+        .alignment_power = static_cast<uint8_t>(std::countr_zero(alignment)),
+        .thread = thread->second,
+        .reserved = 0,
+        .id = id,
+        .size = size });
+
+    if (_buffer.size() == buffer_capacity)
+    {
+        flush_unlocked();
+    }
+}
+
+void allocation_trace_recorder::flush_unlocked()
+{
+    allocation_trace::write_events(_stream, _buffer.data(), _buffer.size());
+    _buffer.clear();
+}
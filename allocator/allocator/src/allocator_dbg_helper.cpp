@@ -38,5 +38,5 @@ char allocator_dbg_helper::int_to_char(int val)
     if (val < 10)
         return '0' + val;
     else
-        return 'A' + val;
+        return 'A' + val - 10;
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "../include/allocator_guard_zones.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+void allocator_guard_zones::quarantine::push(
+    void *user,
+    size_t alignment,
+    std::vector<std::pair<void *, size_t>> &evicted)
+{
+    std::lock_guard lock(_mutex);
+
+    _blocks.emplace_back(user, alignment);
+    _bytes += allocator_guard_zones::size(user);
+
+    while (_blocks.size() > quarantine_blocks_limit || _bytes > quarantine_bytes_limit)
+    {
+        _bytes -= allocator_guard_zones::size(_blocks.front().first);
+        evicted.push_back(_blocks.front());
+        _blocks.pop_front();
+    }
+}
+
+std::vector<std::pair<void *, size_t>> allocator_guard_zones::quarantine::drain()
+{
+    std::lock_guard lock(_mutex);
+
+    std::vector<std::pair<void *, size_t>> res(_blocks.begin(), _blocks.end());
+    _blocks.clear();
+    _bytes = 0;
+
+    return res;
+}
+
+size_t allocator_guard_zones::total_size(
+    size_t size,
+    size_t alignment)
+{
+    size_t const overhead = front_size(alignment) + red_zone_size;
+
+    if (size > std::numeric_limits<size_t>::max() - overhead)
+    {
+        throw std::bad_alloc();
+    }
+
+    return size + overhead;
+}
+
+void *allocator_guard_zones::arm(
+    void *raw,
+    size_t size,
+    size_t alignment) noexcept
+{
+    size_t const front = front_size(alignment);
+    auto *bytes = static_cast<unsigned char *>(raw);
+    void *user = bytes + front;
+
+    std::memset(bytes, red_zone_fill, front - sizeof(block_header));
+    new (bytes + front - sizeof(block_header)) block_header
+        {
+            .size = size,
+            .front = front,
+            .canary = live_magic ^ reinterpret_cast<uintptr_t>(user)
+        };
+    std::memset(user, fresh_fill, size);
+    std::memset(bytes + front + size, red_zone_fill, red_zone_size);
+
+    return user;
+}
+
+void allocator_guard_zones::retire(
+    void *user)
+{
+    auto &block = header(user);
+    auto const address = reinterpret_cast<uintptr_t>(user);
+
+    if (block.canary == (freed_magic ^ address))
+    {
+        report(user, "double free", reinterpret_cast<unsigned char *>(&block), sizeof(block_header));
+    }
+
+    if (block.canary != (live_magic ^ address))
+    {
+        report(user, "block header is overwritten or the block was not allocated here",
+               reinterpret_cast<unsigned char *>(&block), sizeof(block_header));
+    }
+
+    auto *front_zone = static_cast<unsigned char *>(raw(user));
+    size_t const front_zone_size = block.front - sizeof(block_header);
+    if (find_damage(front_zone, front_zone_size, red_zone_fill) != front_zone_size)
+    {
+        report(user, "red zone in front of the block is overwritten", front_zone, front_zone_size);
+    }
+
+    auto *back_zone = static_cast<unsigned char *>(user) + block.size;
+    if (find_damage(back_zone, red_zone_size, red_zone_fill) != red_zone_size)
+    {
+        report(user, "red zone behind the block is overwritten", back_zone, red_zone_size);
+    }
+
+    std::memset(user, freed_fill, block.size);
+    block.canary = freed_magic ^ address;
+}
+
+void allocator_guard_zones::check_retired(
+    void *user)
+{
+    auto &block = header(user);
+
+    if (block.canary != (freed_magic ^ reinterpret_cast<uintptr_t>(user)))
+    {
+        report(user, "block header is overwritten after free",
+               reinterpret_cast<unsigned char *>(&block), sizeof(block_header));
+    }
+
+    auto *bytes = static_cast<unsigned char *>(user);
+    size_t const damage = find_damage(bytes, block.size, freed_fill);
+    if (damage != block.size)
+    {
+        report(user, "block is written after free at offset " + std::to_string(damage),
+               bytes + damage, std::min<size_t>(block.size - damage, red_zone_size));
+    }
+}
+
+void *allocator_guard_zones::raw(
+    void *user) noexcept
+{
+    return static_cast<unsigned char *>(user) - header(user).front;
+}
+
+size_t allocator_guard_zones::size(
+    void *user) noexcept
+{
+    return header(user).size;
+}
+
+size_t allocator_guard_zones::front_size(
+    size_t alignment) noexcept
+{
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    return (red_zone_size + sizeof(block_header) + alignment - 1) & ~(alignment - 1);
+}
+
+allocator_guard_zones::block_header &allocator_guard_zones::header(
+    void *user) noexcept
+{
+    return *reinterpret_cast<block_header *>(static_cast<unsigned char *>(user) - sizeof(block_header));
+}
+
+size_t allocator_guard_zones::find_damage(
+    unsigned char const *zone,
+    size_t size,
+    unsigned char fill) noexcept
+{
+    return std::find_if(zone, zone + size, [fill](unsigned char byte) { return byte != fill; }) - zone;
+}
+
+void allocator_guard_zones::report(
+    void *user,
+    std::string const &what,
+    unsigned char *zone,
+    size_t zone_size)
+{
+    throw std::logic_error("allocator_guard_zones: " + what + " (block " + std::to_string(reinterpret_cast<uintptr_t>(user)) +
+                           "): " + get_dump(reinterpret_cast<char *>(zone), zone_size));
+}
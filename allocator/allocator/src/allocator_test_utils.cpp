@@ -15,6 +15,35 @@ bool allocator_test_utils::block_info::operator!=(
     return !(*this == other);
 }
 
+nlohmann::json allocator_test_utils::get_statistics_json() const
+{
+    return get_statistics().to_json();
+}
+
+void allocator_test_utils::visit_blocks(
+    block_visitor &visitor) const
+{
+    auto const blocks = get_blocks_info();
+
+    visitor.reset();
+
+    for (auto const &block : blocks)
+    {
+        visitor.visit(block);
+    }
+}
+
+void allocator_test_utils::blocks_collector::reset()
+{
+    blocks.clear();
+}
+
+void allocator_test_utils::blocks_collector::visit(
+    block_info const &block)
+{
+    blocks.push_back(block);
+}
+
 std::string allocator_test_utils::print_blocks() const
 {
     auto vec = get_blocks_info_inner();
@@ -0,0 +1,131 @@
+#include "../include/arena_chain.h"
+#include <algorithm>
+#include <new>
+
+void *arena_chain::allocate(
+    size_t size,
+    size_t alignment,
+    std::function<void *()> const &owner_allocate,
+    std::function<arena()> const &grow)
+{
+    void *result = _current == owner ? owner_allocate() : allocate_in(_current, size, alignment);
+
+    if (result != nullptr)
+    {
+        return result;
+    }
+
+    if (_current != owner && (result = owner_allocate()) != nullptr)
+    {
+        switch_to(owner);
+        return result;
+    }
+
+    for (size_t index = _arenas.size(); index-- > 0; )
+    {
+        if (index != _current && (result = allocate_in(index, size, alignment)) != nullptr)
+        {
+            switch_to(index);
+            return result;
+        }
+    }
+
+    try
+    {
+        _arenas.push_back(grow());
+    }
+    catch (std::bad_alloc const &)
+    {
+        return nullptr;
+    }
+
+    if ((result = allocate_in(_arenas.size() - 1, size, alignment)) == nullptr)
+    {
+        // the request is larger than a whole arena
+        _arenas.pop_back();
+        return nullptr;
+    }
+
+    switch_to(_arenas.size() - 1);
+    return result;
+}
+
+bool arena_chain::deallocate(
+    void *at)
+{
+    auto it = std::find_if(_arenas.begin(), _arenas.end(),
+        [at](arena const &candidate) { return at >= candidate.begin && at < candidate.end; });
+
+    if (it == _arenas.end())
+    {
+        return false;
+    }
+
+    it->resource->deallocate(at, 1);
+    // the owner has held the block in its own quarantine already
+    it->resource->flush_quarantine();
+
+    size_t const index = it - _arenas.begin();
+    if (--it->occupied_blocks == 0 && index != _current)
+    {
+        _arenas.erase(it);
+        if (_current != owner && _current > index)
+        {
+            --_current;
+        }
+    }
+
+    return true;
+}
+
+smart_mem_resource *arena_chain::find(
+    void const *at) const noexcept
+{
+    auto it = std::find_if(_arenas.begin(), _arenas.end(),
+        [at](arena const &candidate) { return at >= candidate.begin && at < candidate.end; });
+
+    return it == _arenas.end() ? nullptr : it->resource.get();
+}
+
+void arena_chain::for_each(
+    std::function<void(smart_mem_resource &)> const &visitor) const
+{
+    for (auto &item : _arenas)
+    {
+        visitor(*item.resource);
+    }
+}
+
+void *arena_chain::allocate_in(
+    size_t index,
+    size_t size,
+    size_t alignment) noexcept
+{
+    try
+    {
+        void *result = _arenas[index].resource->allocate(size, alignment);
+        ++_arenas[index].occupied_blocks;
+        return result;
+    }
+    catch (std::bad_alloc const &)
+    {
+        return nullptr;
+    }
+}
+
+void arena_chain::switch_to(
+    size_t index) noexcept
+{
+    size_t const previous = _current;
+    _current = index;
+
+    // the arena kept while it was current is not needed any more once it has no blocks
+    if (previous != owner && previous != index && _arenas[previous].occupied_blocks == 0)
+    {
+        _arenas.erase(_arenas.begin() + previous);
+        if (_current != owner && _current > previous)
+        {
+            --_current;
+        }
+    }
+}
@@ -0,0 +1,280 @@
+#include "../include/numa_memory_resource.h"
+#include <algorithm>
+#include <allocator_test_utils.h>
+#include <climits>
+#include <fstream>
+#include <new>
+#include <string>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t round_up(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    /** Threads pinned to a socket stay on its node, so the node is asked again only once in a while */
+    constexpr size_t node_refresh_period = 64;
+}
+
+numa_memory_resource::node_upstream::node_upstream(
+    size_t node,
+    bool strict)
+    : _node(node),
+      _strict(strict)
+{
+#ifdef __linux__
+    _page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    _page_size = 4096;
+#endif
+}
+
+bool numa_memory_resource::node_upstream::bound() const noexcept
+{
+    return _bound.load(std::memory_order_relaxed);
+}
+
+void *numa_memory_resource::node_upstream::do_allocate(
+    size_t bytes,
+    size_t alignment)
+{
+    if (alignment > _page_size || bytes > SIZE_MAX - _page_size)
+    {
+        throw std::bad_alloc();
+    }
+
+    size_t const size = round_up(bytes, _page_size);
+
+#ifdef __linux__
+    void *result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (result == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    constexpr size_t mask_bits = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> mask(_node / mask_bits + 1);
+    mask[_node / mask_bits] |= 1ul << (_node % mask_bits);
+
+    // pages are not touched yet, so the policy places every page at its first touch.
+    // A bound page has no other node to go to and its allocation fails once the node is full
+    int const mode = _strict ? MPOL_BIND : MPOL_PREFERRED;
+    if (syscall(SYS_mbind, result, size, mode, mask.data(), mask.size() * mask_bits + 1, 0) != 0)
+    {
+        _bound.store(false, std::memory_order_relaxed);
+    }
+
+    return result;
+#else
+    _bound.store(false, std::memory_order_relaxed);
+    return ::operator new(size, std::align_val_t(_page_size));
+#endif
+}
+
+void numa_memory_resource::node_upstream::do_deallocate(
+    void *at,
+    size_t bytes,
+    size_t)
+{
+#ifdef __linux__
+    munmap(at, round_up(bytes, _page_size));
+#else
+    ::operator delete(at, std::align_val_t(_page_size));
+#endif
+}
+
+bool numa_memory_resource::node_upstream::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+numa_memory_resource::numa_memory_resource(
+    sharded_memory_resource::shard_factory const &make_node_allocator,
+    size_t nodes_count,
+    std::pmr::memory_resource *parent_allocator,
+    bool strict_binding)
+    : _upstreams(make_upstreams(nodes_count == 0 ? system_nodes_count() : nodes_count, strict_binding)),
+      _nodes(parents_of(_upstreams, parent_allocator), make_node_allocator,
+             _upstreams.empty() ? sharded_memory_resource::shard_selector() : &numa_memory_resource::current_node) {}
+
+size_t numa_memory_resource::nodes_count() const noexcept
+{
+    return _nodes.shards_count();
+}
+
+std::vector<numa_memory_resource::node_usage> numa_memory_resource::get_node_usage() const
+{
+    std::vector<node_usage> res;
+
+    for (size_t node = 0; node < _nodes.shards_count(); ++node)
+    {
+        auto const *statistics = dynamic_cast<allocator_test_utils const *>(&_nodes.shard(node));
+
+        res.push_back({ .node = node,
+                        .bound = !_upstreams.empty() && _upstreams[node]->bound(),
+                        .reserved_bytes = _nodes.reserved_bytes(node),
+                        .statistics = statistics == nullptr ? allocation_statistics::snapshot() : statistics->get_statistics() });
+    }
+
+    return res;
+}
+
+size_t numa_memory_resource::node_of(
+    void const *at) const
+{
+    return _nodes.owner_of(at);
+}
+
+size_t numa_memory_resource::system_nodes_count() noexcept
+{
+    // a list like "0-1" or "0,2-3"
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+
+    if (!(online >> list))
+    {
+        return 1;
+    }
+
+    size_t highest = 0;
+    size_t value = 0;
+    bool in_number = false;
+
+    for (char c : list)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            value = value * 10 + (c - '0');
+            in_number = true;
+            continue;
+        }
+
+        highest = in_number ? std::max(highest, value) : highest;
+        value = 0;
+        in_number = false;
+    }
+
+    return (in_number ? std::max(highest, value) : highest) + 1;
+}
+
+size_t numa_memory_resource::current_node() noexcept
+{
+    thread_local size_t node = 0;
+    thread_local size_t calls_left = 0;
+
+    if (calls_left-- == 0)
+    {
+        calls_left = node_refresh_period - 1;
+
+#ifdef __linux__
+        unsigned cpu = 0;
+        unsigned current = 0;
+        node = syscall(SYS_getcpu, &cpu, &current, nullptr) == 0 ? current : 0;
+#endif
+    }
+
+    return node;
+}
+
+void *numa_memory_resource::do_allocate_sm(
+    size_t size)
+{
+    return _nodes.allocate(size, default_alignment);
+}
+
+void numa_memory_resource::do_deallocate_sm(
+    void *at)
+{
+    _nodes.deallocate(at, 1);
+}
+
+void *numa_memory_resource::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    return _nodes.allocate(size, alignment);
+}
+
+void numa_memory_resource::do_deallocate_aligned_sm(
+    void *at,
+    size_t alignment)
+{
+    _nodes.deallocate(at, 1, alignment);
+}
+
+bool numa_memory_resource::do_try_expand_sm(
+    void *at,
+    size_t new_size)
+{
+    return _nodes.try_expand(at, new_size);
+}
+
+bool numa_memory_resource::do_shrink_sm(
+    void *at,
+    size_t new_size)
+{
+    return _nodes.shrink(at, new_size);
+}
+
+void numa_memory_resource::do_allocate_batch_sm(
+    size_t size,
+    size_t count,
+    void **out)
+{
+    _nodes.allocate_batch(size, count, out);
+}
+
+void numa_memory_resource::do_deallocate_batch_sm(
+    void *const *at,
+    size_t count)
+{
+    _nodes.deallocate_batch(at, count);
+}
+
+bool numa_memory_resource::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+std::vector<std::unique_ptr<numa_memory_resource::node_upstream>> numa_memory_resource::make_upstreams(
+    size_t nodes_count,
+    bool strict_binding)
+{
+    std::vector<std::unique_ptr<node_upstream>> res;
+
+    for (size_t node = 0; nodes_count > 1 && node < nodes_count; ++node)
+    {
+        res.push_back(std::make_unique<node_upstream>(node, strict_binding));
+    }
+
+    return res;
+}
+
+std::vector<std::pmr::memory_resource *> numa_memory_resource::parents_of(
+    std::vector<std::unique_ptr<node_upstream>> const &upstreams,
+    std::pmr::memory_resource *parent_allocator)
+{
+    if (upstreams.empty())
+    {
+        return { parent_allocator };
+    }
+
+    std::vector<std::pmr::memory_resource *> res;
+    for (auto const &upstream : upstreams)
+    {
+        res.push_back(upstream.get());
+    }
+
+    return res;
+}
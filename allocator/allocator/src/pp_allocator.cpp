@@ -3,16 +3,246 @@
 //
 
 #include "pp_allocator.h"
+#include <cstdint>
+#include <limits>
 
+void* smart_mem_resource::align_up(void* ptr, size_t alignment) noexcept
+{
+    return reinterpret_cast<void*>(align_up(reinterpret_cast<uintptr_t>(ptr), alignment));
+}
+
+bool smart_mem_resource::try_expand([[maybe_unused]] void* at, [[maybe_unused]] size_t new_size)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    return false;
+#else
+    return at != nullptr && do_try_expand_sm(at, new_size);
+#endif
+}
+
+bool smart_mem_resource::shrink([[maybe_unused]] void* at, [[maybe_unused]] size_t new_size)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    return false;
+#else
+    return at != nullptr && do_shrink_sm(at, new_size);
+#endif
+}
+
+void smart_mem_resource::allocate_batch(size_t size, size_t count, void** out, size_t alignment)
+{
+#ifndef MP_OS_ALLOCATOR_HARDENED
+    if (alignment <= default_alignment)
+    {
+        do_allocate_batch_sm(size, count, out);
+        return;
+    }
+#endif
+
+    // block by block for extended alignments, and for every block of a hardened build
+    for (size_t i = 0; i < count; ++i)
+    {
+        try
+        {
+            out[i] = do_allocate(size, alignment);
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+            {
+                do_deallocate(out[i], size, alignment);
+            }
+            throw;
+        }
+    }
+}
+
+void smart_mem_resource::deallocate_batch(void* const* at, size_t count, size_t alignment)
+{
+#ifndef MP_OS_ALLOCATOR_HARDENED
+    if (alignment <= default_alignment)
+    {
+        do_deallocate_batch_sm(at, count);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        do_deallocate(at[i], 1, alignment);
+    }
+}
+
+void smart_mem_resource::do_allocate_batch_sm(size_t size, size_t count, void** out)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        try
+        {
+            out[i] = do_allocate_sm(size);
+        }
+        catch (...)
+        {
+            do_deallocate_batch_sm(out, i);
+            throw;
+        }
+    }
+}
+
+void smart_mem_resource::do_deallocate_batch_sm(void* const* at, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        do_deallocate_sm(at[i]);
+    }
+}
+
+bool smart_mem_resource::do_try_expand_sm(void*, size_t)
+{
+    return false;
+}
+
+bool smart_mem_resource::do_shrink_sm(void*, size_t)
+{
+    return false;
+}
+
+void smart_mem_resource::flush_quarantine()
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    release_guarded(_quarantine.drain());
+#endif
+}
 
-void smart_mem_resource::do_deallocate(void* p, size_t, size_t)
+size_t smart_mem_resource::guard_overhead([[maybe_unused]] size_t alignment) noexcept
 {
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    return allocator_guard_zones::total_size(0, alignment);
+#else
+    return 0;
+#endif
+}
+
+void smart_mem_resource::do_deallocate(void* p, size_t, size_t _Align)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    deallocate_guarded(p, _Align);
+#else
+    if (_Align > default_alignment)
+    {
+        do_deallocate_aligned_sm(p, _Align);
+        return;
+    }
+
     do_deallocate_sm(p);
+#endif
 }
 
 void * smart_mem_resource::do_allocate(size_t _Bytes, size_t _Align)
 {
+    if (_Align > default_alignment && (_Align & (_Align - 1)) != 0)
+    {
+        throw std::bad_alloc();
+    }
+
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    return allocate_guarded(_Bytes, _Align);
+#else
+    if (_Align > default_alignment)
+    {
+        return do_allocate_aligned_sm(_Bytes, _Align);
+    }
+
     return do_allocate_sm(_Bytes);
+#endif
+}
+
+#ifdef MP_OS_ALLOCATOR_HARDENED
+void* smart_mem_resource::allocate_guarded(size_t size, size_t alignment)
+{
+    size_t const total = allocator_guard_zones::total_size(size, alignment);
+    auto const allocate_raw = [this, total, alignment]
+    {
+        return alignment > default_alignment ? do_allocate_aligned_sm(total, alignment) : do_allocate_sm(total);
+    };
+
+    void* raw;
+    try
+    {
+        raw = allocate_raw();
+    }
+    catch (std::bad_alloc const&)
+    {
+        // the quarantine must not make a request fail that its blocks could serve
+        auto const held = _quarantine.drain();
+        if (held.empty())
+        {
+            throw;
+        }
+
+        release_guarded(held);
+        raw = allocate_raw();
+    }
+
+    return allocator_guard_zones::arm(raw, size, alignment);
+}
+
+void smart_mem_resource::deallocate_guarded(void* at, size_t alignment)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_guard_zones::retire(at);
+
+    std::vector<std::pair<void*, size_t>> evicted;
+    _quarantine.push(at, alignment, evicted);
+    release_guarded(evicted);
+}
+
+void smart_mem_resource::release_guarded(std::vector<std::pair<void*, size_t>> const& blocks)
+{
+    for (auto [user, alignment] : blocks)
+    {
+        allocator_guard_zones::check_retired(user);
+
+        if (alignment > default_alignment)
+        {
+            do_deallocate_aligned_sm(allocator_guard_zones::raw(user), alignment);
+        }
+        else
+        {
+            do_deallocate_sm(allocator_guard_zones::raw(user));
+        }
+    }
+}
+#endif
+
+void* smart_mem_resource::do_allocate_aligned_sm(size_t size, size_t alignment)
+{
+    size_t const extra = alignment - 1 + sizeof(void*);
+
+    if (size > std::numeric_limits<size_t>::max() - extra)
+    {
+        throw std::bad_alloc();
+    }
+
+    auto* raw = reinterpret_cast<std::byte*>(do_allocate_sm(size + extra));
+    auto* aligned = reinterpret_cast<void**>(align_up(raw + sizeof(void*), alignment));
+    *(aligned - 1) = raw;
+
+    return aligned;
+}
+
+void smart_mem_resource::do_deallocate_aligned_sm(void* at, size_t)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    do_deallocate_sm(*(reinterpret_cast<void**>(at) - 1));
 }
 
 void* test_mem_resource::do_allocate_sm(size_t n)
@@ -0,0 +1,40 @@
+#include "../include/sequenced_mutex.h"
+
+void sequenced_mutex::lock()
+{
+    _mutex.lock();
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    // writes of the holder must not become visible before the sequence turns odd
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+bool sequenced_mutex::try_lock()
+{
+    if (!_mutex.try_lock())
+    {
+        return false;
+    }
+
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+void sequenced_mutex::unlock() noexcept
+{
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    _mutex.unlock();
+}
+
+uint64_t sequenced_mutex::read_begin() const noexcept
+{
+    return _sequence.load(std::memory_order_acquire);
+}
+
+bool sequenced_mutex::read_validate(
+    uint64_t seen) const noexcept
+{
+    // loads of the walk must not move below the second look at the sequence
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (seen & 1) == 0 && _sequence.load(std::memory_order_relaxed) == seen;
+}
@@ -0,0 +1,322 @@
+#include "../include/sharded_memory_resource.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+sharded_memory_resource::shard_upstream::shard_upstream(
+    sharded_memory_resource &owner,
+    size_t shard,
+    std::pmr::memory_resource *parent_allocator) noexcept
+    : _owner(owner), _shard(shard), _parent_allocator(parent_allocator) {}
+
+void *sharded_memory_resource::shard_upstream::do_allocate(
+    size_t bytes,
+    size_t alignment)
+{
+    void *result = _parent_allocator->allocate(bytes, alignment);
+
+    try
+    {
+        _owner.add_range(result, bytes, _shard);
+    }
+    catch (...)
+    {
+        _parent_allocator->deallocate(result, bytes, alignment);
+        throw;
+    }
+
+    return result;
+}
+
+void sharded_memory_resource::shard_upstream::do_deallocate(
+    void *at,
+    size_t bytes,
+    size_t alignment)
+{
+    _owner.remove_range(at);
+    _parent_allocator->deallocate(at, bytes, alignment);
+}
+
+bool sharded_memory_resource::shard_upstream::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+sharded_memory_resource::sharded_memory_resource(
+    size_t shards_count,
+    shard_factory const &make_shard,
+    std::pmr::memory_resource *parent_allocator)
+    : sharded_memory_resource(std::vector<std::pmr::memory_resource *>(shards_count, parent_allocator), make_shard) {}
+
+sharded_memory_resource::sharded_memory_resource(
+    std::vector<std::pmr::memory_resource *> const &parent_allocators,
+    shard_factory const &make_shard,
+    shard_selector select_home)
+    : _select_home(std::move(select_home))
+{
+    if (parent_allocators.empty())
+    {
+        throw std::logic_error("sharded_memory_resource: at least one shard is needed");
+    }
+
+    _upstreams.reserve(parent_allocators.size());
+    _shards.reserve(parent_allocators.size());
+
+    for (size_t index = 0; index < parent_allocators.size(); ++index)
+    {
+        auto *parent_allocator = parent_allocators[index] == nullptr ? std::pmr::get_default_resource() : parent_allocators[index];
+
+        _upstreams.push_back(std::make_unique<shard_upstream>(*this, index, parent_allocator));
+        _shards.push_back(make_shard(_upstreams.back().get()));
+    }
+}
+
+size_t sharded_memory_resource::shards_count() const noexcept
+{
+    return _shards.size();
+}
+
+smart_mem_resource &sharded_memory_resource::shard(
+    size_t index) const noexcept
+{
+    return *_shards[index];
+}
+
+size_t sharded_memory_resource::home_shard() const
+{
+    if (_select_home)
+    {
+        return _select_home() % _shards.size();
+    }
+
+    static std::atomic<size_t> threads_seen = 0;
+    thread_local size_t const thread_number = threads_seen.fetch_add(1, std::memory_order_relaxed);
+
+    return thread_number % _shards.size();
+}
+
+size_t sharded_memory_resource::reserved_bytes(
+    size_t index) const
+{
+    auto const ranges = _ranges.load(std::memory_order_acquire);
+
+    size_t res = 0;
+    for (auto const &range : *ranges)
+    {
+        res += range.shard == index ? static_cast<size_t>(range.end - range.begin) : 0;
+    }
+
+    return res;
+}
+
+size_t sharded_memory_resource::owner_of(
+    void const *at) const
+{
+    auto const *address = reinterpret_cast<std::byte const *>(at);
+
+    auto const &ranges = current_ranges();
+
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), address,
+        [](std::byte const *value, address_range const &range) { return value < range.begin; });
+
+    if (it == ranges.begin() || address >= (--it)->end)
+    {
+        return _shards.size();
+    }
+
+    return it->shard;
+}
+
+void *sharded_memory_resource::do_allocate_sm(
+    size_t size)
+{
+    return allocate_from_shards(size, default_alignment);
+}
+
+void sharded_memory_resource::do_deallocate_sm(
+    void *at)
+{
+    owning_shard(at).deallocate(at, 1);
+}
+
+void *sharded_memory_resource::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    return allocate_from_shards(size, alignment);
+}
+
+void sharded_memory_resource::do_deallocate_aligned_sm(
+    void *at,
+    size_t alignment)
+{
+    owning_shard(at).deallocate(at, 1, alignment);
+}
+
+bool sharded_memory_resource::do_try_expand_sm(
+    void *at,
+    size_t new_size)
+{
+    return owning_shard(at).try_expand(at, new_size);
+}
+
+bool sharded_memory_resource::do_shrink_sm(
+    void *at,
+    size_t new_size)
+{
+    return owning_shard(at).shrink(at, new_size);
+}
+
+void sharded_memory_resource::do_allocate_batch_sm(
+    size_t size,
+    size_t count,
+    void **out)
+{
+    size_t const home = home_shard();
+
+    for (size_t step = 0; step < _shards.size(); ++step)
+    {
+        try
+        {
+            _shards[(home + step) % _shards.size()]->allocate_batch(size, count, out);
+            return;
+        }
+        catch (std::bad_alloc const &)
+        {
+        }
+    }
+
+    throw std::bad_alloc();
+}
+
+void sharded_memory_resource::do_deallocate_batch_sm(
+    void *const *at,
+    size_t count)
+{
+    // blocks of one batch usually come from one shard, every run of them goes back under one lock
+    for (size_t first = 0; first < count; )
+    {
+        auto &owner = owning_shard(at[first]);
+        size_t last = first + 1;
+
+        while (last < count && &owning_shard(at[last]) == &owner)
+        {
+            ++last;
+        }
+
+        owner.deallocate_batch(at + first, last - first);
+        first = last;
+    }
+}
+
+bool sharded_memory_resource::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+void *sharded_memory_resource::allocate_from_shards(
+    size_t size,
+    size_t alignment)
+{
+    size_t const home = home_shard();
+
+    for (size_t step = 0; step < _shards.size(); ++step)
+    {
+        try
+        {
+            return _shards[(home + step) % _shards.size()]->allocate(size, alignment);
+        }
+        catch (std::bad_alloc const &)
+        {
+        }
+    }
+
+    throw std::bad_alloc();
+}
+
+smart_mem_resource &sharded_memory_resource::owning_shard(
+    void const *at) const
+{
+    size_t const index = owner_of(at);
+
+    if (index == _shards.size())
+    {
+        throw std::logic_error("sharded_memory_resource: block does not belong to any shard");
+    }
+
+    return *_shards[index];
+}
+
+uint64_t sharded_memory_resource::next_ranges_version() noexcept
+{
+    static std::atomic<uint64_t> versions = 1;
+    return versions.fetch_add(1, std::memory_order_relaxed);
+}
+
+sharded_memory_resource::range_table const &sharded_memory_resource::current_ranges() const
+{
+    struct cached_ranges
+    {
+        uint64_t version = 0;
+        std::shared_ptr<range_table const> table;
+    };
+
+    // versions never repeat, so the copy of another resource is never taken for this one
+    thread_local cached_ranges cached;
+
+    uint64_t const version = _ranges_version.load(std::memory_order_acquire);
+    if (cached.version != version)
+    {
+        // the table loaded is at least as new as the version, a newer one is just reloaded once more
+        cached.table = _ranges.load(std::memory_order_acquire);
+        cached.version = version;
+    }
+
+    return *cached.table;
+}
+
+void sharded_memory_resource::publish_ranges(
+    std::shared_ptr<range_table const> ranges)
+{
+    _ranges.store(std::move(ranges), std::memory_order_release);
+    _ranges_version.store(next_ranges_version(), std::memory_order_release);
+}
+
+void sharded_memory_resource::add_range(
+    void const *begin,
+    size_t size,
+    size_t shard)
+{
+    auto const *first = reinterpret_cast<std::byte const *>(begin);
+    address_range const range{ .begin = first, .end = first + size, .shard = shard };
+
+    std::lock_guard lock(_ranges_mutex);
+
+    auto ranges = std::make_shared<range_table>(*_ranges.load(std::memory_order_relaxed));
+    ranges->insert(std::upper_bound(ranges->begin(), ranges->end(), range,
+        [](address_range const &left, address_range const &right) { return left.begin < right.begin; }), range);
+
+    publish_ranges(std::move(ranges));
+}
+
+void sharded_memory_resource::remove_range(
+    void const *begin)
+{
+    auto const *first = reinterpret_cast<std::byte const *>(begin);
+
+    std::lock_guard lock(_ranges_mutex);
+
+    auto ranges = std::make_shared<range_table>(*_ranges.load(std::memory_order_relaxed));
+    auto it = std::lower_bound(ranges->begin(), ranges->end(), first,
+        [](address_range const &range, std::byte const *value) { return range.begin < value; });
+
+    if (it != ranges->end() && it->begin == first)
+    {
+        ranges->erase(it);
+        publish_ranges(std::move(ranges));
+    }
+}
@@ -0,0 +1,199 @@
+#include "../include/thread_local_cache.h"
+#include <algorithm>
+#include <utility>
+
+/** Stocks of one thread for every cache it has touched, parked back into their registries on thread exit */
+struct thread_local_cache::thread_stocks
+{
+    std::vector<std::pair<std::shared_ptr<registry>, std::shared_ptr<thread_stock>>> entries;
+
+    ~thread_stocks()
+    {
+        for (auto &[owner, stock] : entries)
+        {
+            std::lock_guard registry_lock(owner->mutex);
+
+            if (!owner->alive)
+            {
+                continue;
+            }
+
+            std::lock_guard stock_lock(stock->mutex);
+
+            for (auto &stock_bin : stock->bins)
+            {
+                owner->parked.insert(owner->parked.end(), stock_bin.blocks.begin(), stock_bin.blocks.begin() + stock_bin.count);
+                stock_bin.count = 0;
+            }
+
+            std::erase(owner->stocks, stock);
+        }
+    }
+};
+
+thread_local_cache::thread_local_cache() : _registry(std::make_shared<registry>()) {}
+
+thread_local_cache::~thread_local_cache() noexcept
+{
+    std::lock_guard registry_lock(_registry->mutex);
+
+    // waits for every thread to leave its stock, cached blocks go away together with the allocator memory
+    for (auto &stock : _registry->stocks)
+    {
+        std::lock_guard stock_lock(stock->mutex);
+        for (auto &stock_bin : stock->bins)
+        {
+            stock_bin.count = 0;
+        }
+    }
+
+    _registry->alive = false;
+    _registry->stocks.clear();
+    _registry->parked.clear();
+}
+
+size_t thread_local_cache::size_class(
+    size_t size) noexcept
+{
+    return size == 0 || size > size_class_step * size_classes_count
+        ? size_classes_count
+        : (size - 1) / size_class_step;
+}
+
+size_t thread_local_cache::class_size(
+    size_t size_class) noexcept
+{
+    return (size_class + 1) * size_class_step;
+}
+
+void *thread_local_cache::pop(
+    size_t size_class)
+{
+    auto &stock = local_stock();
+    std::lock_guard lock(stock.mutex);
+
+    auto &stock_bin = stock.bins[size_class];
+    return stock_bin.count == 0 ? nullptr : stock_bin.blocks[--stock_bin.count];
+}
+
+void thread_local_cache::fill(
+    size_t size_class,
+    void *const *blocks,
+    size_t count)
+{
+    auto &stock = local_stock();
+    std::lock_guard lock(stock.mutex);
+
+    auto &stock_bin = stock.bins[size_class];
+    std::copy(blocks, blocks + count, stock_bin.blocks.begin() + stock_bin.count);
+    stock_bin.count += count;
+}
+
+size_t thread_local_cache::push(
+    size_t size_class,
+    void *block,
+    void **overflow)
+{
+    auto &stock = local_stock();
+    std::lock_guard lock(stock.mutex);
+
+    auto &stock_bin = stock.bins[size_class];
+    size_t released = 0;
+
+    if (stock_bin.count == bin_capacity)
+    {
+        released = batch_size;
+        std::copy(stock_bin.blocks.begin(), stock_bin.blocks.begin() + batch_size, overflow);
+        std::move(stock_bin.blocks.begin() + batch_size, stock_bin.blocks.end(), stock_bin.blocks.begin());
+        stock_bin.count -= batch_size;
+    }
+
+    stock_bin.blocks[stock_bin.count++] = block;
+
+    return released;
+}
+
+void thread_local_cache::collect(
+    std::vector<void *> &out,
+    bool all_threads)
+{
+    std::lock_guard registry_lock(_registry->mutex);
+
+    out.insert(out.end(), _registry->parked.begin(), _registry->parked.end());
+    _registry->parked.clear();
+
+    if (!all_threads)
+    {
+        return;
+    }
+
+    for (auto &stock : _registry->stocks)
+    {
+        std::lock_guard stock_lock(stock->mutex);
+        for (auto &stock_bin : stock->bins)
+        {
+            out.insert(out.end(), stock_bin.blocks.begin(), stock_bin.blocks.begin() + stock_bin.count);
+            stock_bin.count = 0;
+        }
+    }
+}
+
+void thread_local_cache::visit(
+    std::function<void(std::vector<void *> const &)> const &visitor) const
+{
+    std::lock_guard registry_lock(_registry->mutex);
+
+    std::vector<std::unique_lock<std::mutex>> stock_locks;
+    std::vector<void *> cached(_registry->parked);
+
+    for (auto &stock : _registry->stocks)
+    {
+        stock_locks.emplace_back(stock->mutex);
+        for (auto &stock_bin : stock->bins)
+        {
+            cached.insert(cached.end(), stock_bin.blocks.begin(), stock_bin.blocks.begin() + stock_bin.count);
+        }
+    }
+
+    std::sort(cached.begin(), cached.end());
+    visitor(cached);
+}
+
+thread_local_cache::thread_stock &thread_local_cache::local_stock()
+{
+    thread_local thread_stocks stocks;
+    thread_local registry *last_registry = nullptr;
+    thread_local thread_stock *last_stock = nullptr;
+
+    if (last_registry == _registry.get())
+    {
+        return *last_stock;
+    }
+
+    auto it = std::find_if(stocks.entries.begin(), stocks.entries.end(),
+        [this](auto const &entry) { return entry.first == _registry; });
+
+    if (it == stocks.entries.end())
+    {
+        // stocks of destroyed caches are dropped before a new one is registered
+        std::erase_if(stocks.entries, [](auto const &entry)
+        {
+            std::lock_guard lock(entry.first->mutex);
+            return !entry.first->alive;
+        });
+
+        auto stock = std::make_shared<thread_stock>();
+        {
+            std::lock_guard lock(_registry->mutex);
+            _registry->stocks.push_back(stock);
+        }
+
+        stocks.entries.emplace_back(_registry, std::move(stock));
+        it = std::prev(stocks.entries.end());
+    }
+
+    last_registry = it->first.get();
+    last_stock = it->second.get();
+
+    return *last_stock;
+}
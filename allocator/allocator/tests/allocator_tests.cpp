@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <allocator_sorted_list.h>
+#include <numa_memory_resource.h>
+#include <sharded_memory_resource.h>
+#include <static_allocator.h>
+#include <algorithm>
+#include <barrier>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST(shardedMemoryResourcePositiveTests, test1)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "blocks guarded by both the sharded resource and a shard do not fit the shards";
+#endif
+
+    sharded_memory_resource sharded(4, [](std::pmr::memory_resource *parent)
+    {
+        return std::make_unique<allocator_sorted_list>(1000, parent);
+    });
+
+    size_t const home = sharded.home_shard();
+
+    // a full home shard sends the request on to the next one
+    auto *first_block = sharded.allocate(900, 1);
+    auto *second_block = sharded.allocate(900, 1);
+
+    ASSERT_EQ(sharded.owner_of(first_block), home);
+    ASSERT_EQ(sharded.owner_of(second_block), (home + 1) % 4);
+    ASSERT_EQ(sharded.owner_of(&home), sharded.shards_count());
+
+    // blocks allocated by one thread are freed by another one through the shard holding them
+    std::vector<void *> blocks(4 * 16);
+    std::vector<std::thread> workers;
+
+    for (size_t id = 0; id < 4; ++id)
+    {
+        workers.emplace_back([&sharded, &blocks, id]
+        {
+            sharded.allocate_batch(8, 16, blocks.data() + id * 16);
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::shuffle(blocks.begin(), blocks.end(), std::mt19937(42));
+    sharded.deallocate_batch(blocks.data(), blocks.size());
+    sharded.deallocate(first_block, 900);
+    sharded.deallocate(second_block, 900);
+
+    std::vector<allocator_test_utils::block_info> const expected_blocks_info
+        {
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+
+    for (size_t index = 0; index < sharded.shards_count(); ++index)
+    {
+        ASSERT_EQ(dynamic_cast<allocator_test_utils &>(sharded.shard(index)).get_blocks_info(), expected_blocks_info);
+    }
+}
+
+TEST(shardedMemoryResourcePositiveTests, test2)
+{
+    // growable shards take and return arenas all the time, so frees look owners up while the ranges change
+    sharded_memory_resource sharded(4, [](std::pmr::memory_resource *parent)
+    {
+        return std::make_unique<allocator_sorted_list>(1000, parent, nullptr, allocator_with_fit_mode::fit_mode::first_fit, false, true);
+    });
+
+    std::vector<std::vector<void *>> handed_over(4, std::vector<void *>(16));
+    std::barrier round(4);
+    std::vector<std::thread> workers;
+
+    for (size_t id = 0; id < 4; ++id)
+    {
+        workers.emplace_back([&sharded, &handed_over, &round, id]
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                for (auto &block : handed_over[id])
+                {
+                    block = sharded.allocate(200, 1);
+                }
+                round.arrive_and_wait();
+
+                // blocks of the neighbour thread go back through its shard
+                for (auto *block : handed_over[(id + 1) % 4])
+                {
+                    EXPECT_LT(sharded.owner_of(block), sharded.shards_count());
+                    sharded.deallocate(block, 200);
+                }
+                round.arrive_and_wait();
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    sharded.flush_quarantine();
+    for (size_t index = 0; index < sharded.shards_count(); ++index)
+    {
+        sharded.shard(index).flush_quarantine();
+        for (auto const &block : dynamic_cast<allocator_test_utils &>(sharded.shard(index)).get_blocks_info())
+        {
+            ASSERT_FALSE(block.is_block_occupied);
+        }
+    }
+}
+
+TEST(numaMemoryResourcePositiveTests, test1)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "the numa resource, its shards and node allocators each guard and quarantine a block";
+#endif
+
+    auto const make_node_allocator = [](std::pmr::memory_resource *parent)
+    {
+        return std::make_unique<allocator_sorted_list>(1000, parent);
+    };
+
+    numa_memory_resource detected(make_node_allocator);
+    ASSERT_EQ(detected.nodes_count(), numa_memory_resource::system_nodes_count());
+
+    // two nodes work on any machine, a node the kernel does not know just stays unbound
+    numa_memory_resource numa(make_node_allocator, 2);
+    size_t const local = numa_memory_resource::current_node() % 2;
+
+    auto *first_block = numa.allocate(900, 1);
+    auto *second_block = numa.allocate(900, 1);
+
+    ASSERT_EQ(numa.node_of(first_block), local);
+    ASSERT_EQ(numa.node_of(second_block), 1 - local);
+
+    auto usage = numa.get_node_usage();
+    ASSERT_EQ(usage.size(), 2);
+    for (auto const &node : usage)
+    {
+        ASSERT_GE(node.reserved_bytes, 1000);
+        ASSERT_EQ(node.statistics.allocations_count, 1);
+    }
+
+    numa.deallocate(first_block, 900);
+    numa.deallocate(second_block, 900);
+
+    usage = numa.get_node_usage();
+    ASSERT_EQ(usage[0].statistics.bytes_in_use, 0);
+    ASSERT_EQ(usage[1].statistics.bytes_in_use, 0);
+
+    // strict binding changes where pages may go, not how blocks are served
+    numa_memory_resource strict(make_node_allocator, 2, nullptr, true);
+
+    first_block = strict.allocate(900, 1);
+    ASSERT_EQ(strict.node_of(first_block), local);
+
+    strict.deallocate(first_block, 900);
+    ASSERT_EQ(strict.get_node_usage()[local].statistics.bytes_in_use, 0);
+}
+
+TEST(staticHeapPositiveTests, test1)
+{
+    static_heap<best_fit_policy, no_lock_policy> heap(1000);
+
+    auto *first_block = heap.allocate(100);
+    auto *second_block = heap.allocate(30);
+    auto *third_block = heap.allocate(100);
+    heap.deallocate(first_block);
+
+    // the small block goes to the freed gap rather than to the tail, sizes are rounded up to 16
+    auto *fourth_block = heap.allocate(200);
+    auto *fifth_block = heap.allocate(50);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 48, .is_block_occupied = false },
+            { .block_size = 48, .is_block_occupied = true },
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 224, .is_block_occupied = true },
+            { .block_size = 480, .is_block_occupied = false }
+        };
+    ASSERT_EQ(heap.get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(fifth_block, first_block);
+
+    heap.deallocate(second_block);
+    heap.deallocate(third_block);
+    heap.deallocate(fourth_block);
+    heap.deallocate(fifth_block);
+    ASSERT_THROW(heap.deallocate(fifth_block), std::logic_error);
+
+    // standard containers take the heap without any virtual call in between
+    using map_allocator = static_allocator<std::pair<int const, int>, decltype(heap)>;
+    {
+        std::map<int, int, std::less<int>, map_allocator> map{ map_allocator(heap) };
+        for (int i = 0; i < 10; ++i)
+        {
+            map.emplace(i, i * i);
+        }
+        ASSERT_EQ(map.at(7), 49);
+    }
+
+    expected_blocks_info =
+        {
+            { .block_size = 1008, .is_block_occupied = false }
+        };
+    ASSERT_EQ(heap.get_blocks_info(), expected_blocks_info);
+}
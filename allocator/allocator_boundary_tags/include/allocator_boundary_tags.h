@@ -6,8 +6,13 @@
 #include <pp_allocator.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <thread_local_cache.h>
+#include <arena_chain.h>
+#include <sequenced_mutex.h>
+#include <array>
 #include <iterator>
 #include <mutex>
+#include <optional>
 
 class allocator_boundary_tags final :
     public smart_mem_resource,
@@ -19,13 +24,55 @@ class allocator_boundary_tags final :
 
 private:
 
-    /**
-     * TODO: You must improve it for alignment support
+    /** Freed blocks of one exact size kept whole in deferred coalescing mode, linked through their payloads */
+    struct quick_list
+    {
+        size_t size;
+        void *head;
+    };
+
+    static constexpr const size_t quick_lists_count = 16;
+
+    /** Parked blocks beyond this number make all quick lists go back to the gaps at once */
+    static constexpr const size_t quick_blocks_limit = 256;
+
+    /** Lives at the beginning of trusted memory, blocks follow it.
+     *  Statistics cover the own space only and count blocks in thread stocks and quick lists as occupied,
+     *  the largest gap is searched again only after it gets taken.
+     *  Block walks read the blocks without the mutex and start over when it was taken meanwhile
      */
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(memory_resource*) + sizeof(allocator_with_fit_mode::fit_mode) +
-                                                            sizeof(size_t) + sizeof(std::mutex) + sizeof(void*);
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        allocator_with_fit_mode::fit_mode mode;
+        size_t space_size;
+        sequenced_mutex mutex{};
+        void *first_occupied;
+        std::optional<thread_local_cache> cache{};
+        std::optional<arena_chain> arenas{};
+        allocation_statistics statistics{};
+        size_t occupied_bytes = 0;
+        size_t free_blocks_count = 0;
+        size_t largest_free = 0;
+        bool largest_free_stale = false;
+        bool deferred_coalescing = false;
+        size_t quick_blocks_count = 0;
+        std::array<quick_list, quick_lists_count> quick_lists{};
+    };
+
+    /** Occupied blocks form an address-ordered list, free space is whatever lies between them */
+    struct block_metadata
+    {
+        size_t size;
+        void *prev;
+        void *next;
+        void *trusted;
+    };
+
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
 
-    static constexpr const size_t occupied_block_metadata_size = sizeof(size_t) + sizeof(void*) + sizeof(void*) + sizeof(void*);
+    static constexpr const size_t occupied_block_metadata_size = sizeof(block_metadata);
 
     static constexpr const size_t free_block_metadata_size = 0;
 
@@ -35,9 +82,9 @@ public:
     
     ~allocator_boundary_tags() override;
     
-    allocator_boundary_tags(allocator_boundary_tags const &other);
+    allocator_boundary_tags(allocator_boundary_tags const &other) = delete;
     
-    allocator_boundary_tags &operator=(allocator_boundary_tags const &other);
+    allocator_boundary_tags &operator=(allocator_boundary_tags const &other) = delete;
     
     allocator_boundary_tags(
         allocator_boundary_tags &&other) noexcept;
@@ -51,7 +98,10 @@ public:
             size_t space_size,
             std::pmr::memory_resource *parent_allocator = nullptr,
             logger *logger = nullptr,
-            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+            bool use_thread_cache = false,
+            bool growable = false,
+            bool deferred_coalescing = false);
 
 public:
     
@@ -68,15 +118,153 @@ public:
     inline void set_fit_mode(
         allocator_with_fit_mode::fit_mode mode) override;
 
+    /** In deferred coalescing mode freed blocks wait in quick lists by exact size for an allocation of
+     *  the same size and join the gaps around them only when an allocation finds no gap or the lists overflow.
+     *  Switching the mode off gives all parked blocks back
+     */
+    void set_deferred_coalescing(
+        bool deferred);
+
 public:
     
     std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
 
+    /** Runs without the mutex unless thread stocks or arenas are on, or writers keep interrupting the walk */
+    void visit_blocks(
+        block_visitor &visitor) const override;
+
+    allocation_statistics::snapshot get_statistics() const noexcept override;
+
 private:
 
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    /** Takes the gap following the block, the rest of the gap stays free unless it is too small to host a block */
+    bool do_try_expand_sm(
+        void *at,
+        size_t new_size) override;
+
+    /** The tail joins the gap following the block */
+    bool do_shrink_sm(
+        void *at,
+        size_t new_size) override;
+
+    /** Places the blocks one right after another in the gap behind the previous one,
+     *  a new gap is searched for only when that one runs out
+     */
+    void do_allocate_batch_sm(
+        size_t size,
+        size_t count,
+        void **out) override;
+
+    void do_deallocate_batch_sm(
+        void *const *at,
+        size_t count) override;
+
+    void *allocate_inner(
+        size_t size,
+        size_t alignment);
+
+    /** Block sizes are kept multiples of default_alignment, so a block placed right behind another one starts aligned */
+    static size_t round_size(
+        size_t size) noexcept;
+
+    /** nullptr when no gap fits, mutex must be held */
+    void *allocate_unlocked(
+        size_t size,
+        size_t alignment);
+
+    /** User pointer inside the gap chosen by the fit mode, nullptr when none fits.
+     *  found_prev gets the occupied block in front of the gap
+     */
+    std::byte *find_gap(
+        size_t size,
+        size_t alignment,
+        void *&found_prev,
+        std::byte *&found_gap_end,
+        size_t &found_gap_size);
+
+    /** Occupies the request at user inside the gap behind found_prev, free space is not published */
+    std::byte *occupy(
+        void *found_prev,
+        std::byte *user,
+        std::byte *found_gap_end,
+        size_t found_gap_size,
+        size_t size);
+
+    void deallocate_unlocked(
+        void *at);
+
+    /** Parks an own block in a quick list in deferred coalescing mode, deallocates it otherwise */
+    void release_unlocked(
+        void *at);
+
+    /** Block of exactly size bytes from a quick list, nullptr when there is none */
+    void *quick_pop(
+        size_t size,
+        size_t alignment) noexcept;
+
+    /** false when the block is too small to link or no list is left for its size */
+    bool quick_push(
+        void *at);
+
+    /** Deallocates all blocks parked in quick lists, false when there were none */
+    bool flush_quick_lists();
+
+    /** Gives blocks parked in quick lists and thread stocks back to the gaps, false when there were none */
+    bool reclaim_unlocked();
+
+    /** Own blocks go to release_unlocked, or straight to deallocate_unlocked when a failed batch is rolled back,
+     *  others to the arena holding them. Mutex must be held
+     */
+    void deallocate_batch_unlocked(
+        void *const *at,
+        size_t count,
+        bool rollback);
+
+    /** Another allocator of the same space size taken from the parent allocator */
+    arena_chain::arena make_arena() const;
+
+    /** Refills the calling thread stock with blocks of the class and returns one of them */
+    void *allocate_cached(
+        size_t size_class);
+
+    /** Gives blocks from thread stocks back to the shared list, mutex must be held */
+    void release_cached(
+        std::vector<void *> const &blocks);
+
     std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
 
-/** TODO: Highly recommended for helper functions to return references */
+    /** Blocks with thread stocks and arenas taken into account, takes the mutex */
+    std::vector<allocator_test_utils::block_info> get_blocks_info_locked() const;
+
+    /** Walks the own blocks reading them through sequenced_mutex::load, false as soon as
+     *  what it reads cannot be a consistent heap. Writers change what it reads through sequenced_mutex::store
+     */
+    bool walk_blocks(
+        block_visitor &visitor) const;
+
+    allocator_metadata &get_metadata() const noexcept;
+
+    static block_metadata &get_block(void *block) noexcept;
+
+    void *blocks_begin() const noexcept;
+
+    void *blocks_end() const noexcept;
+
+    /** First byte after the block, where the free gap following it starts */
+    static void *block_end(void *block) noexcept;
+
+    /** Stores the free space shape into statistics, mutex must be held */
+    void publish_free_space() noexcept;
+
+    void destroy() noexcept;
 
     inline logger *get_logger() const override;
 
@@ -88,6 +276,8 @@ private:
         bool _occupied;
         void* _trusted_memory;
 
+        friend class allocator_boundary_tags;
+
     public:
 
         using iterator_category = std::bidirectional_iterator_tag;
@@ -1,21 +1,31 @@
-#include <not_implemented.h>
 #include "../include/allocator_boundary_tags.h"
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <thread>
 
 allocator_boundary_tags::~allocator_boundary_tags()
 {
-    throw not_implemented("allocator_boundary_tags::~allocator_boundary_tags()", "your code should be here...");
+    debug_with_guard([&] { return get_typename() + "::~allocator_boundary_tags() called"; });
+    destroy();
 }
 
 allocator_boundary_tags::allocator_boundary_tags(
-    allocator_boundary_tags &&other) noexcept
+    allocator_boundary_tags &&other) noexcept : _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(allocator_boundary_tags &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_boundary_tags &allocator_boundary_tags::operator=(
     allocator_boundary_tags &&other) noexcept
 {
-    throw not_implemented("allocator_boundary_tags &allocator_boundary_tags::operator=(allocator_boundary_tags &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
 }
 
 
@@ -25,134 +35,1126 @@ allocator_boundary_tags::allocator_boundary_tags(
         size_t space_size,
         std::pmr::memory_resource *parent_allocator,
         logger *logger,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode)
+        allocator_with_fit_mode::fit_mode allocate_fit_mode,
+        bool use_thread_cache,
+        bool growable,
+        bool deferred_coalescing)
 {
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(size_t,std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < occupied_block_metadata_size)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_boundary_tags: space size is too small to hold a single block");
+        }
+        throw std::logic_error("allocator_boundary_tags: space size is too small to hold a single block");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size + space_size, default_alignment);
+
+    auto *metadata = new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .mode = allocate_fit_mode,
+            .space_size = space_size,
+            .first_occupied = nullptr,
+            .deferred_coalescing = deferred_coalescing
+        };
+
+    if (use_thread_cache)
+    {
+        metadata->cache.emplace();
+    }
+
+    if (growable)
+    {
+        metadata->arenas.emplace();
+    }
+
+    metadata->free_blocks_count = 1;
+    metadata->largest_free = space_size;
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::allocator_boundary_tags(size_t, std::pmr::memory_resource *, logger *, fit_mode) finished"; });
 }
 
 [[nodiscard]] void *allocator_boundary_tags::do_allocate_sm(
     size_t size)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_boundary_tags::do_allocate_sm(size_t)", "your code should be here...");
+    auto &cache = get_metadata().cache;
+
+    if (cache)
+    {
+        size_t const size_class = thread_local_cache::size_class(size);
+
+        if (size_class != thread_local_cache::size_classes_count)
+        {
+            void *block = cache->pop(size_class);
+            return block != nullptr ? block : allocate_cached(size_class);
+        }
+    }
+
+    return allocate_inner(size, default_alignment);
+}
+
+size_t allocator_boundary_tags::round_size(
+    size_t size) noexcept
+{
+    // a size no block can take stays as it is and fails the search
+    return size > std::numeric_limits<size_t>::max() - default_alignment ? size : align_up(size, default_alignment);
+}
+
+[[nodiscard]] void *allocator_boundary_tags::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    return allocate_inner(size, alignment);
+}
+
+void *allocator_boundary_tags::allocate_inner(
+    size_t size,
+    size_t alignment)
+{
+    size = round_size(size);
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") started"; });
+
+    auto own_allocate = [this, size, alignment]
+    {
+        void *user = quick_pop(size, alignment);
+
+        if (user == nullptr)
+        {
+            user = allocate_unlocked(size, alignment);
+        }
+
+        // parked blocks may be what the request is missing
+        if (user == nullptr && reclaim_unlocked())
+        {
+            user = allocate_unlocked(size, alignment);
+        }
+
+        return user;
+    };
+
+    void *user = get_metadata().arenas
+        ? get_metadata().arenas->allocate(size, alignment, own_allocate, [this] { return make_arena(); })
+        : own_allocate();
+
+    if (user == nullptr)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): no suitable free block"; });
+        throw std::bad_alloc();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") finished"; });
+
+    return user;
+}
+
+void *allocator_boundary_tags::allocate_unlocked(
+    size_t size,
+    size_t alignment)
+{
+    void *prev = nullptr;
+    std::byte *gap_end = nullptr;
+    size_t gap_size = 0;
+    std::byte *user = find_gap(size, alignment, prev, gap_end, gap_size);
+
+    if (user == nullptr)
+    {
+        return nullptr;
+    }
+
+    user = occupy(prev, user, gap_end, gap_size, size);
+    publish_free_space();
+
+    return user;
+}
+
+std::byte *allocator_boundary_tags::find_gap(
+    size_t size,
+    size_t alignment,
+    void *&found_prev,
+    std::byte *&found_gap_end,
+    size_t &found_gap_size)
+{
+    auto const mode = get_metadata().mode;
+
+    std::byte *found_user = nullptr;
+    bool found = false;
+
+    void *prev = nullptr;
+    void *next = get_metadata().first_occupied;
+    while (true)
+    {
+        auto *gap_begin = reinterpret_cast<std::byte *>(prev == nullptr ? blocks_begin() : block_end(prev));
+        auto *gap_end = reinterpret_cast<std::byte *>(next == nullptr ? blocks_end() : next);
+
+        // padding in front of an aligned block is left as free space, it is merged back on deallocation
+        auto *user = reinterpret_cast<std::byte *>(align_up(gap_begin + occupied_block_metadata_size, alignment));
+        size_t const gap_size = gap_end - gap_begin;
+
+        if (user <= gap_end && static_cast<size_t>(gap_end - user) >= size &&
+            (!found ||
+             ((mode == fit_mode::the_best_fit || mode == fit_mode::segregated_fit) && gap_size < found_gap_size) ||
+             (mode == fit_mode::the_worst_fit && gap_size > found_gap_size)))
+        {
+            found = true;
+            found_prev = prev;
+            found_user = user;
+            found_gap_end = gap_end;
+            found_gap_size = gap_size;
+
+            if (mode == fit_mode::first_fit)
+            {
+                break;
+            }
+        }
+
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        prev = next;
+        next = get_block(next).next;
+    }
+
+    return found_user;
+}
+
+std::byte *allocator_boundary_tags::occupy(
+    void *found_prev,
+    std::byte *user,
+    std::byte *found_gap_end,
+    size_t found_gap_size,
+    size_t size)
+{
+    auto *block = user - occupied_block_metadata_size;
+    size_t const tail = found_gap_end - user - size;
+
+    if (tail != 0 && tail < occupied_block_metadata_size)
+    {
+        warning_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): block size changed to " + std::to_string(size + tail); });
+        size += tail;
+    }
+
+    void *block_next = found_prev == nullptr ? get_metadata().first_occupied : get_block(found_prev).next;
+
+    auto &metadata = get_block(block);
+    sequenced_mutex::store(metadata.size, size);
+    sequenced_mutex::store(metadata.prev, found_prev);
+    sequenced_mutex::store(metadata.next, block_next);
+    sequenced_mutex::store(metadata.trusted, _trusted_memory);
+
+    if (found_prev == nullptr)
+    {
+        sequenced_mutex::store(get_metadata().first_occupied, block);
+    }
+    else
+    {
+        sequenced_mutex::store(get_block(found_prev).next, block);
+    }
+
+    if (block_next != nullptr)
+    {
+        sequenced_mutex::store(get_block(block_next).prev, block);
+    }
+
+    // the gap is split into the padding in front of the block and the rest behind it
+    auto &meta = get_metadata();
+    meta.occupied_bytes += occupied_block_metadata_size + size;
+    meta.free_blocks_count += (block != found_gap_end - found_gap_size) + (block_end(block) != found_gap_end) - 1;
+    meta.largest_free_stale |= found_gap_size == meta.largest_free;
+    meta.statistics.on_allocate(occupied_block_metadata_size + size);
+
+    return user;
+}
+
+void *allocator_boundary_tags::allocate_cached(
+    size_t size_class)
+{
+    size_t const size = thread_local_cache::class_size(size_class);
+    std::array<void *, thread_local_cache::batch_size> blocks;
+    size_t count = 0;
+
+    {
+        std::lock_guard lock(get_metadata().mutex);
+
+        std::vector<void *> parked;
+        get_metadata().cache->collect(parked, false);
+        release_cached(parked);
+
+        while (count < blocks.size() && (blocks[count] = allocate_unlocked(size, default_alignment)) != nullptr)
+        {
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return allocate_inner(size, default_alignment);
+    }
+
+    get_metadata().cache->fill(size_class, blocks.data() + 1, count - 1);
+
+    return blocks[0];
+}
+
+void allocator_boundary_tags::do_allocate_batch_sm(
+    size_t size,
+    size_t count,
+    void **out)
+{
+    size = round_size(size);
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + ") started"; });
+
+    void *last = nullptr;
+    bool own_space_exhausted = false, reclaimed = false;
+
+    for (size_t taken = 0; taken < count; ++taken)
+    {
+        void *prev = last;
+        std::byte *user = nullptr, *gap_end = nullptr;
+        size_t gap_size = 0;
+
+        if (last != nullptr)
+        {
+            auto *gap_begin = reinterpret_cast<std::byte *>(block_end(last));
+            gap_end = reinterpret_cast<std::byte *>(get_block(last).next == nullptr ? blocks_end() : get_block(last).next);
+            gap_size = gap_end - gap_begin;
+            user = gap_size >= occupied_block_metadata_size + size ? gap_begin + occupied_block_metadata_size : nullptr;
+        }
+
+        if (user == nullptr && !own_space_exhausted && (user = find_gap(size, default_alignment, prev, gap_end, gap_size)) == nullptr &&
+            !reclaimed)
+        {
+            // parked blocks may be what the batch is missing
+            reclaimed = true;
+            user = reclaim_unlocked() ? find_gap(size, default_alignment, prev, gap_end, gap_size) : nullptr;
+        }
+
+        if (user != nullptr)
+        {
+            out[taken] = occupy(prev, user, gap_end, gap_size, size);
+            last = user - occupied_block_metadata_size;
+            continue;
+        }
+
+        own_space_exhausted = true;
+        last = nullptr;
+        out[taken] = get_metadata().arenas
+            ? get_metadata().arenas->allocate(size, default_alignment, [] { return nullptr; }, [this] { return make_arena(); })
+            : nullptr;
+
+        if (out[taken] == nullptr)
+        {
+            deallocate_batch_unlocked(out, taken, true);
+            get_metadata().statistics.on_failure();
+            error_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + "): no suitable free block"; });
+            throw std::bad_alloc();
+        }
+    }
+
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + ") finished"; });
+}
+
+arena_chain::arena allocator_boundary_tags::make_arena() const
+{
+    auto *created = new allocator_boundary_tags(get_metadata().space_size, get_metadata().parent_allocator, nullptr, get_metadata().mode,
+        false, false, get_metadata().deferred_coalescing);
+
+    return { .resource = std::unique_ptr<smart_mem_resource>(created), .begin = created->blocks_begin(), .end = created->blocks_end() };
+}
+
+void allocator_boundary_tags::release_cached(
+    std::vector<void *> const &blocks)
+{
+    for (void *block : blocks)
+    {
+        deallocate_unlocked(block);
+    }
 }
 
 void allocator_boundary_tags::do_deallocate_sm(
     void *at)
 {
-    throw not_implemented("void allocator_boundary_tags::do_deallocate_sm(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    auto &cache = get_metadata().cache;
+    auto *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    // only blocks cut exactly to a size class go back to the thread stock
+    if (cache && block >= blocks_begin() && block < blocks_end() && get_block(block).trusted == _trusted_memory)
+    {
+        size_t const size_class = thread_local_cache::size_class(get_block(block).size);
+
+        if (size_class != thread_local_cache::size_classes_count &&
+            thread_local_cache::class_size(size_class) == get_block(block).size)
+        {
+            std::array<void *, thread_local_cache::batch_size> overflow;
+            size_t const released = cache->push(size_class, at, overflow.data());
+
+            if (released != 0)
+            {
+                std::lock_guard lock(get_metadata().mutex);
+                release_cached(std::vector<void *>(overflow.begin(), overflow.begin() + released));
+            }
+
+            return;
+        }
+    }
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) started"; });
+
+    if (!get_metadata().arenas || (block >= blocks_begin() && block < blocks_end()) || !get_metadata().arenas->deallocate(at))
+    {
+        release_unlocked(at);
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+}
+
+void allocator_boundary_tags::deallocate_unlocked(
+    void *at)
+{
+    auto *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).trusted != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_boundary_tags: block does not belong to this allocator");
+    }
+
+    auto &metadata = get_block(block);
+
+    // the block joins the gaps on both of its sides
+    auto *gap_begin = reinterpret_cast<std::byte *>(metadata.prev == nullptr ? blocks_begin() : block_end(metadata.prev));
+    auto *gap_end = reinterpret_cast<std::byte *>(metadata.next == nullptr ? blocks_end() : metadata.next);
+    auto &meta = get_metadata();
+    meta.occupied_bytes -= occupied_block_metadata_size + metadata.size;
+    meta.free_blocks_count += 1 - (gap_begin != block) - (gap_end != block_end(block));
+    meta.largest_free = std::max(meta.largest_free, static_cast<size_t>(gap_end - gap_begin));
+    meta.statistics.on_deallocate(occupied_block_metadata_size + metadata.size);
+
+    if (metadata.prev == nullptr)
+    {
+        sequenced_mutex::store(get_metadata().first_occupied, metadata.next);
+    }
+    else
+    {
+        sequenced_mutex::store(get_block(metadata.prev).next, metadata.next);
+    }
+
+    if (metadata.next != nullptr)
+    {
+        sequenced_mutex::store(get_block(metadata.next).prev, metadata.prev);
+    }
+
+    sequenced_mutex::store(metadata.trusted, nullptr);
+    publish_free_space();
+}
+
+void allocator_boundary_tags::do_deallocate_batch_sm(
+    void *const *at,
+    size_t count)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::deallocate_batch(" + std::to_string(count) + ") started"; });
+
+    deallocate_batch_unlocked(at, count, false);
+
+    debug_with_guard([&] { return get_typename() + "::deallocate_batch(" + std::to_string(count) + ") finished"; });
+}
+
+void allocator_boundary_tags::deallocate_batch_unlocked(
+    void *const *at,
+    size_t count,
+    bool rollback)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto *block = reinterpret_cast<std::byte *>(at[i]) - occupied_block_metadata_size;
+
+        if (at[i] != nullptr &&
+            (!get_metadata().arenas || (block >= blocks_begin() && block < blocks_end()) || !get_metadata().arenas->deallocate(at[i])))
+        {
+            rollback ? deallocate_unlocked(at[i]) : release_unlocked(at[i]);
+        }
+    }
+}
+
+void allocator_boundary_tags::release_unlocked(
+    void *at)
+{
+    auto *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+    bool const own = block >= blocks_begin() && block < blocks_end() && get_block(block).trusted == _trusted_memory;
+
+    if (!own || !get_metadata().deferred_coalescing || !quick_push(at))
+    {
+        deallocate_unlocked(at);
+    }
+}
+
+void *allocator_boundary_tags::quick_pop(
+    size_t size,
+    size_t alignment) noexcept
+{
+    auto &meta = get_metadata();
+
+    if (meta.quick_blocks_count == 0)
+    {
+        return nullptr;
+    }
+
+    for (auto &list : meta.quick_lists)
+    {
+        if (list.head != nullptr && list.size == size && align_up(list.head, alignment) == list.head)
+        {
+            void *user = list.head;
+            list.head = *reinterpret_cast<void **>(user);
+            --meta.quick_blocks_count;
+            return user;
+        }
+    }
+
+    return nullptr;
+}
+
+bool allocator_boundary_tags::quick_push(
+    void *at)
+{
+    size_t const size = get_block(reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size).size;
+
+    if (size < sizeof(void *))
+    {
+        return false;
+    }
+
+    auto &meta = get_metadata();
+    quick_list *target = nullptr;
+
+    for (auto &list : meta.quick_lists)
+    {
+        if (list.head != nullptr && list.size == size)
+        {
+            target = &list;
+            break;
+        }
+
+        if (list.head == nullptr && target == nullptr)
+        {
+            target = &list;
+        }
+    }
+
+    if (target == nullptr)
+    {
+        return false;
+    }
+
+    target->size = size;
+    *reinterpret_cast<void **>(at) = target->head;
+    target->head = at;
+
+    if (++meta.quick_blocks_count > quick_blocks_limit)
+    {
+        flush_quick_lists();
+    }
+
+    return true;
+}
+
+bool allocator_boundary_tags::flush_quick_lists()
+{
+    auto &meta = get_metadata();
+    bool const had_quick_blocks = meta.quick_blocks_count != 0;
+
+    for (auto &list : meta.quick_lists)
+    {
+        while (list.head != nullptr)
+        {
+            void *user = list.head;
+            list.head = *reinterpret_cast<void **>(user);
+            deallocate_unlocked(user);
+        }
+    }
+
+    meta.quick_blocks_count = 0;
+
+    return had_quick_blocks;
+}
+
+bool allocator_boundary_tags::reclaim_unlocked()
+{
+    bool const had_quick_blocks = flush_quick_lists();
+
+    if (!get_metadata().cache)
+    {
+        return had_quick_blocks;
+    }
+
+    std::vector<void *> cached;
+    get_metadata().cache->collect(cached, true);
+    release_cached(cached);
+
+    return had_quick_blocks || !cached.empty();
+}
+
+void allocator_boundary_tags::do_deallocate_aligned_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
+}
+
+bool allocator_boundary_tags::do_try_expand_sm(
+    void *at,
+    size_t new_size)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::try_expand(void *, " + std::to_string(new_size) + ") started"; });
+
+    auto *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    if (get_metadata().arenas && (block < blocks_begin() || block >= blocks_end()))
+    {
+        if (auto *arena = get_metadata().arenas->find(at); arena != nullptr)
+        {
+            return arena->try_expand(at, new_size);
+        }
+    }
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).trusted != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::try_expand(void *, size_t): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_boundary_tags: block does not belong to this allocator");
+    }
+
+    auto &metadata = get_block(block);
+    size_t const old_size = metadata.size;
+
+    if (new_size <= old_size)
+    {
+        return true;
+    }
+
+    auto *gap_end = reinterpret_cast<std::byte *>(metadata.next == nullptr ? blocks_end() : metadata.next);
+    size_t const available = gap_end - reinterpret_cast<std::byte *>(at);
+
+    if (new_size > available)
+    {
+        return false;
+    }
+
+    // only the arena tail may end unaligned, there the block takes what is left
+    new_size = std::min(round_size(new_size), available);
+
+    if (available - new_size < occupied_block_metadata_size)
+    {
+        new_size = available;
+    }
+
+    auto &meta = get_metadata();
+    meta.occupied_bytes += new_size - old_size;
+    meta.free_blocks_count -= new_size == available;
+    meta.largest_free_stale |= available - old_size == meta.largest_free;
+    meta.statistics.on_resize(occupied_block_metadata_size + old_size, occupied_block_metadata_size + new_size);
+    sequenced_mutex::store(metadata.size, new_size);
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::try_expand(void *, " + std::to_string(new_size) + ") finished"; });
+
+    return true;
+}
+
+bool allocator_boundary_tags::do_shrink_sm(
+    void *at,
+    size_t new_size)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::shrink(void *, " + std::to_string(new_size) + ") started"; });
+
+    auto *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    if (get_metadata().arenas && (block < blocks_begin() || block >= blocks_end()))
+    {
+        if (auto *arena = get_metadata().arenas->find(at); arena != nullptr)
+        {
+            return arena->shrink(at, new_size);
+        }
+    }
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).trusted != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::shrink(void *, size_t): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_boundary_tags: block does not belong to this allocator");
+    }
+
+    auto &metadata = get_block(block);
+    size_t const old_size = metadata.size;
+
+    new_size = round_size(new_size);
+
+    if (new_size >= old_size)
+    {
+        return false;
+    }
+
+    auto *gap_end = reinterpret_cast<std::byte *>(metadata.next == nullptr ? blocks_end() : metadata.next);
+    size_t const gap = gap_end - reinterpret_cast<std::byte *>(block_end(block));
+    size_t const released = old_size - new_size;
+
+    // a new gap too small to host any block would only be dust
+    if (gap == 0 && released < occupied_block_metadata_size)
+    {
+        return false;
+    }
+
+    auto &meta = get_metadata();
+    meta.occupied_bytes -= released;
+    meta.free_blocks_count += gap == 0;
+    meta.largest_free = std::max(meta.largest_free, gap + released);
+    meta.statistics.on_resize(occupied_block_metadata_size + old_size, occupied_block_metadata_size + new_size);
+    sequenced_mutex::store(metadata.size, new_size);
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::shrink(void *, " + std::to_string(new_size) + ") finished"; });
+
+    return true;
 }
 
 inline void allocator_boundary_tags::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_boundary_tags::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+    get_metadata().mode = mode;
+
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([mode](smart_mem_resource &arena)
+        {
+            dynamic_cast<allocator_with_fit_mode &>(arena).set_fit_mode(mode);
+        });
+    }
 }
 
 
+void allocator_boundary_tags::set_deferred_coalescing(
+    bool deferred)
+{
+    std::lock_guard lock(get_metadata().mutex);
+    get_metadata().deferred_coalescing = deferred;
+
+    if (!deferred)
+    {
+        flush_quick_lists();
+    }
+
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([deferred](smart_mem_resource &arena)
+        {
+            dynamic_cast<allocator_boundary_tags &>(arena).set_deferred_coalescing(deferred);
+        });
+    }
+}
+
 std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info() const", "your code should be here...");
+    blocks_collector collector;
+    visit_blocks(collector);
+    return std::move(collector.blocks);
+}
+
+void allocator_boundary_tags::visit_blocks(
+    block_visitor &visitor) const
+{
+    auto &meta = get_metadata();
+
+    for (size_t pass = 0; pass < optimistic_passes; ++pass)
+    {
+        uint64_t const seen = meta.mutex.read_begin();
+        if (seen & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // thread stocks and arenas are read under the sequence check too, blocks they hold take the mutex
+        if (meta.cache || meta.arenas)
+        {
+            break;
+        }
+
+        visitor.reset();
+        if (walk_blocks(visitor) && meta.mutex.read_validate(seen))
+        {
+            return;
+        }
+    }
+
+    visitor.reset();
+    for (auto const &block : get_blocks_info_locked())
+    {
+        visitor.visit(block);
+    }
+}
+
+std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info_locked() const
+{
+    std::lock_guard lock(get_metadata().mutex);
+    std::vector<allocator_test_utils::block_info> res;
+
+    if (!get_metadata().cache)
+    {
+        res = get_blocks_info_inner();
+    }
+    else
+    {
+        // blocks in thread stocks are free for the user even though the occupied list still holds them
+        get_metadata().cache->visit([this, &res](std::vector<void *> const &cached)
+        {
+            for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+            {
+                void *user = reinterpret_cast<std::byte *>(*it) + occupied_block_metadata_size;
+                res.push_back({ .block_size = it.size(),
+                                .is_block_occupied = it.occupied() && !std::binary_search(cached.begin(), cached.end(), user) });
+            }
+        });
+    }
+
+    // blocks of extra arenas follow the own ones, arena by arena
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([&res](smart_mem_resource &arena)
+        {
+            auto arena_blocks = dynamic_cast<allocator_test_utils &>(arena).get_blocks_info();
+            res.insert(res.end(), arena_blocks.begin(), arena_blocks.end());
+        });
+    }
+
+    return res;
+}
+
+allocation_statistics::snapshot allocator_boundary_tags::get_statistics() const noexcept
+{
+    return get_metadata().statistics.get();
 }
 
 inline logger *allocator_boundary_tags::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_boundary_tags::get_logger() const", "your code should be here...");
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
 }
 
 inline std::string allocator_boundary_tags::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_boundary_tags::get_typename() const noexcept", "your code should be here...");
+    return "allocator_boundary_tags";
 }
 
 
 allocator_boundary_tags::boundary_iterator allocator_boundary_tags::begin() const noexcept
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator allocator_boundary_tags::begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_boundary_tags::boundary_iterator allocator_boundary_tags::end() const noexcept
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator allocator_boundary_tags::end() const noexcept", "your code should be here...");
+    boundary_iterator it;
+    it._trusted_memory = _trusted_memory;
+    return it;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+    {
+        res.push_back({ .block_size = it.size(), .is_block_occupied = it.occupied() });
+    }
+
+    return res;
+}
+
+bool allocator_boundary_tags::walk_blocks(
+    block_visitor &visitor) const
+{
+    auto *cursor = reinterpret_cast<std::byte *>(blocks_begin());
+    auto *const end = reinterpret_cast<std::byte *>(blocks_end());
+    auto *block = reinterpret_cast<std::byte *>(sequenced_mutex::load(get_metadata().first_occupied));
+
+    while (block != nullptr)
+    {
+        // every next block lies behind the end of the previous one, so the walk cannot go in circles
+        if (block < cursor || block >= end || static_cast<size_t>(end - block) < occupied_block_metadata_size)
+        {
+            return false;
+        }
+
+        if (block != cursor)
+        {
+            visitor.visit({ .block_size = static_cast<size_t>(block - cursor), .is_block_occupied = false });
+        }
+
+        auto const &meta = *reinterpret_cast<block_metadata const *>(block);
+        size_t const size = sequenced_mutex::load(meta.size);
+
+        if (size > static_cast<size_t>(end - block) - occupied_block_metadata_size)
+        {
+            return false;
+        }
+
+        visitor.visit({ .block_size = occupied_block_metadata_size + size, .is_block_occupied = true });
+        cursor = block + occupied_block_metadata_size + size;
+        block = reinterpret_cast<std::byte *>(sequenced_mutex::load(meta.next));
+    }
+
+    if (cursor != end)
+    {
+        visitor.visit({ .block_size = static_cast<size_t>(end - cursor), .is_block_occupied = false });
+    }
+
+    return true;
+}
+
+allocator_boundary_tags::allocator_metadata &allocator_boundary_tags::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_boundary_tags::block_metadata &allocator_boundary_tags::get_block(void *block) noexcept
+{
+    return *reinterpret_cast<block_metadata *>(block);
+}
+
+void *allocator_boundary_tags::blocks_begin() const noexcept
+{
+    return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size;
+}
+
+void *allocator_boundary_tags::blocks_end() const noexcept
+{
+    return reinterpret_cast<std::byte *>(blocks_begin()) + get_metadata().space_size;
+}
+
+void *allocator_boundary_tags::block_end(void *block) noexcept
+{
+    return reinterpret_cast<std::byte *>(block) + occupied_block_metadata_size + get_block(block).size;
 }
 
-allocator_boundary_tags::allocator_boundary_tags(const allocator_boundary_tags &other)
+void allocator_boundary_tags::publish_free_space() noexcept
 {
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(const allocator_boundary_tags &other)", "your code should be here...");
+    auto &meta = get_metadata();
+
+    if (meta.largest_free_stale)
+    {
+        meta.largest_free = 0;
+        void *gap_begin = blocks_begin();
+        for (void *block = meta.first_occupied; ; block = get_block(block).next)
+        {
+            void *gap_end = block == nullptr ? blocks_end() : block;
+            meta.largest_free = std::max(meta.largest_free, static_cast<size_t>(reinterpret_cast<std::byte *>(gap_end) - reinterpret_cast<std::byte *>(gap_begin)));
+
+            if (block == nullptr)
+            {
+                break;
+            }
+
+            gap_begin = block_end(block);
+        }
+        meta.largest_free_stale = false;
+    }
+
+    meta.statistics.set_free_space(meta.space_size - meta.occupied_bytes, meta.largest_free, meta.free_blocks_count);
 }
 
-allocator_boundary_tags &allocator_boundary_tags::operator=(const allocator_boundary_tags &other)
+void allocator_boundary_tags::destroy() noexcept
 {
-    throw not_implemented("allocator_boundary_tags &allocator_boundary_tags::operator=(const allocator_boundary_tags &other)", "your code should be here...");
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const total_size = allocator_metadata_size + get_metadata().space_size;
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, total_size, default_alignment);
+    _trusted_memory = nullptr;
 }
 
 bool allocator_boundary_tags::do_is_equal(const std::pmr::memory_resource &other) const noexcept
 {
-    throw not_implemented("bool allocator_boundary_tags::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    auto p = dynamic_cast<const allocator_boundary_tags*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
 }
 
 bool allocator_boundary_tags::boundary_iterator::operator==(
         const allocator_boundary_tags::boundary_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_boundary_tags::boundary_iterator::operator==(const allocator_boundary_tags::boundary_iterator &) const noexcept", "your code should be here...");
+    return _occupied_ptr == other._occupied_ptr && _occupied == other._occupied;
 }
 
 bool allocator_boundary_tags::boundary_iterator::operator!=(
         const allocator_boundary_tags::boundary_iterator & other) const noexcept
 {
-    throw not_implemented("bool allocator_boundary_tags::boundary_iterator::operator!=(const allocator_boundary_tags::boundary_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_boundary_tags::boundary_iterator &allocator_boundary_tags::boundary_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator &allocator_boundary_tags::boundary_iterator::operator++() & noexcept", "your code should be here...");
+    if (!_occupied)
+    {
+        // free gap in front of _occupied_ptr, or the trailing one when it is nullptr
+        _occupied = true;
+        return *this;
+    }
+
+    void *next = get_block(_occupied_ptr).next;
+    void *gap_end = next == nullptr
+            ? reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size + reinterpret_cast<allocator_metadata *>(_trusted_memory)->space_size
+            : next;
+
+    _occupied = block_end(_occupied_ptr) == gap_end;
+    _occupied_ptr = next;
+    return *this;
 }
 
 allocator_boundary_tags::boundary_iterator &allocator_boundary_tags::boundary_iterator::operator--() & noexcept
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator &allocator_boundary_tags::boundary_iterator::operator--() & noexcept", "your code should be here...");
+    if (_occupied && _occupied_ptr != nullptr)
+    {
+        void *prev = get_block(_occupied_ptr).prev;
+        void *gap_begin = prev == nullptr ? reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size : block_end(prev);
+
+        if (gap_begin != _occupied_ptr)
+        {
+            _occupied = false;
+        }
+        else
+        {
+            _occupied_ptr = prev;
+        }
+        return *this;
+    }
+
+    // from the end or from a gap, the previous element is the occupied block in front of it
+    if (_occupied_ptr == nullptr)
+    {
+        void *last = reinterpret_cast<allocator_metadata *>(_trusted_memory)->first_occupied;
+        while (last != nullptr && get_block(last).next != nullptr)
+        {
+            last = get_block(last).next;
+        }
+
+        if (_occupied && (last == nullptr ? reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size : block_end(last)) != get_ptr())
+        {
+            _occupied = false;
+            return *this;
+        }
+
+        _occupied_ptr = last;
+    }
+    else
+    {
+        _occupied_ptr = get_block(_occupied_ptr).prev;
+    }
+
+    _occupied = true;
+    return *this;
 }
 
-allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator++(int n)
+allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator++(int)
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator++(int n)", "your code should be here...");
+    auto tmp = *this;
+    ++*this;
+    return tmp;
 }
 
-allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator--(int n)
+allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator--(int)
 {
-    throw not_implemented("allocator_boundary_tags::boundary_iterator allocator_boundary_tags::boundary_iterator::operator--(int n)", "your code should be here...");
+    auto tmp = *this;
+    --*this;
+    return tmp;
 }
 
 size_t allocator_boundary_tags::boundary_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_boundary_tags::boundary_iterator::size() const noexcept", "your code should be here...");
+    if (_occupied)
+    {
+        return occupied_block_metadata_size + get_block(_occupied_ptr).size;
+    }
+
+    return reinterpret_cast<std::byte *>(get_ptr()) - reinterpret_cast<std::byte *>(operator*());
 }
 
 bool allocator_boundary_tags::boundary_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_boundary_tags::boundary_iterator::occupied() const noexcept", "your code should be here...");
+    return _occupied;
 }
 
 void* allocator_boundary_tags::boundary_iterator::operator*() const noexcept
 {
-    throw not_implemented("void* allocator_boundary_tags::boundary_iterator::operator*() const noexcept", "your code should be here...");
-}
+    if (_occupied)
+    {
+        return _occupied_ptr;
+    }
 
-allocator_boundary_tags::boundary_iterator::boundary_iterator()
-{
-    throw not_implemented("allocator_boundary_tags::boundary_iterator::boundary_iterator()", "your code should be here...");
+    void *prev;
+    if (_occupied_ptr != nullptr)
+    {
+        prev = get_block(_occupied_ptr).prev;
+    }
+    else
+    {
+        prev = reinterpret_cast<allocator_metadata *>(_trusted_memory)->first_occupied;
+        while (prev != nullptr && get_block(prev).next != nullptr)
+        {
+            prev = get_block(prev).next;
+        }
+    }
+
+    return prev == nullptr ? reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size : block_end(prev);
 }
 
+allocator_boundary_tags::boundary_iterator::boundary_iterator() : _occupied_ptr(nullptr), _occupied(true), _trusted_memory(nullptr) {}
+
 allocator_boundary_tags::boundary_iterator::boundary_iterator(void *trusted)
-{
-    throw not_implemented("allocator_boundary_tags::boundary_iterator::boundary_iterator(void *)", "your code should be here...");
-}
+    : _occupied_ptr(reinterpret_cast<allocator_metadata *>(trusted)->first_occupied),
+      _occupied(reinterpret_cast<std::byte *>(trusted) + allocator_metadata_size == _occupied_ptr),
+      _trusted_memory(trusted) {}
 
+/** Block an element is or stands in front of, for a free gap it is the end of the gap */
 void *allocator_boundary_tags::boundary_iterator::get_ptr() const noexcept
 {
-    throw not_implemented("void *allocator_boundary_tags::boundary_iterator::get_ptr() const noexcept", "your code should be here...");
+    if (_occupied_ptr == nullptr)
+    {
+        return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size + reinterpret_cast<allocator_metadata *>(_trusted_memory)->space_size;
+    }
+
+    return _occupied_ptr;
 }
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 #include <allocator_dbg_helper.h>
 #include <allocator_boundary_tags.h>
+#include <allocator_guard_zones.h>
 #include <client_logger_builder.h>
 #include <memory>
 #include <list>
+#include <random>
+#include <thread>
 
 logger *create_logger(
     std::vector<std::pair<std::string, logger::severity>> const &output_file_streams_setup,
@@ -31,6 +34,10 @@ logger *create_logger(
 
 TEST(positiveTests, test1)
 {
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move every block";
+#endif
+
     std::unique_ptr<logger> logger(create_logger(std::vector<std::pair<std::string, logger::severity>>
         {
             {
@@ -38,14 +45,14 @@ TEST(positiveTests, test1)
                 logger::severity::information
             }
         }));
-    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(sizeof(int) * 70, nullptr, logger.get(), allocator_with_fit_mode::fit_mode::first_fit));
+    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(sizeof(int) * 88, nullptr, logger.get(), allocator_with_fit_mode::fit_mode::first_fit));
     
-    auto *first_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
-    auto *second_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
-    auto *third_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
+    auto *first_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 16));
+    auto *second_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 16));
+    auto *third_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 16));
     
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 10) + sizeof(size_t) + sizeof(void*) * 3), second_block);
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(second_block + 10) + sizeof(size_t) + sizeof(void*) * 3), third_block);
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 16) + sizeof(size_t) + sizeof(void*) * 3), second_block);
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(second_block + 16) + sizeof(size_t) + sizeof(void*) * 3), third_block);
     
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(second_block)), 1);
     
@@ -55,8 +62,9 @@ TEST(positiveTests, test1)
     the_same_subject->set_fit_mode(allocator_with_fit_mode::fit_mode::the_best_fit);
     auto *fifth_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 1));
     
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 10) + sizeof(size_t) + sizeof(void*) * 3), fourth_block);
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(fourth_block + 1) + sizeof(size_t) + sizeof(void*) * 3), fifth_block);
+    // block sizes are rounded up to alignof(std::max_align_t)
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 16) + sizeof(size_t) + sizeof(void*) * 3), fourth_block);
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(fourth_block) + alignof(std::max_align_t) + sizeof(size_t) + sizeof(void*) * 3), fifth_block);
     
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(first_block)), 1);
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(third_block)), 1);
@@ -79,13 +87,17 @@ TEST(positiveTests, test2)
     char *first_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 1000));
     char *second_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 0));
     allocator_instance->deallocate(first_block, 1);
+    allocator_instance->flush_quarantine();
     first_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 999));
     auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    size_t const block_overhead = sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3 + smart_mem_resource::guard_overhead();
+    // 999 and 1000 bytes both round up to the same multiple of alignof(std::max_align_t)
+    size_t const rounded_size = 1008;
     std::vector<allocator_test_utils::block_info> expected_blocks_state
         {
-            { .block_size = 1000 + sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3, .is_block_occupied = true },
-            { .block_size = sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3, .is_block_occupied = true },
-            { .block_size = 3000 - (1000 + (sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3) * 2), .is_block_occupied = false }
+            { .block_size = rounded_size + block_overhead, .is_block_occupied = true },
+            { .block_size = block_overhead, .is_block_occupied = true },
+            { .block_size = 3000 - (rounded_size + block_overhead * 2), .is_block_occupied = false }
         };
     
     ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
@@ -98,6 +110,429 @@ TEST(positiveTests, test2)
     allocator_instance->deallocate(second_block, 1);
 }
 
+TEST(positiveTests, test3)
+{
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit));
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 10);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 100, 64);
+    void *third_block = allocator_instance->allocate(sizeof(char) * 40, 256);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 256, 0);
+
+    void *odd_block = allocator_instance->allocate(5, 8);
+    void *fourth_block = allocator_instance->allocate(8, 8);
+    void *fifth_block = allocator_instance->allocate(16, 16);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fourth_block) % 8, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fifth_block) % 16, 0);
+
+    allocator_instance->deallocate(odd_block, 5, 8);
+    allocator_instance->deallocate(fourth_block, 8, 8);
+    allocator_instance->deallocate(fifth_block, 16, 16);
+    allocator_instance->deallocate(second_block, 100, 64);
+    allocator_instance->deallocate(first_block, 10);
+    allocator_instance->deallocate(third_block, 40, 256);
+    allocator_instance->flush_quarantine();
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 3000);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+}
+
+TEST(positiveTests, test4)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(200'000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, true));
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 8; ++i)
+    {
+        workers.emplace_back([&allocator, i]
+        {
+            std::mt19937 engine(i);
+            std::vector<void *> allocated_blocks;
+
+            for (int j = 0; j < 10'000; ++j)
+            {
+                if (allocated_blocks.empty() || (allocated_blocks.size() < 32 && engine() % 3 != 0))
+                {
+                    allocated_blocks.push_back(allocator->allocate(engine() % 256 + 1));
+                    continue;
+                }
+
+                std::swap(allocated_blocks[engine() % allocated_blocks.size()], allocated_blocks.back());
+                allocator->deallocate(allocated_blocks.back(), 1);
+                allocated_blocks.pop_back();
+            }
+
+            for (auto block : allocated_blocks)
+            {
+                allocator->deallocate(block, 1);
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    // the whole space fits only once the stocks of finished threads and the quick lists are given back and coalesced
+    allocator->flush_quarantine();
+    size_t const block_metadata_size = sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3;
+    void *whole = allocator->allocate(200'000 - block_metadata_size - smart_mem_resource::guard_overhead());
+
+    auto occupied_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    ASSERT_EQ(occupied_state.size(), 1);
+    ASSERT_EQ(occupied_state[0].block_size, 200'000);
+    ASSERT_TRUE(occupied_state[0].is_block_occupied);
+
+    allocator->deallocate(whole, 1);
+    allocator->flush_quarantine();
+
+    auto free_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    ASSERT_EQ(free_state.size(), 1);
+    ASSERT_EQ(free_state[0].block_size, 200'000);
+    ASSERT_FALSE(free_state[0].is_block_occupied);
+}
+
+TEST(positiveTests, test5)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(20'000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, true, true));
+
+    // the peak of live blocks is several times the space, extra arenas take the rest
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 8; ++i)
+    {
+        workers.emplace_back([&allocator, i]
+        {
+            std::mt19937 engine(i);
+            std::vector<void *> allocated_blocks;
+
+            for (int j = 0; j < 10'000; ++j)
+            {
+                if (allocated_blocks.empty() || (allocated_blocks.size() < 32 && engine() % 3 != 0))
+                {
+                    allocated_blocks.push_back(allocator->allocate(engine() % 256 + 1));
+                    continue;
+                }
+
+                std::swap(allocated_blocks[engine() % allocated_blocks.size()], allocated_blocks.back());
+                allocator->deallocate(allocated_blocks.back(), 1);
+                allocated_blocks.pop_back();
+            }
+
+            for (auto block : allocated_blocks)
+            {
+                allocator->deallocate(block, 1);
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    allocator->flush_quarantine();
+
+    size_t total_size = 0;
+    for (auto const &block : dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info())
+    {
+        ASSERT_FALSE(block.is_block_occupied);
+        total_size += block.block_size;
+    }
+    ASSERT_GE(total_size, 20'000);
+    ASSERT_LE(total_size, 40'000);
+    ASSERT_EQ(total_size % 20'000, 0);
+}
+
+TEST(positiveTests, test6)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guarded blocks are never resized in place";
+#endif
+
+    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(subject.get());
+    pp_allocator<int> ints(subject.get());
+
+    auto *first_block = ints.allocate(25);
+    auto *second_block = ints.allocate(25);
+
+    ASSERT_FALSE(ints.resize_in_place(first_block, 25, 40));
+    ASSERT_TRUE(ints.resize_in_place(second_block, 25, 100));
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 432, .is_block_occupied = true },
+            { .block_size = 424, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    ASSERT_TRUE(subject->shrink(second_block, 40));
+    // the second block follows the first one directly, a few bytes would make a gap no block fits into
+    ASSERT_FALSE(subject->shrink(first_block, 90));
+
+    expected_blocks_info =
+        {
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 776, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // rounded up past the arena end, the block takes the tail as it is
+    ASSERT_TRUE(subject->try_expand(second_block, 820));
+
+    expected_blocks_info =
+        {
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 856, .is_block_occupied = true }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    ints.deallocate(first_block, 25);
+    ints.deallocate(second_block, 205);
+}
+
+TEST(positiveTests, test7)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guarded batches go block by block";
+#endif
+
+    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(subject.get());
+    pp_allocator<int> ints(subject.get());
+
+    std::array<void *, 4> blocks;
+    ints.allocate_bytes_batch(blocks.data(), blocks.size(), 68);
+
+    std::array<void *, 2> released{ blocks[0], blocks[2] };
+    ints.deallocate_bytes_batch(released.data(), released.size(), 68);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 112, .is_block_occupied = false },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 112, .is_block_occupied = false },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 552, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // holes are filled first, the last block starts the big gap
+    std::array<void *, 3> batch;
+    ints.allocate_bytes_batch(batch.data(), batch.size(), 68);
+
+    expected_blocks_info =
+        {
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 112, .is_block_occupied = true },
+            { .block_size = 440, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(blocks_info->get_statistics().allocations_count, 7);
+
+    ints.deallocate_bytes_batch(batch.data(), batch.size(), 68);
+    ints.deallocate_bytes(blocks[1], 68);
+    ints.deallocate_bytes(blocks[3], 68);
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+}
+
+TEST(positiveTests, test8)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "the quarantine keeps freed blocks from the quick lists";
+#endif
+
+    auto *subject = new allocator_boundary_tags(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, false, false, true);
+    std::unique_ptr<smart_mem_resource> owner(subject);
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(subject);
+
+    auto *first_block = subject->allocate(100, 1);
+    auto *second_block = subject->allocate(100, 1);
+    auto *third_block = subject->allocate(100, 1);
+
+    // a freed block waits whole for the next request of its size
+    subject->deallocate(second_block, 1);
+    ASSERT_EQ(subject->allocate(100, 1), second_block);
+
+    subject->deallocate(third_block, 1);
+    subject->deallocate(second_block, 1);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 568, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // no gap fits, so parked blocks are merged back first
+    auto *fourth_block = subject->allocate(700, 1);
+
+    expected_blocks_info =
+        {
+            { .block_size = 144, .is_block_occupied = true },
+            { .block_size = 736, .is_block_occupied = true },
+            { .block_size = 120, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    subject->deallocate(first_block, 1);
+    subject->deallocate(fourth_block, 1);
+    subject->set_deferred_coalescing(false);
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(blocks_info->get_statistics().bytes_in_use, 0);
+}
+
+TEST(positiveTests, test9)
+{
+    class largest_gap final:
+        public allocator_test_utils::block_visitor
+    {
+
+    public:
+
+        size_t blocks = 0;
+        size_t largest = 0;
+
+        void reset() override
+        {
+            blocks = largest = 0;
+        }
+
+        void visit(allocator_test_utils::block_info const &block) override
+        {
+            ++blocks;
+            largest = block.is_block_occupied ? largest : std::max(largest, block.block_size);
+        }
+
+    };
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_boundary_tags(4000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+
+    auto *first_block = alloc->allocate(100, 1);
+    auto *second_block = alloc->allocate(100, 1);
+    alloc->deallocate(first_block, 1);
+
+    largest_gap gap;
+    blocks_info->visit_blocks(gap);
+    ASSERT_EQ(gap.blocks, 3);
+    ASSERT_EQ(gap.largest, 3712 - 2 * smart_mem_resource::guard_overhead(1));
+
+    std::atomic<bool> stop = false;
+    std::thread worker([&alloc, &stop]
+    {
+        std::mt19937 engine(7);
+        std::vector<void *> blocks;
+
+        while (!stop)
+        {
+            if (blocks.size() < 16 && engine() % 2 == 0)
+            {
+                blocks.push_back(alloc->allocate(engine() % 100 + 1, 1));
+            }
+            else if (!blocks.empty())
+            {
+                auto victim = blocks.begin() + engine() % blocks.size();
+                alloc->deallocate(*victim, 1);
+                blocks.erase(victim);
+            }
+        }
+
+        for (auto *block : blocks)
+        {
+            alloc->deallocate(block, 1);
+        }
+    });
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        size_t total = 0;
+        for (auto const &block : blocks_info->get_blocks_info())
+        {
+            total += block.block_size;
+        }
+        ASSERT_EQ(total, 4000);
+    }
+
+    stop = true;
+    worker.join();
+
+    alloc->deallocate(second_block, 1);
+    alloc->flush_quarantine();
+    blocks_info->visit_blocks(gap);
+    ASSERT_EQ(gap.blocks, 1);
+    ASSERT_EQ(gap.largest, 4000);
+}
+
+TEST(positiveTests, test10)
+{
+    std::vector<std::byte> space(allocator_guard_zones::total_size(40, 1));
+    auto *block = static_cast<std::byte *>(allocator_guard_zones::arm(space.data(), 40, 1));
+
+    ASSERT_EQ(allocator_guard_zones::raw(block), space.data());
+    ASSERT_EQ(block[0], std::byte{ allocator_guard_zones::fresh_fill });
+
+    // the whole block is usable, one byte past it is not
+    std::fill(block, block + 40, std::byte{ 1 });
+    block[40] = std::byte{ 2 };
+    ASSERT_THROW(allocator_guard_zones::retire(block), std::logic_error);
+    block[40] = std::byte{ allocator_guard_zones::red_zone_fill };
+
+    allocator_guard_zones::retire(block);
+    ASSERT_EQ(block[39], std::byte{ allocator_guard_zones::freed_fill });
+    ASSERT_THROW(allocator_guard_zones::retire(block), std::logic_error);
+
+    block[10] = std::byte{ 3 };
+    ASSERT_THROW(allocator_guard_zones::check_retired(block), std::logic_error);
+
+    // blocks leave the quarantine in the order they came
+    allocator_guard_zones::quarantine quarantine;
+    std::vector<std::pair<void *, size_t>> evicted;
+    for (size_t i = 0; i <= allocator_guard_zones::quarantine_blocks_limit; ++i)
+    {
+        quarantine.push(block, i, evicted);
+    }
+    ASSERT_EQ(evicted.size(), 1);
+    ASSERT_EQ(evicted.front().second, 0);
+    ASSERT_EQ(quarantine.drain().size(), allocator_guard_zones::quarantine_blocks_limit);
+
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_boundary_tags(4000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+
+    auto *overflowing = static_cast<char *>(alloc->allocate(10, 1));
+    overflowing[10] = 0;
+    ASSERT_THROW(alloc->deallocate(overflowing, 10, 1), std::logic_error);
+
+    auto *freed = alloc->allocate(10, 1);
+    alloc->deallocate(freed, 10, 1);
+    ASSERT_THROW(alloc->deallocate(freed, 10, 1), std::logic_error);
+    alloc->flush_quarantine();
+#endif
+}
+
 TEST(falsePositiveTests, test1)
 {
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -143,12 +578,13 @@ TEST(own, test1)
                                                             }
                                                     }));
 
-    std::unique_ptr<smart_mem_resource> alloc(new allocator_boundary_tags(4000, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_boundary_tags(4000 + smart_mem_resource::guard_overhead() * 3, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
 
     auto first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int)*  250));
     auto second_block = reinterpret_cast<char *>(alloc->allocate(sizeof(char) * 500));
     auto third_block = reinterpret_cast<double *>(alloc->allocate(sizeof(double *) * 250));
     alloc->deallocate(first_block, 1);
+    alloc->flush_quarantine();
     first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 245));
 
     std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(5000, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
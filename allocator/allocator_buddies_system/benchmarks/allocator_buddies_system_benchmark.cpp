@@ -0,0 +1,72 @@
+#include <allocator_buddies_system.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /** Keeps live_blocks blocks allocated and measures free + allocate pairs at random positions */
+    void run(
+        size_t live_blocks,
+        size_t operations_count,
+        allocator_with_fit_mode::fit_mode mode)
+    {
+        size_t const block_size = 40;
+        size_t space_power = 1;
+        while ((size_t(1) << space_power) < 2 * live_blocks * 64)
+        {
+            ++space_power;
+        }
+
+        std::unique_ptr<smart_mem_resource> allocator(new allocator_buddies_system(space_power, nullptr, nullptr, mode));
+        std::vector<void *> blocks;
+        blocks.reserve(live_blocks);
+
+        auto const fill_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < live_blocks; ++i)
+        {
+            blocks.push_back(allocator->allocate(block_size));
+        }
+        auto const fill_end = std::chrono::steady_clock::now();
+
+        std::mt19937_64 engine(live_blocks);
+
+        auto const churn_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operations_count; ++i)
+        {
+            auto &block = blocks[engine() % blocks.size()];
+            allocator->deallocate(block, block_size);
+            block = allocator->allocate(block_size);
+        }
+        auto const churn_end = std::chrono::steady_clock::now();
+
+        for (auto block : blocks)
+        {
+            allocator->deallocate(block, block_size);
+        }
+
+        auto const per_operation = [](auto start, auto end, size_t count)
+        {
+            return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(count);
+        };
+
+        std::cout << std::setw(10) << live_blocks
+                  << std::setw(16) << std::fixed << std::setprecision(1) << per_operation(fill_start, fill_end, live_blocks)
+                  << std::setw(20) << per_operation(churn_start, churn_end, operations_count) << std::endl;
+    }
+}
+
+int main()
+{
+    std::cout << std::setw(10) << "live" << std::setw(16) << "fill ns/alloc" << std::setw(20) << "churn ns/free+alloc" << std::endl;
+
+    for (size_t live_blocks : { 1'000, 10'000, 100'000 })
+    {
+        run(live_blocks, 10'000, allocator_with_fit_mode::fit_mode::first_fit);
+    }
+
+    return 0;
+}
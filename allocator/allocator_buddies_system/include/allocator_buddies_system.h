@@ -6,7 +6,12 @@
 #include <allocator_with_fit_mode.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <arena_chain.h>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <mutex>
+#include <optional>
 #include <cmath>
 
 namespace __detail
@@ -48,33 +53,69 @@ private:
         unsigned char size : 7;
     };
 
-    void *_trusted_memory;
+    /** Free blocks of every order form their own doubly linked list. The header keeps the first byte,
+     *  the previous block is packed next to it as an offset in minimal blocks plus one, zero meaning none
+     */
+    struct free_block_links
+    {
+        size_t : 8;
+        size_t prev : sizeof(size_t) * 8 - 8;
+        void *next;
+    };
 
-    /**
-     * TODO: You must improve it for alignment support
+    /** Lives at the beginning of trusted memory, blocks follow it.
+     *  Bit k of free_orders is set while free_lists[k] is not empty.
+     *  Statistics cover the own space only, extra arenas keep their own
      */
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        allocator_with_fit_mode::fit_mode mode;
+        unsigned char space_power;
+        std::mutex mutex{};
+        uint64_t free_orders = 0;
+        std::array<void *, sizeof(uint64_t) * 8> free_lists{};
+        std::optional<arena_chain> arenas{};
+        allocation_statistics statistics{};
+        size_t free_bytes = 0;
+        size_t free_blocks_count = 0;
+    };
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(unsigned char) + sizeof(std::mutex);
+    void *_trusted_memory;
 
-    static constexpr const size_t occupied_block_metadata_size = sizeof(block_metadata) + sizeof(void*);
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
+
+    /** Metadata is padded so that the pointer to trusted memory and the block itself stay aligned.
+     *  A block placed on a stricter boundary repeats this header right in front of itself
+     */
+    static constexpr const size_t occupied_block_metadata_size = align_up(sizeof(block_metadata), alignof(void*)) + sizeof(void*);
 
     static constexpr const size_t free_block_metadata_size = sizeof(block_metadata);
 
     static constexpr const size_t min_k = __detail::nearest_greater_k_of_2(occupied_block_metadata_size);
 
+    /** Largest space whose block offsets still fit into free_block_links::prev */
+    static constexpr const size_t max_k = sizeof(size_t) * 8 - 8 + min_k - 1;
+
+    static_assert(std::endian::native == std::endian::little, "free block links share the first word with the header");
+
+    static_assert(sizeof(free_block_links) <= (size_t(1) << min_k));
+
 public:
 
     explicit allocator_buddies_system(
             size_t space_size_power_of_two,
             std::pmr::memory_resource *parent_allocator = nullptr,
             logger *logger = nullptr,
-            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+            bool growable = false);
 
     allocator_buddies_system(
-        allocator_buddies_system const &other);
+        allocator_buddies_system const &other) = delete;
     
     allocator_buddies_system &operator=(
-        allocator_buddies_system const &other);
+        allocator_buddies_system const &other) = delete;
     
     allocator_buddies_system(
         allocator_buddies_system &&other) noexcept;
@@ -100,8 +141,29 @@ public:
 
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
 
+    allocation_statistics::snapshot get_statistics() const noexcept override;
+
 private:
 
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    void *allocate_inner(
+        size_t size,
+        size_t alignment);
+
+    /** nullptr when no free block fits, mutex must be held */
+    void *allocate_unlocked(
+        size_t size,
+        size_t alignment);
+
+    /** Another allocator of the same space size taken from the parent allocator */
+    arena_chain::arena make_arena() const;
     
     inline logger *get_logger() const override;
     
@@ -109,7 +171,36 @@ private:
 
     std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
 
-    /** TODO: Highly recommended for helper functions to return references */
+    allocator_metadata &get_metadata() const noexcept;
+
+    static block_metadata &get_block(void *block) noexcept;
+
+    static void *&get_block_trusted(void *block) noexcept;
+
+    static free_block_links &get_links(void *block) noexcept;
+
+    void *get_prev_free(void *block) const noexcept;
+
+    void set_prev_free(void *block, void *prev) const noexcept;
+
+    /** Puts a free block with its header already written at the head of the list of its order */
+    void free_list_push(void *block) noexcept;
+
+    void free_list_erase(void *block) noexcept;
+
+    /** Stores the free space shape into statistics, mutex must be held */
+    void publish_free_space() noexcept;
+
+    /** Where the user part of a block starts for the given alignment */
+    static std::byte *user_ptr(void *block, size_t alignment) noexcept;
+
+    void *blocks_begin() const noexcept;
+
+    void *blocks_end() const noexcept;
+
+    void *get_buddy(void *block) const noexcept;
+
+    void destroy() noexcept;
 
     class buddy_iterator
     {
@@ -1,137 +1,505 @@
-#include <not_implemented.h>
+#include <algorithm>
 #include <cstddef>
+#include <new>
 #include "../include/allocator_buddies_system.h"
 
 allocator_buddies_system::~allocator_buddies_system()
 {
-    throw not_implemented("allocator_buddies_system::~allocator_buddies_system()", "your code should be here...");
+    debug_with_guard([&] { return get_typename() + "::~allocator_buddies_system() called"; });
+    destroy();
 }
 
 allocator_buddies_system::allocator_buddies_system(
-    allocator_buddies_system &&other) noexcept
+    allocator_buddies_system &&other) noexcept : _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(allocator_buddies_system &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_buddies_system &allocator_buddies_system::operator=(
     allocator_buddies_system &&other) noexcept
 {
-    throw not_implemented("allocator_buddies_system &allocator_buddies_system::operator=(allocator_buddies_system &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
 }
 
 allocator_buddies_system::allocator_buddies_system(
         size_t space_size,
         std::pmr::memory_resource *parent_allocator,
         logger *logger,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode)
+        allocator_with_fit_mode::fit_mode allocate_fit_mode,
+        bool growable)
 {
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(size_t,std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < min_k || space_size > max_k)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_buddies_system: space size power is out of range");
+        }
+        throw std::logic_error("allocator_buddies_system: space size power is out of range");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size + (size_t(1) << space_size), default_alignment);
+
+    new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .mode = allocate_fit_mode,
+            .space_power = static_cast<unsigned char>(space_size)
+        };
+
+    auto &first = get_block(blocks_begin());
+    first.occupied = false;
+    first.size = static_cast<unsigned char>(space_size);
+    free_list_push(blocks_begin());
+    publish_free_space();
+
+    if (growable)
+    {
+        get_metadata().arenas.emplace();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::allocator_buddies_system(size_t, std::pmr::memory_resource *, logger *, fit_mode) finished"; });
 }
 
 [[nodiscard]] void *allocator_buddies_system::do_allocate_sm(
     size_t size)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_buddies_system::do_allocate_sm(size_t)", "your code should be here...");
+    return allocate_inner(size, 1);
 }
 
-void allocator_buddies_system::do_deallocate_sm(void *at)
+[[nodiscard]] void *allocator_buddies_system::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("void allocator_buddies_system::do_deallocate_sm(void *)", "your code should be here...");
+    return allocate_inner(size, alignment);
 }
 
-allocator_buddies_system::allocator_buddies_system(const allocator_buddies_system &other)
+void *allocator_buddies_system::allocate_inner(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(const allocator_buddies_system &other)", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") started"; });
+
+    void *user = get_metadata().arenas
+        ? get_metadata().arenas->allocate(size, alignment,
+            [this, size, alignment] { return allocate_unlocked(size, alignment); },
+            [this] { return make_arena(); })
+        : allocate_unlocked(size, alignment);
+
+    if (user == nullptr)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): no suitable free block"; });
+        throw std::bad_alloc();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") finished"; });
+
+    return user;
 }
 
-allocator_buddies_system &allocator_buddies_system::operator=(const allocator_buddies_system &other)
+void *allocator_buddies_system::allocate_unlocked(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("allocator_buddies_system &allocator_buddies_system::operator=(const allocator_buddies_system &other)", "your code should be here...");
+    auto const mode = get_metadata().mode;
+    size_t const space_power = get_metadata().space_power;
+
+    auto hosts = [size, alignment](void *block, size_t order)
+    {
+        auto *user = user_ptr(block, alignment);
+        auto *block_end = reinterpret_cast<std::byte *>(block) + (size_t(1) << order);
+        return user <= block_end && static_cast<size_t>(block_end - user) >= size;
+    };
+
+    // blocks are aligned to default_alignment only, so an order that hosts the request wherever the block lies
+    size_t const padding = alignment <= default_alignment ? occupied_block_metadata_size : occupied_block_metadata_size + alignment - default_alignment;
+    size_t const space_size = size_t(1) << space_power;
+    size_t const needed_order = size > space_size || padding > space_size - size
+        ? space_power + 1
+        : std::max(min_k, static_cast<size_t>(std::bit_width(size + padding - 1)));
+
+    // first, best and segregated fit take the smallest order that has a free block, worst fit the largest one
+    uint64_t const candidates = needed_order > space_power ? 0 : get_metadata().free_orders & ~((uint64_t(1) << needed_order) - 1);
+
+    if (candidates == 0)
+    {
+        return nullptr;
+    }
+
+    size_t found_order = mode == fit_mode::the_worst_fit
+        ? std::bit_width(candidates) - 1
+        : std::countr_zero(candidates);
+    void *found = get_metadata().free_lists[found_order];
+
+    free_list_erase(found);
+
+    // keep the half that can still host the request, the other one becomes a free buddy
+    while (found_order > min_k)
+    {
+        size_t const half_order = found_order - 1;
+        auto *upper = reinterpret_cast<std::byte *>(found) + (size_t(1) << half_order);
+
+        if (hosts(found, half_order))
+        {
+            get_block(upper) = { .occupied = false, .size = static_cast<unsigned char>(half_order) };
+            free_list_push(upper);
+        }
+        else if (hosts(upper, half_order))
+        {
+            get_block(found) = { .occupied = false, .size = static_cast<unsigned char>(half_order) };
+            free_list_push(found);
+            found = upper;
+        }
+        else
+        {
+            break;
+        }
+
+        found_order = half_order;
+    }
+
+    get_block(found) = { .occupied = true, .size = static_cast<unsigned char>(found_order) };
+    get_block_trusted(found) = _trusted_memory;
+
+    get_metadata().statistics.on_allocate(size_t(1) << found_order);
+    publish_free_space();
+
+    auto *user = user_ptr(found, alignment);
+    auto *header = user - occupied_block_metadata_size;
+    if (header != found)
+    {
+        get_block(header) = get_block(found);
+        get_block_trusted(header) = _trusted_memory;
+    }
+
+    return user;
+}
+
+void allocator_buddies_system::do_deallocate_sm(void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) started"; });
+
+    auto *header = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    if (get_metadata().arenas && (header < blocks_begin() || header >= blocks_end()) && get_metadata().arenas->deallocate(at))
+    {
+        debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+        return;
+    }
+
+    if (header < blocks_begin() || header >= blocks_end() ||
+        !get_block(header).occupied || get_block_trusted(header) != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_buddies_system: block does not belong to this allocator");
+    }
+
+    // an aligned block keeps a copy of its header right before the user part, the block itself starts on its order boundary
+    size_t order = get_block(header).size;
+    size_t const offset = header - reinterpret_cast<std::byte *>(blocks_begin());
+    void *block = reinterpret_cast<std::byte *>(blocks_begin()) + (offset & ~((size_t(1) << order) - 1));
+
+    get_block_trusted(header) = nullptr;
+    get_block(block).occupied = false;
+    get_metadata().statistics.on_deallocate(size_t(1) << order);
+
+    while (order < get_metadata().space_power)
+    {
+        void *buddy = get_buddy(block);
+
+        if (get_block(buddy).occupied || get_block(buddy).size != order)
+        {
+            break;
+        }
+
+        free_list_erase(buddy);
+        block = std::min(block, buddy);
+        ++order;
+        get_block(block) = { .occupied = false, .size = static_cast<unsigned char>(order) };
+    }
+
+    free_list_push(block);
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+}
+
+void allocator_buddies_system::do_deallocate_aligned_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
 }
 
 bool allocator_buddies_system::do_is_equal(const std::pmr::memory_resource &other) const noexcept
 {
-    throw not_implemented("bool allocator_buddies_system::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    auto p = dynamic_cast<const allocator_buddies_system*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
 }
 
 inline void allocator_buddies_system::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_buddies_system::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+    get_metadata().mode = mode;
+
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([mode](smart_mem_resource &arena)
+        {
+            dynamic_cast<allocator_with_fit_mode &>(arena).set_fit_mode(mode);
+        });
+    }
 }
 
 
 std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info() const noexcept", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+
+    auto res = get_blocks_info_inner();
+
+    // blocks of extra arenas follow the own ones, arena by arena
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([&res](smart_mem_resource &arena)
+        {
+            auto arena_blocks = dynamic_cast<allocator_test_utils &>(arena).get_blocks_info();
+            res.insert(res.end(), arena_blocks.begin(), arena_blocks.end());
+        });
+    }
+
+    return res;
+}
+
+allocation_statistics::snapshot allocator_buddies_system::get_statistics() const noexcept
+{
+    return get_metadata().statistics.get();
 }
 
 inline logger *allocator_buddies_system::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_buddies_system::get_logger() const", "your code should be here...");
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
 }
 
 inline std::string allocator_buddies_system::get_typename() const
 {
-    throw not_implemented("inline std::string allocator_buddies_system::get_typename() const", "your code should be here...");
+    return "allocator_buddies_system";
 }
 
 std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+    {
+        res.push_back({ .block_size = it.size(), .is_block_occupied = it.occupied() });
+    }
+
+    return res;
+}
+
+arena_chain::arena allocator_buddies_system::make_arena() const
+{
+    auto *created = new allocator_buddies_system(get_metadata().space_power, get_metadata().parent_allocator, nullptr, get_metadata().mode);
+
+    return { .resource = std::unique_ptr<smart_mem_resource>(created), .begin = created->blocks_begin(), .end = created->blocks_end() };
+}
+
+allocator_buddies_system::allocator_metadata &allocator_buddies_system::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_buddies_system::block_metadata &allocator_buddies_system::get_block(void *block) noexcept
+{
+    return *reinterpret_cast<block_metadata *>(block);
+}
+
+void *&allocator_buddies_system::get_block_trusted(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + occupied_block_metadata_size - sizeof(void*));
+}
+
+allocator_buddies_system::free_block_links &allocator_buddies_system::get_links(void *block) noexcept
+{
+    return *reinterpret_cast<free_block_links *>(block);
+}
+
+void *allocator_buddies_system::get_prev_free(void *block) const noexcept
+{
+    size_t const prev = get_links(block).prev;
+    return prev == 0 ? nullptr : reinterpret_cast<std::byte *>(blocks_begin()) + ((prev - 1) << min_k);
+}
+
+void allocator_buddies_system::set_prev_free(void *block, void *prev) const noexcept
+{
+    get_links(block).prev = prev == nullptr
+        ? 0
+        : ((reinterpret_cast<std::byte *>(prev) - reinterpret_cast<std::byte *>(blocks_begin())) >> min_k) + 1;
+}
+
+void allocator_buddies_system::free_list_push(void *block) noexcept
+{
+    size_t const order = get_block(block).size;
+    auto &head = get_metadata().free_lists[order];
+
+    set_prev_free(block, nullptr);
+    get_links(block).next = head;
+    if (head != nullptr)
+    {
+        set_prev_free(head, block);
+    }
+
+    head = block;
+    get_metadata().free_orders |= uint64_t(1) << order;
+    get_metadata().free_bytes += size_t(1) << order;
+    ++get_metadata().free_blocks_count;
+}
+
+void allocator_buddies_system::free_list_erase(void *block) noexcept
+{
+    size_t const order = get_block(block).size;
+    void *prev = get_prev_free(block);
+    void *next = get_links(block).next;
+
+    if (prev == nullptr)
+    {
+        get_metadata().free_lists[order] = next;
+    }
+    else
+    {
+        get_links(prev).next = next;
+    }
+
+    if (next != nullptr)
+    {
+        set_prev_free(next, prev);
+    }
+
+    if (get_metadata().free_lists[order] == nullptr)
+    {
+        get_metadata().free_orders &= ~(uint64_t(1) << order);
+    }
+
+    get_metadata().free_bytes -= size_t(1) << order;
+    --get_metadata().free_blocks_count;
+}
+
+void allocator_buddies_system::publish_free_space() noexcept
+{
+    auto &meta = get_metadata();
+    size_t const largest = meta.free_orders == 0 ? 0 : size_t(1) << (std::bit_width(meta.free_orders) - 1);
+
+    meta.statistics.set_free_space(meta.free_bytes, largest, meta.free_blocks_count);
+}
+
+std::byte *allocator_buddies_system::user_ptr(void *block, size_t alignment) noexcept
+{
+    return reinterpret_cast<std::byte *>(align_up(reinterpret_cast<std::byte *>(block) + occupied_block_metadata_size, alignment));
+}
+
+void *allocator_buddies_system::blocks_begin() const noexcept
+{
+    return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size;
+}
+
+void *allocator_buddies_system::blocks_end() const noexcept
+{
+    return reinterpret_cast<std::byte *>(blocks_begin()) + (size_t(1) << get_metadata().space_power);
+}
+
+void *allocator_buddies_system::get_buddy(void *block) const noexcept
+{
+    size_t const offset = reinterpret_cast<std::byte *>(block) - reinterpret_cast<std::byte *>(blocks_begin());
+    return reinterpret_cast<std::byte *>(blocks_begin()) + (offset ^ (size_t(1) << get_block(block).size));
+}
+
+void allocator_buddies_system::destroy() noexcept
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const total_size = allocator_metadata_size + (size_t(1) << get_metadata().space_power);
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, total_size, default_alignment);
+    _trusted_memory = nullptr;
 }
 
 allocator_buddies_system::buddy_iterator allocator_buddies_system::begin() const noexcept
 {
-    throw not_implemented("allocator_buddies_system::buddy_iterator allocator_buddies_system::begin() const noexcept", "your code should be here...");
+    return { blocks_begin() };
 }
 
 allocator_buddies_system::buddy_iterator allocator_buddies_system::end() const noexcept
 {
-    throw not_implemented("allocator_buddies_system::buddy_iterator allocator_buddies_system::end() const noexcept", "your code should be here...");
+    return { blocks_end() };
 }
 
 bool allocator_buddies_system::buddy_iterator::operator==(const allocator_buddies_system::buddy_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_buddies_system::buddy_iterator::operator==(const allocator_buddies_system::buddy_iterator &) const noexcept", "your code should be here...");
+    return _block == other._block;
 }
 
 bool allocator_buddies_system::buddy_iterator::operator!=(const allocator_buddies_system::buddy_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_buddies_system::buddy_iterator::operator!=(const allocator_buddies_system::buddy_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_buddies_system::buddy_iterator &allocator_buddies_system::buddy_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_buddies_system::buddy_iterator &allocator_buddies_system::buddy_iterator::operator++() & noexcept", "your code should be here...");
+    _block = reinterpret_cast<std::byte *>(_block) + size();
+    return *this;
 }
 
-allocator_buddies_system::buddy_iterator allocator_buddies_system::buddy_iterator::operator++(int n)
+allocator_buddies_system::buddy_iterator allocator_buddies_system::buddy_iterator::operator++(int)
 {
-    throw not_implemented("allocator_buddies_system::buddy_iterator allocator_buddies_system::buddy_iterator::operator++(int)", "your code should be here...");
+    auto tmp = *this;
+    ++*this;
+    return tmp;
 }
 
 size_t allocator_buddies_system::buddy_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_buddies_system::buddy_iterator::size() const noexcept", "your code should be here...");
+    return size_t(1) << get_block(_block).size;
 }
 
 bool allocator_buddies_system::buddy_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_buddies_system::buddy_iterator::occupied() const noexcept", "your code should be here...");
+    return get_block(_block).occupied;
 }
 
 void *allocator_buddies_system::buddy_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_buddies_system::buddy_iterator::operator*() const noexcept", "your code should be here...");
+    return _block;
 }
 
-allocator_buddies_system::buddy_iterator::buddy_iterator(void *start)
-{
-    throw not_implemented("allocator_buddies_system::buddy_iterator::buddy_iterator(void *)", "your code should be here...");
-}
+allocator_buddies_system::buddy_iterator::buddy_iterator(void *start) : _block(start) {}
 
-allocator_buddies_system::buddy_iterator::buddy_iterator()
-{
-    throw not_implemented("allocator_buddies_system::buddy_iterator::buddy_iterator()", "your code should be here...");
-}
+allocator_buddies_system::buddy_iterator::buddy_iterator() : _block(nullptr) {}
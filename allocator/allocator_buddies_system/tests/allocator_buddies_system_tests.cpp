@@ -54,6 +54,10 @@ TEST(positiveTests, test1)
 
 TEST(positiveTests, test23)
 {
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to bigger buddies";
+#endif
+
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
         {
             {
@@ -84,6 +88,10 @@ TEST(positiveTests, test23)
 
 TEST(positiveTests, test3)
 {
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to bigger buddies";
+#endif
+
     std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_buddies_system(8, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
     
     void *first_block = allocator_instance->allocate(sizeof(unsigned char) * 0);
@@ -100,6 +108,142 @@ TEST(positiveTests, test3)
     allocator_instance->deallocate(second_block, 1);
 }
 
+TEST(positiveTests, test4)
+{
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_buddies_system(12, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 10);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 100, 64);
+    void *third_block = allocator_instance->allocate(sizeof(char) * 40, 256);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 256, 0);
+
+    allocator_instance->deallocate(second_block, 100, 64);
+    allocator_instance->deallocate(first_block, 10);
+    allocator_instance->deallocate(third_block, 40, 256);
+    allocator_instance->flush_quarantine();
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 1 << 12);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+}
+
+TEST(positiveTests, test5)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to bigger buddies";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_buddies_system(10, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit));
+    auto *fit_mode_subject = dynamic_cast<allocator_with_fit_mode *>(allocator_instance.get());
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 40);
+    fit_mode_subject->set_fit_mode(allocator_with_fit_mode::fit_mode::the_worst_fit);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 40);
+    fit_mode_subject->set_fit_mode(allocator_with_fit_mode::fit_mode::the_best_fit);
+    void *third_block = allocator_instance->allocate(sizeof(char) * 40);
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    std::vector<allocator_test_utils::block_info> expected_blocks_state
+        {
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 256, .is_block_occupied = false },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 256, .is_block_occupied = false }
+        };
+
+    ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
+    for (int i = 0; i < actual_blocks_state.size(); i++)
+    {
+        ASSERT_EQ(actual_blocks_state[i], expected_blocks_state[i]);
+    }
+
+    allocator_instance->deallocate(second_block, 40);
+    allocator_instance->deallocate(first_block, 40);
+    allocator_instance->deallocate(third_block, 40);
+
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 1 << 10);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+}
+
+TEST(positiveTests, test6)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guarded blocks outgrow the arenas";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_buddies_system(8, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, true));
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 200);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 200);
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    std::vector<allocator_test_utils::block_info> expected_blocks_state
+        {
+            { .block_size = 256, .is_block_occupied = true },
+            { .block_size = 256, .is_block_occupied = true }
+        };
+    ASSERT_EQ(actual_blocks_state, expected_blocks_state);
+
+    allocator_instance->deallocate(first_block, 200);
+    allocator_instance->deallocate(second_block, 200);
+    ASSERT_THROW(allocator_instance->allocate(sizeof(char) * 300), std::bad_alloc);
+
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    expected_blocks_state =
+        {
+            { .block_size = 256, .is_block_occupied = false },
+            { .block_size = 256, .is_block_occupied = false }
+        };
+    ASSERT_EQ(actual_blocks_state, expected_blocks_state);
+}
+
+TEST(positiveTests, test7)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones change every statistic";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_buddies_system(10, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *stats = dynamic_cast<allocator_test_utils *>(allocator_instance.get());
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 40);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 100);
+
+    auto snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 192);
+    ASSERT_EQ(snapshot.free_bytes, 832);
+    ASSERT_EQ(snapshot.largest_free_block, 512);
+    ASSERT_EQ(snapshot.free_blocks_count, 3);
+
+    allocator_instance->deallocate(first_block, 40);
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(char) * 1000)), std::bad_alloc);
+
+    snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 128);
+    ASSERT_EQ(snapshot.free_blocks_count, 3);
+    ASSERT_EQ(snapshot.failed_allocations_count, 1);
+    ASSERT_DOUBLE_EQ(snapshot.external_fragmentation(), 1.0 - 512.0 / 896.0);
+
+    allocator_instance->deallocate(second_block, 100);
+
+    snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 0);
+    ASSERT_EQ(snapshot.peak_bytes_in_use, 192);
+    ASSERT_EQ(snapshot.allocations_count, 2);
+    ASSERT_EQ(snapshot.deallocations_count, 2);
+    ASSERT_EQ(snapshot.largest_free_block, 1024);
+    ASSERT_EQ(snapshot.free_blocks_count, 1);
+}
+
 TEST(positiveTests, test53)
 {
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -130,7 +274,9 @@ TEST(positiveTests, test53)
                                                             }
                                                     }));
 
-    std::unique_ptr<smart_mem_resource> alloc(new allocator_buddies_system(12, nullptr, logger_instance.get(),
+    // guard zones push every block into the next buddy size
+    size_t const space_power = smart_mem_resource::guard_overhead() == 0 ? 12 : 13;
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_buddies_system(space_power, nullptr, logger_instance.get(),
                                                                allocator_with_fit_mode::fit_mode::first_fit));
 
     auto first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 250));
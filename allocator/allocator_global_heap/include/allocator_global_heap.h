@@ -5,8 +5,13 @@
 #include <logger.h>
 #include <logger_guardant.h>
 #include <pp_allocator.h>
+#include <thread_local_cache.h>
 #include <typename_holder.h>
 
+/** Default resource over ::operator new. Blocks of up to thread_local_cache's largest class are rounded up
+ *  to their class and kept per thread after free, so small objects churn without reaching the global heap.
+ *  The cache is shared by every instance, as any instance frees blocks of another
+ */
 class allocator_global_heap final:
     private allocator_dbg_helper,
     public smart_mem_resource,
@@ -20,6 +25,9 @@ private:
 
     static constexpr const size_t size_t_size = sizeof(size_t);
 
+    /** Size header is padded so user pointers keep fundamental alignment */
+    static constexpr const size_t block_metadata_size = align_up(size_t_size, default_alignment);
+
 public:
     
     explicit allocator_global_heap(
@@ -49,6 +57,28 @@ public:
 
     bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
 
+private:
+
+    /** Extended alignments are served by aligned ::operator new, no size header is stored in front of such blocks */
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+private:
+
+    static size_t block_size(
+        void *at) noexcept;
+
+    /** Gives a block with a size header back to ::operator delete */
+    static void release(
+        void *at) noexcept;
+
+    static thread_local_cache &shared_cache();
+
 private:
     
     inline logger *get_logger() const override {
@@ -1,4 +1,7 @@
+#include <limits>
+#include <new>
 #include <not_implemented.h>
+#include <vector>
 #include "../include/allocator_global_heap.h"
 
 allocator_global_heap::allocator_global_heap(logger *logger): _logger(logger)
@@ -11,55 +14,108 @@ allocator_global_heap::allocator_global_heap(logger *logger): _logger(logger)
 {
     if (size == 0) return nullptr;
 
-    if (_logger) {
-        _logger->debug("do_allocate_sm" + std::to_string(size) + " bytes");
-        _logger->trace("do_allocate_sm" + std::to_string(size) + " bytes");
+    if (_logger) _logger->log_deferred(logger::severity::trace, [size] { return "do_allocate_sm " + std::to_string(size) + " bytes"; });
+
+    size_t const size_class = thread_local_cache::size_class(size);
+
+    if (size_class != thread_local_cache::size_classes_count) {
+        if (void *cached = shared_cache().pop(size_class); cached != nullptr) {
+            return cached;
+        }
+
+        // small blocks are rounded up to their class, so any block of the class can serve the next request
+        size = thread_local_cache::class_size(size_class);
     }
 
-    size_t total_size = size + sizeof(size_t);
-    void* raw_ptr = ::operator new(total_size);
-    if (raw_ptr == nullptr) {
+    if (size > std::numeric_limits<size_t>::max() - block_metadata_size) {
         if (_logger) _logger->error("bad alloc error occured");
         throw std::bad_alloc();
     }
-    auto metadata = static_cast<size_t*>(raw_ptr);
-    *metadata = size;
-    void* user_ptr = static_cast<void*>(metadata + 1);
 
-    if (_logger) {
-        _logger->debug("do_allocate_sm" + std::to_string(size) + " bytes");
-        _logger->trace("do_allocate_sm" + std::to_string(size) + " bytes");
-    }
+    void* raw_ptr = ::operator new(size + block_metadata_size);
+    *static_cast<size_t*>(raw_ptr) = size;
 
-    return user_ptr;
+    return static_cast<std::byte*>(raw_ptr) + block_metadata_size;
 }
 
 void allocator_global_heap::do_deallocate_sm(
     void *at)
 {
-    if (_logger) {
-        _logger->debug("do_deallocate_sm called");
-        _logger->trace("do_deallocate_sm called");
-    }
+    if (_logger) _logger->log_deferred(logger::severity::trace, [] { return std::string("do_deallocate_sm called"); });
 
     if (at == nullptr) {
-        if (_logger) {
-            _logger->error("nullptr passed to do_deallocate_sm function");
-            _logger->trace("do_deallocate_sm(nullptr)");
-            _logger->debug("do_deallocate_sm(nullptr)");
-        }
+        if (_logger) _logger->error("nullptr passed to do_deallocate_sm function");
         return;
     }
 
-    auto* ptr = static_cast<std::byte*>(at);
-    ptr -= sizeof(size_t);
-    size_t size_to_dealloc = *reinterpret_cast<size_t*>(ptr);
-    void* user_mem = static_cast<void*>(ptr);
-    ::operator delete(user_mem);
-    if (_logger) {
-        _logger->debug("do_deallocate_sm deallocated " + std::to_string(size_to_dealloc) + " bytes");
-        _logger->trace("do_deallocate_sm deallocated " + std::to_string(size_to_dealloc) + " bytes");
+    size_t const size_class = thread_local_cache::size_class(block_size(at));
+
+    if (size_class == thread_local_cache::size_classes_count) {
+        release(at);
+        return;
     }
+
+    void *overflow[thread_local_cache::batch_size];
+    size_t const released = shared_cache().push(size_class, at, overflow);
+
+    if (released == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < released; ++i) {
+        release(overflow[i]);
+    }
+
+    // a full stock is the rare moment to also give back blocks left behind by finished threads
+    std::vector<void *> parked;
+    shared_cache().collect(parked, false);
+    for (void *block : parked) {
+        release(block);
+    }
+}
+
+size_t allocator_global_heap::block_size(
+    void *at) noexcept
+{
+    return *reinterpret_cast<size_t*>(static_cast<std::byte*>(at) - block_metadata_size);
+}
+
+void allocator_global_heap::release(
+    void *at) noexcept
+{
+    ::operator delete(static_cast<std::byte*>(at) - block_metadata_size);
+}
+
+thread_local_cache &allocator_global_heap::shared_cache()
+{
+    // never destroyed: threads finishing after static destruction still park their blocks into it
+    static auto *cache = new thread_local_cache;
+    return *cache;
+}
+
+[[nodiscard]] void *allocator_global_heap::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    if (size == 0) return nullptr;
+
+    if (_logger) _logger->log_deferred(logger::severity::trace, [size, alignment] { return "do_allocate_aligned_sm " + std::to_string(size) + " bytes aligned to " + std::to_string(alignment); });
+
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+void allocator_global_heap::do_deallocate_aligned_sm(
+    void *at,
+    size_t alignment)
+{
+    if (_logger) _logger->log_deferred(logger::severity::trace, [] { return std::string("do_deallocate_aligned_sm called"); });
+
+    if (at == nullptr) {
+        if (_logger) _logger->error("nullptr passed to do_deallocate_aligned_sm function");
+        return;
+    }
+
+    ::operator delete(at, std::align_val_t(alignment));
 }
 
 allocator_global_heap::~allocator_global_heap()
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <allocator_global_heap.h>
+#include <allocation_trace.h>
+#include <cstring>
+#include <sstream>
+#include <thread>
 #include <client_logger_builder.h>
 
 TEST(allocatorGlobalHeapTests, test1)
@@ -83,6 +87,82 @@ TEST(allocatorGlobalHeapTests, test4)
     allocator_instance->deallocate(second_block, 1);
 }
 
+TEST(allocatorGlobalHeapTests, test5)
+{
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_global_heap);
+
+    auto first_block = allocator_instance->allocate(sizeof(char) * 10);
+    auto second_block = allocator_instance->allocate(sizeof(char) * 100, 64);
+    auto third_block = allocator_instance->allocate(sizeof(char) * 40, 4096);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(first_block) % alignof(std::max_align_t), 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 4096, 0);
+
+    allocator_instance->deallocate(first_block, 10);
+    allocator_instance->deallocate(second_block, 100, 64);
+    allocator_instance->deallocate(third_block, 40, 4096);
+}
+
+TEST(allocatorGlobalHeapTests, test6)
+{
+    allocator_global_heap allocator_instance;
+    std::stringstream trace_stream;
+
+    {
+        allocation_trace_recorder recorder(trace_stream, &allocator_instance);
+
+        auto first_block = recorder.allocate(sizeof(char) * 10);
+        auto second_block = recorder.allocate(sizeof(char) * 100, 64);
+        recorder.deallocate(first_block, 10);
+        std::thread([&recorder, second_block] { recorder.deallocate(second_block, 100, 64); }).join();
+    }
+
+    auto trace = allocation_trace::read(trace_stream);
+
+    ASSERT_EQ(trace.events.size(), 4);
+    ASSERT_EQ(trace.events[0].kind, allocation_trace::event_kind::allocate);
+    ASSERT_EQ(trace.events[0].size, 10);
+    ASSERT_EQ(trace.events[1].id, 1);
+    ASSERT_EQ(trace.events[1].alignment_power, 6);
+    ASSERT_EQ(trace.events[2].kind, allocation_trace::event_kind::deallocate);
+    ASSERT_EQ(trace.events[2].id, 0);
+    ASSERT_EQ(trace.events[3].id, 1);
+    ASSERT_EQ(trace.events[3].thread, 1);
+
+    std::stringstream broken("not a trace");
+    ASSERT_THROW(allocation_trace::read(broken), std::runtime_error);
+}
+
+TEST(allocatorGlobalHeapTests, test7)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "the quarantine keeps freed blocks from the thread stock";
+#endif
+
+    allocator_global_heap first_instance;
+    allocator_global_heap second_instance;
+
+    auto small_block = first_instance.allocate(sizeof(char) * 20);
+    std::memset(small_block, 0x5A, 20);
+    second_instance.deallocate(small_block, 20);
+
+    // the freed block sits in the calling thread's stock and serves any request of its size class
+    auto reused_block = first_instance.allocate(sizeof(char) * 30);
+    ASSERT_EQ(reused_block, small_block);
+
+    void *other_thread_block = nullptr;
+    std::thread([&second_instance, &other_thread_block] { other_thread_block = second_instance.allocate(sizeof(char) * 30); }).join();
+    ASSERT_NE(other_thread_block, reused_block);
+
+    auto large_block = first_instance.allocate(sizeof(char) * 4096);
+    std::memset(large_block, 0x5A, 4096);
+
+    first_instance.deallocate(other_thread_block, 30);
+    first_instance.deallocate(reused_block, 30);
+    second_instance.deallocate(large_block, 4096);
+}
+
 int main(
     int argc,
     char *argv[])
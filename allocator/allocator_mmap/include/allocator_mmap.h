@@ -0,0 +1,107 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MMAP_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MMAP_H
+
+#include <logger_guardant.h>
+#include <typename_holder.h>
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+
+/** Serves big regions, such as trusted memory of the other allocators, from one reserved range of address space.
+ *  Pages are committed as the highest occupied address grows and a fully free tail of the range is handed back
+ *  to the system, so the resource fits as parent_allocator for arenas of several gigabytes
+ */
+class allocator_mmap final:
+    public std::pmr::memory_resource,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+
+    static constexpr const size_t huge_page_size = size_t(1) << 21;
+
+    logger *_logger;
+
+    std::byte *_base;
+
+    size_t _reserved_size;
+
+    size_t _committed_size;
+
+    /** System page size, every region is rounded up to it */
+    size_t _page_size;
+
+    /** Step the committed part grows and shrinks by, a huge page when they are requested */
+    size_t _commit_granularity;
+
+    bool _populate;
+
+    mutable std::mutex _mutex;
+
+    /** Free ranges keyed by their beginning, neighbours are always merged */
+    std::map<std::byte *, size_t> _free_ranges;
+
+    /** Handed out ranges keyed by their beginning, a region is given back only when it matches one of them */
+    std::map<std::byte *, size_t> _occupied_ranges;
+
+public:
+
+    /** use_huge_pages asks for transparent huge pages on the whole range,
+     *  populate prefaults pages as soon as they are committed
+     */
+    explicit allocator_mmap(
+        size_t reserve_size,
+        logger *logger = nullptr,
+        bool use_huge_pages = false,
+        bool populate = false);
+
+    allocator_mmap(
+        allocator_mmap const &other) = delete;
+
+    allocator_mmap &operator=(
+        allocator_mmap const &other) = delete;
+
+    allocator_mmap(
+        allocator_mmap &&other) = delete;
+
+    allocator_mmap &operator=(
+        allocator_mmap &&other) = delete;
+
+    ~allocator_mmap() override;
+
+public:
+
+    size_t reserved_size() const noexcept;
+
+    size_t committed_size() const;
+
+private:
+
+    void *do_allocate(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate(
+        void *at,
+        size_t size,
+        size_t alignment) override;
+
+    bool do_is_equal(
+        std::pmr::memory_resource const &other) const noexcept override;
+
+    /** Makes the range readable and writable up to end_offset, mutex must be held */
+    void commit(
+        size_t end_offset);
+
+    /** Gives pages of a free range that reaches the end of the reservation back to the system, mutex must be held */
+    void decommit_tail() noexcept;
+
+    inline logger *get_logger() const override;
+
+    inline std::string get_typename() const override;
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MMAP_H
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "../include/allocator_mmap.h"
+
+namespace
+{
+    constexpr size_t round_up(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+allocator_mmap::allocator_mmap(
+    size_t reserve_size,
+    logger *logger,
+    bool use_huge_pages,
+    bool populate) :
+        _logger(logger),
+        _base(nullptr),
+        _reserved_size(0),
+        _committed_size(0),
+        _page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE))),
+        _commit_granularity(use_huge_pages ? huge_page_size : _page_size),
+        _populate(populate)
+{
+    if (reserve_size == 0)
+    {
+        error_with_guard("allocator_mmap: reserved size must not be zero");
+        throw std::logic_error("allocator_mmap: reserved size must not be zero");
+    }
+
+    _reserved_size = round_up(reserve_size, _commit_granularity);
+
+    // huge pages need a range aligned to their size, the extra space around it is unmapped right away
+    size_t const mapping_size = _reserved_size + (use_huge_pages ? huge_page_size : 0);
+    void *mapping = mmap(nullptr, mapping_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        error_with_guard([&] { return get_typename() + "::allocator_mmap(size_t, logger *, bool, bool): address space reservation failed"; });
+        throw std::bad_alloc();
+    }
+
+    _base = reinterpret_cast<std::byte *>(round_up(reinterpret_cast<uintptr_t>(mapping), _commit_granularity));
+
+    if (use_huge_pages)
+    {
+        auto *mapping_end = reinterpret_cast<std::byte *>(mapping) + mapping_size;
+
+        if (_base != mapping)
+        {
+            munmap(mapping, _base - reinterpret_cast<std::byte *>(mapping));
+        }
+        if (_base + _reserved_size != mapping_end)
+        {
+            munmap(_base + _reserved_size, mapping_end - (_base + _reserved_size));
+        }
+
+        if (madvise(_base, _reserved_size, MADV_HUGEPAGE) != 0)
+        {
+            warning_with_guard([&] { return get_typename() + "::allocator_mmap(size_t, logger *, bool, bool): transparent huge pages are not available"; });
+        }
+    }
+
+    _free_ranges.emplace(_base, _reserved_size);
+
+    debug_with_guard([&] { return get_typename() + "::allocator_mmap(size_t, logger *, bool, bool) finished"; });
+}
+
+allocator_mmap::~allocator_mmap()
+{
+    debug_with_guard([&] { return get_typename() + "::~allocator_mmap() called"; });
+    munmap(_base, _reserved_size);
+}
+
+size_t allocator_mmap::reserved_size() const noexcept
+{
+    return _reserved_size;
+}
+
+size_t allocator_mmap::committed_size() const
+{
+    std::lock_guard lock(_mutex);
+    return _committed_size;
+}
+
+void *allocator_mmap::do_allocate(
+    size_t size,
+    size_t alignment)
+{
+    std::lock_guard lock(_mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate(" + std::to_string(size) + ") started"; });
+
+    auto found = _free_ranges.end();
+    std::byte *begin = nullptr;
+
+    if (size <= _reserved_size)
+    {
+        size = round_up(std::max<size_t>(size, 1), _page_size);
+
+        found = std::find_if(_free_ranges.begin(), _free_ranges.end(), [&begin, size, alignment](auto const &range)
+        {
+            begin = reinterpret_cast<std::byte *>(round_up(reinterpret_cast<uintptr_t>(range.first), alignment));
+            return begin <= range.first + range.second && static_cast<size_t>(range.first + range.second - begin) >= size;
+        });
+    }
+
+    if (found == _free_ranges.end())
+    {
+        error_with_guard([&] { return get_typename() + "::do_allocate(" + std::to_string(size) + "): reserved range is exhausted"; });
+        throw std::bad_alloc();
+    }
+
+    commit(begin + size - _base);
+
+    auto [range_begin, range_size] = *found;
+    _free_ranges.erase(found);
+
+    if (begin != range_begin)
+    {
+        _free_ranges.emplace(range_begin, begin - range_begin);
+    }
+    if (begin + size != range_begin + range_size)
+    {
+        _free_ranges.emplace(begin + size, range_begin + range_size - (begin + size));
+    }
+
+    _occupied_ranges.emplace(begin, size);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate(" + std::to_string(size) + ") finished"; });
+
+    return begin;
+}
+
+void allocator_mmap::do_deallocate(
+    void *at,
+    size_t size,
+    size_t)
+{
+    std::lock_guard lock(_mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate(void *, " + std::to_string(size) + ") started"; });
+
+    auto *begin = reinterpret_cast<std::byte *>(at);
+    size = round_up(std::max<size_t>(size, 1), _page_size);
+
+    if (begin < _base || begin + size > _base + _reserved_size)
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate(void *, " + std::to_string(size) + "): region does not belong to this resource"; });
+        throw std::logic_error("allocator_mmap: region does not belong to this resource");
+    }
+
+    // a double free or a range that was never handed out as a whole would corrupt the free ranges
+    auto occupied = _occupied_ranges.find(begin);
+    if (occupied == _occupied_ranges.end() || occupied->second != size)
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate(void *, " + std::to_string(size) + "): region is not occupied"; });
+        throw std::logic_error("allocator_mmap: region is not occupied");
+    }
+
+    _occupied_ranges.erase(occupied);
+
+    auto inserted = _free_ranges.emplace(begin, size).first;
+
+    auto next = std::next(inserted);
+    if (next != _free_ranges.end() && inserted->first + inserted->second == next->first)
+    {
+        inserted->second += next->second;
+        _free_ranges.erase(next);
+    }
+
+    if (inserted != _free_ranges.begin())
+    {
+        auto prev = std::prev(inserted);
+        if (prev->first + prev->second == inserted->first)
+        {
+            prev->second += inserted->second;
+            _free_ranges.erase(inserted);
+        }
+    }
+
+    decommit_tail();
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate(void *, " + std::to_string(size) + ") finished"; });
+}
+
+bool allocator_mmap::do_is_equal(
+    std::pmr::memory_resource const &other) const noexcept
+{
+    return this == &other;
+}
+
+void allocator_mmap::commit(
+    size_t end_offset)
+{
+    if (end_offset <= _committed_size)
+    {
+        return;
+    }
+
+    size_t const committed_size = std::min(round_up(end_offset, _commit_granularity), _reserved_size);
+    std::byte *const begin = _base + _committed_size;
+    size_t const size = committed_size - _committed_size;
+
+    if (mprotect(begin, size, PROT_READ | PROT_WRITE) != 0)
+    {
+        error_with_guard([&] { return get_typename() + "::commit(size_t): pages cannot be committed"; });
+        throw std::bad_alloc();
+    }
+
+    if (_populate)
+    {
+#ifdef MADV_POPULATE_WRITE
+        if (madvise(begin, size, MADV_POPULATE_WRITE) != 0)
+#endif
+        {
+            // kernels without MADV_POPULATE_WRITE get the pages faulted in by hand
+            for (size_t offset = 0; offset < size; offset += _page_size)
+            {
+                *reinterpret_cast<volatile std::byte *>(begin + offset) = std::byte{ 0 };
+            }
+        }
+    }
+
+    _committed_size = committed_size;
+}
+
+void allocator_mmap::decommit_tail() noexcept
+{
+    if (_free_ranges.empty())
+    {
+        return;
+    }
+
+    auto const &[last_begin, last_size] = *std::prev(_free_ranges.end());
+
+    if (last_begin + last_size != _base + _reserved_size)
+    {
+        return;
+    }
+
+    size_t const tail_offset = round_up(last_begin - _base, _commit_granularity);
+
+    if (tail_offset >= _committed_size)
+    {
+        return;
+    }
+
+    madvise(_base + tail_offset, _committed_size - tail_offset, MADV_DONTNEED);
+    mprotect(_base + tail_offset, _committed_size - tail_offset, PROT_NONE);
+    _committed_size = tail_offset;
+}
+
+inline logger *allocator_mmap::get_logger() const
+{
+    return _logger;
+}
+
+inline std::string allocator_mmap::get_typename() const
+{
+    return "allocator_mmap";
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <allocator_mmap.h>
+#include <allocator_sorted_list.h>
+#include <cstring>
+#include <unistd.h>
+
+TEST(allocatorMmapPositiveTests, test1)
+{
+    allocator_mmap parent(size_t(1) << 30);
+
+    ASSERT_EQ(parent.committed_size(), 0);
+
+    {
+        std::unique_ptr<smart_mem_resource> first_allocator(new allocator_sorted_list(1 << 20, &parent));
+        std::unique_ptr<smart_mem_resource> second_allocator(new allocator_sorted_list(1 << 20, &parent));
+
+        auto *first_block = reinterpret_cast<char *>(first_allocator->allocate(sizeof(char) * 1000));
+        auto *second_block = reinterpret_cast<char *>(second_allocator->allocate(sizeof(char) * 1000));
+        std::memset(first_block, 1, 1000);
+        std::memset(second_block, 2, 1000);
+
+        // only pages the arenas occupy are committed, the rest of the gigabyte stays reserved
+        ASSERT_GE(parent.committed_size(), 2 << 20);
+        ASSERT_LT(parent.committed_size(), 3 << 20);
+
+        first_allocator->deallocate(first_block, 1000);
+        second_allocator->deallocate(second_block, 1000);
+    }
+
+    ASSERT_EQ(parent.committed_size(), 0);
+}
+
+TEST(allocatorMmapPositiveTests, test2)
+{
+    allocator_mmap parent(size_t(16) << 20, nullptr, true, true);
+
+    void *first_region = parent.allocate(3 << 20);
+    void *second_region = parent.allocate(100, 1 << 16);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_region) % (1 << 16), 0);
+    std::memset(first_region, 1, 3 << 20);
+    std::memset(second_region, 2, 100);
+
+    // the tail is given back only once nothing after it is occupied
+    parent.deallocate(first_region, 3 << 20);
+    ASSERT_GT(parent.committed_size(), 0);
+
+    parent.deallocate(second_region, 100, 1 << 16);
+    ASSERT_EQ(parent.committed_size(), 0);
+
+    ASSERT_THROW(static_cast<void>(parent.allocate(size_t(17) << 20)), std::bad_alloc);
+}
+
+TEST(allocatorMmapNegativeTests, test1)
+{
+    allocator_mmap parent(1 << 20);
+    int outside;
+
+    ASSERT_THROW(parent.deallocate(&outside, sizeof(outside)), std::logic_error);
+
+    size_t const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto *region = reinterpret_cast<std::byte *>(parent.allocate(page_size * 3));
+
+    // parts of a region, a bigger range and a second free are all refused
+    ASSERT_THROW(parent.deallocate(region + page_size, page_size), std::logic_error);
+    ASSERT_THROW(parent.deallocate(region, page_size * 4), std::logic_error);
+
+    parent.deallocate(region, page_size * 3);
+    ASSERT_THROW(parent.deallocate(region, page_size * 3), std::logic_error);
+    ASSERT_EQ(parent.committed_size(), 0);
+}
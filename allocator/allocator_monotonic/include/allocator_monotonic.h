@@ -0,0 +1,173 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MONOTONIC_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MONOTONIC_H
+
+#include <pp_allocator.h>
+#include <allocator_test_utils.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+#include <mutex>
+
+/** Hands out memory by moving a pointer through chunks taken from the parent allocator, deallocation does nothing.
+ *  Everything goes away at once with release(), or everything allocated after a checkpoint with rollback().
+ *  Chunks grow twice each time, the first one lives in trusted memory and is kept until destruction
+ */
+class allocator_monotonic final:
+    public smart_mem_resource,
+    public allocator_test_utils,
+    private logger_guardant,
+    private typename_holder
+{
+
+public:
+
+    /** Position of the allocator at some moment, valid while no rollback goes past it */
+    struct checkpoint
+    {
+        void *chunk;
+        std::byte *position;
+    };
+
+    /** Rolls the allocator back to where it was when the scope began, scopes nest like phases do */
+    class scope final
+    {
+        allocator_monotonic &_allocator;
+        checkpoint _checkpoint;
+
+    public:
+
+        explicit scope(
+            allocator_monotonic &allocator);
+
+        scope(
+            scope const &other) = delete;
+
+        scope &operator=(
+            scope const &other) = delete;
+
+        ~scope() noexcept;
+    };
+
+private:
+
+    /** Lives at the beginning of trusted memory, the first chunk follows it.
+     *  Bytes in use count alignment padding too, free space is the rest of the current chunk
+     *  plus the tails left in older chunks, which are summed up again only when a chunk is added or dropped
+     */
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        size_t next_chunk_size;
+        std::mutex mutex{};
+        void *current;
+        std::byte *position;
+        allocation_statistics statistics{};
+        size_t retired_free = 0;
+        size_t retired_largest = 0;
+        size_t retired_count = 0;
+    };
+
+    /** Starts every chunk, used is set when the chunk stops being the current one */
+    struct chunk_header
+    {
+        void *prev;
+        size_t size;
+        size_t used;
+    };
+
+    void *_trusted_memory;
+
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
+
+    static constexpr const size_t chunk_header_size = align_up(sizeof(chunk_header), default_alignment);
+
+public:
+
+    explicit allocator_monotonic(
+            size_t initial_size,
+            std::pmr::memory_resource *parent_allocator = nullptr,
+            logger *logger = nullptr);
+
+    allocator_monotonic(
+        allocator_monotonic const &other) = delete;
+
+    allocator_monotonic &operator=(
+        allocator_monotonic const &other) = delete;
+
+    allocator_monotonic(
+        allocator_monotonic &&other) noexcept;
+
+    allocator_monotonic &operator=(
+        allocator_monotonic &&other) noexcept;
+
+    ~allocator_monotonic() override;
+
+public:
+
+    [[nodiscard]] void *do_allocate_sm(
+        size_t size) override;
+
+    void do_deallocate_sm(
+        void *at) override;
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
+
+    allocation_statistics::snapshot get_statistics() const noexcept override;
+
+public:
+
+    /** Forgets every allocation and gives all chunks but the first one back to the parent allocator */
+    void release() noexcept;
+
+    checkpoint mark() const;
+
+    /** Forgets allocations made after the checkpoint, chunks taken since then go back to the parent allocator */
+    void rollback(
+        checkpoint const &to) noexcept;
+
+private:
+
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    void *allocate_inner(
+        size_t size,
+        size_t alignment);
+
+    /** mutex must be held */
+    void rollback_unlocked(
+        checkpoint const &to) noexcept;
+
+    std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
+
+    allocator_metadata &get_metadata() const noexcept;
+
+    static chunk_header &get_chunk(void *chunk) noexcept;
+
+    void *first_chunk() const noexcept;
+
+    /** Bytes taken from all chunks, mutex must be held */
+    size_t consumed() const noexcept;
+
+    /** Sums up the tails of chunks before the current one, mutex must be held */
+    void retire_chunks() noexcept;
+
+    /** Stores the free space shape into statistics, mutex must be held */
+    void publish_free_space() noexcept;
+
+    void destroy() noexcept;
+
+    inline logger *get_logger() const override;
+
+    inline std::string get_typename() const override;
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_MONOTONIC_H
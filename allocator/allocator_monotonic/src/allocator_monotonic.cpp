@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <limits>
+#include <new>
+#include "../include/allocator_monotonic.h"
+
+allocator_monotonic::~allocator_monotonic()
+{
+    debug_with_guard([&] { return get_typename() + "::~allocator_monotonic() called"; });
+    destroy();
+}
+
+allocator_monotonic::allocator_monotonic(
+    allocator_monotonic &&other) noexcept : _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_monotonic &allocator_monotonic::operator=(
+    allocator_monotonic &&other) noexcept
+{
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
+}
+
+allocator_monotonic::allocator_monotonic(
+    size_t initial_size,
+    std::pmr::memory_resource *parent_allocator,
+    logger *logger)
+{
+    if (initial_size == 0)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_monotonic: initial size must not be zero");
+        }
+        throw std::logic_error("allocator_monotonic: initial size must not be zero");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size + chunk_header_size + initial_size, default_alignment);
+
+    new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .next_chunk_size = 2 * (chunk_header_size + initial_size),
+            .current = first_chunk(),
+            .position = reinterpret_cast<std::byte *>(first_chunk()) + chunk_header_size
+        };
+
+    get_chunk(first_chunk()) = { .prev = nullptr, .size = chunk_header_size + initial_size, .used = 0 };
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::allocator_monotonic(size_t, std::pmr::memory_resource *, logger *) finished"; });
+}
+
+[[nodiscard]] void *allocator_monotonic::do_allocate_sm(
+    size_t size)
+{
+    return allocate_inner(size, default_alignment);
+}
+
+[[nodiscard]] void *allocator_monotonic::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    return allocate_inner(size, alignment);
+}
+
+void *allocator_monotonic::allocate_inner(
+    size_t size,
+    size_t alignment)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") started"; });
+
+    auto &metadata = get_metadata();
+    auto *chunk_end = reinterpret_cast<std::byte *>(metadata.current) + get_chunk(metadata.current).size;
+    auto *user = reinterpret_cast<std::byte *>(align_up(metadata.position, alignment));
+
+    if (user > chunk_end || static_cast<size_t>(chunk_end - user) < size)
+    {
+        if (size > std::numeric_limits<size_t>::max() / 2 - chunk_header_size - alignment)
+        {
+            metadata.statistics.on_failure();
+            error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): request is too big"; });
+            throw std::bad_alloc();
+        }
+
+        size_t const chunk_size = std::max(metadata.next_chunk_size, chunk_header_size + size + alignment);
+
+        void *chunk;
+        try
+        {
+            chunk = metadata.parent_allocator->allocate(chunk_size, default_alignment);
+        }
+        catch (std::bad_alloc const &)
+        {
+            metadata.statistics.on_failure();
+            error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): parent allocator has no space for a chunk"; });
+            throw;
+        }
+
+        get_chunk(metadata.current).used = metadata.position - reinterpret_cast<std::byte *>(metadata.current);
+        get_chunk(chunk) = { .prev = metadata.current, .size = chunk_size, .used = 0 };
+
+        metadata.current = chunk;
+        metadata.position = reinterpret_cast<std::byte *>(chunk) + chunk_header_size;
+        metadata.next_chunk_size = std::max(metadata.next_chunk_size, chunk_size) * 2;
+        user = reinterpret_cast<std::byte *>(align_up(metadata.position, alignment));
+        retire_chunks();
+    }
+
+    metadata.statistics.on_allocate(user + size - metadata.position);
+    metadata.position = user + size;
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") finished"; });
+
+    return user;
+}
+
+void allocator_monotonic::do_deallocate_sm(
+    void *)
+{
+    get_metadata().statistics.on_deallocate(0);
+}
+
+void allocator_monotonic::do_deallocate_aligned_sm(
+    void *,
+    size_t)
+{
+    get_metadata().statistics.on_deallocate(0);
+}
+
+bool allocator_monotonic::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    auto p = dynamic_cast<const allocator_monotonic*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
+}
+
+void allocator_monotonic::release() noexcept
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::release() called"; });
+
+    rollback_unlocked({ .chunk = first_chunk(), .position = reinterpret_cast<std::byte *>(first_chunk()) + chunk_header_size });
+    get_metadata().next_chunk_size = 2 * get_chunk(first_chunk()).size;
+}
+
+allocator_monotonic::checkpoint allocator_monotonic::mark() const
+{
+    std::lock_guard lock(get_metadata().mutex);
+    return { .chunk = get_metadata().current, .position = get_metadata().position };
+}
+
+void allocator_monotonic::rollback(
+    checkpoint const &to) noexcept
+{
+    std::lock_guard lock(get_metadata().mutex);
+    rollback_unlocked(to);
+}
+
+void allocator_monotonic::rollback_unlocked(
+    checkpoint const &to) noexcept
+{
+    auto &metadata = get_metadata();
+    size_t const consumed_before = consumed();
+
+    while (metadata.current != to.chunk && metadata.current != first_chunk())
+    {
+        void *prev = get_chunk(metadata.current).prev;
+        metadata.parent_allocator->deallocate(metadata.current, get_chunk(metadata.current).size, default_alignment);
+        metadata.current = prev;
+    }
+
+    metadata.position = to.position;
+
+    metadata.statistics.on_release(consumed_before - consumed());
+    retire_chunks();
+    publish_free_space();
+}
+
+std::vector<allocator_test_utils::block_info> allocator_monotonic::get_blocks_info() const
+{
+    std::lock_guard lock(get_metadata().mutex);
+    return get_blocks_info_inner();
+}
+
+allocation_statistics::snapshot allocator_monotonic::get_statistics() const noexcept
+{
+    return get_metadata().statistics.get();
+}
+
+std::vector<allocator_test_utils::block_info> allocator_monotonic::get_blocks_info_inner() const
+{
+    std::vector<void *> chunks;
+    for (void *chunk = get_metadata().current; chunk != nullptr; chunk = get_chunk(chunk).prev)
+    {
+        chunks.push_back(chunk);
+    }
+
+    std::vector<allocator_test_utils::block_info> res;
+
+    // every chunk shows up as its used part followed by what is left of it
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it)
+    {
+        auto const &header = get_chunk(*it);
+        size_t const used = (*it == get_metadata().current
+            ? static_cast<size_t>(get_metadata().position - reinterpret_cast<std::byte *>(*it))
+            : header.used) - chunk_header_size;
+
+        if (used != 0)
+        {
+            res.push_back({ .block_size = used, .is_block_occupied = true });
+        }
+        if (header.size - chunk_header_size != used)
+        {
+            res.push_back({ .block_size = header.size - chunk_header_size - used, .is_block_occupied = false });
+        }
+    }
+
+    return res;
+}
+
+allocator_monotonic::allocator_metadata &allocator_monotonic::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_monotonic::chunk_header &allocator_monotonic::get_chunk(void *chunk) noexcept
+{
+    return *reinterpret_cast<chunk_header *>(chunk);
+}
+
+void *allocator_monotonic::first_chunk() const noexcept
+{
+    return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size;
+}
+
+size_t allocator_monotonic::consumed() const noexcept
+{
+    auto const &metadata = get_metadata();
+    size_t res = metadata.position - reinterpret_cast<std::byte *>(metadata.current) - chunk_header_size;
+
+    for (void *chunk = get_chunk(metadata.current).prev; chunk != nullptr; chunk = get_chunk(chunk).prev)
+    {
+        res += get_chunk(chunk).used - chunk_header_size;
+    }
+
+    return res;
+}
+
+void allocator_monotonic::retire_chunks() noexcept
+{
+    auto &metadata = get_metadata();
+    metadata.retired_free = metadata.retired_largest = metadata.retired_count = 0;
+
+    for (void *chunk = get_chunk(metadata.current).prev; chunk != nullptr; chunk = get_chunk(chunk).prev)
+    {
+        size_t const tail = get_chunk(chunk).size - get_chunk(chunk).used;
+
+        metadata.retired_free += tail;
+        metadata.retired_largest = std::max(metadata.retired_largest, tail);
+        metadata.retired_count += tail != 0;
+    }
+}
+
+void allocator_monotonic::publish_free_space() noexcept
+{
+    auto &metadata = get_metadata();
+    size_t const rest = reinterpret_cast<std::byte *>(metadata.current) + get_chunk(metadata.current).size - metadata.position;
+
+    metadata.statistics.set_free_space(metadata.retired_free + rest, std::max(metadata.retired_largest, rest), metadata.retired_count + (rest != 0));
+}
+
+void allocator_monotonic::destroy() noexcept
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    rollback_unlocked({ .chunk = first_chunk(), .position = reinterpret_cast<std::byte *>(first_chunk()) + chunk_header_size });
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const total_size = allocator_metadata_size + get_chunk(first_chunk()).size;
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, total_size, default_alignment);
+    _trusted_memory = nullptr;
+}
+
+inline logger *allocator_monotonic::get_logger() const
+{
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
+}
+
+inline std::string allocator_monotonic::get_typename() const
+{
+    return "allocator_monotonic";
+}
+
+allocator_monotonic::scope::scope(
+    allocator_monotonic &allocator) :
+        _allocator(allocator),
+        _checkpoint(allocator.mark())
+{
+}
+
+allocator_monotonic::scope::~scope() noexcept
+{
+    _allocator.rollback(_checkpoint);
+}
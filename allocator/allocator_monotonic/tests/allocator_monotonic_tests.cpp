@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <allocator_monotonic.h>
+
+TEST(allocatorMonotonicPositiveTests, test1)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move every block";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_monotonic(1024));
+    auto *monotonic = dynamic_cast<allocator_monotonic *>(allocator.get());
+
+    auto *first_block = reinterpret_cast<std::byte *>(allocator->allocate(sizeof(char) * 10));
+    auto *second_block = reinterpret_cast<std::byte *>(allocator->allocate(sizeof(char) * 100));
+    auto *third_block = reinterpret_cast<std::byte *>(allocator->allocate(sizeof(char) * 40, 256));
+
+    ASSERT_EQ(second_block, first_block + 16);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 256, 0);
+
+    // deallocation gives nothing back, the next block still follows the last one
+    allocator->deallocate(second_block, 100);
+    ASSERT_EQ(allocator->allocate(sizeof(char) * 8), third_block + 48);
+
+    monotonic->release();
+    ASSERT_EQ(allocator->allocate(sizeof(char) * 10), first_block);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 10, .is_block_occupied = true },
+            { .block_size = 1014, .is_block_occupied = false }
+        };
+    ASSERT_EQ(monotonic->get_blocks_info(), expected_blocks_info);
+}
+
+TEST(allocatorMonotonicPositiveTests, test2)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move every block";
+#endif
+
+    allocator_monotonic allocator(1024);
+
+    void *outer_block = allocator.allocate(100);
+    void *inner_block;
+    {
+        allocator_monotonic::scope outer_phase(allocator);
+        inner_block = allocator.allocate(500);
+
+        {
+            allocator_monotonic::scope inner_phase(allocator);
+            for (int i = 0; i < 100; ++i)
+            {
+                static_cast<void>(allocator.allocate(1000));
+            }
+            ASSERT_GT(allocator.get_blocks_info().size(), 2);
+        }
+
+        ASSERT_EQ(allocator.allocate(8), reinterpret_cast<std::byte *>(inner_block) + 512);
+    }
+
+    ASSERT_EQ(allocator.allocate(8), reinterpret_cast<std::byte *>(outer_block) + 112);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 120, .is_block_occupied = true },
+            { .block_size = 904, .is_block_occupied = false }
+        };
+    ASSERT_EQ(allocator.get_blocks_info(), expected_blocks_info);
+}
+
+TEST(allocatorMonotonicPositiveTests, test3)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones change every statistic";
+#endif
+
+    allocator_monotonic allocator(1024);
+
+    void *first_block = allocator.allocate(100);
+    auto checkpoint = allocator.mark();
+    static_cast<void>(allocator.allocate(1000));
+
+    // the tail of the first chunk stays free but no longer serves requests
+    auto snapshot = allocator.get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 1100);
+    ASSERT_EQ(snapshot.free_bytes, 924 + 1080);
+    ASSERT_EQ(snapshot.largest_free_block, 1080);
+    ASSERT_EQ(snapshot.free_blocks_count, 2);
+
+    allocator.deallocate(first_block, 100);
+    allocator.rollback(checkpoint);
+
+    snapshot = allocator.get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 100);
+    ASSERT_EQ(snapshot.peak_bytes_in_use, 1100);
+    ASSERT_EQ(snapshot.allocations_count, 2);
+    ASSERT_EQ(snapshot.deallocations_count, 1);
+    ASSERT_EQ(snapshot.free_bytes, 924);
+    ASSERT_EQ(snapshot.free_blocks_count, 1);
+}
+
+TEST(allocatorMonotonicNegativeTests, test1)
+{
+    ASSERT_THROW(allocator_monotonic(0), std::logic_error);
+}
@@ -0,0 +1,154 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
+
+#include <pp_allocator.h>
+#include <allocator_test_utils.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+/** Serves small blocks of equal size, such as container nodes, from slabs cut into blocks of one size class.
+ *  Every class keeps its free blocks in a lock-free stack, the mutex is taken only to get a new slab
+ *  from the parent allocator. Requests above max_block_size go to the parent allocator one by one
+ */
+class allocator_pool final:
+    public smart_mem_resource,
+    public allocator_test_utils,
+    private logger_guardant,
+    private typename_holder
+{
+
+public:
+
+    static constexpr const size_t size_class_step = 16;
+
+    static constexpr const size_t size_classes_count = 64;
+
+    static constexpr const size_t max_block_size = size_class_step * size_classes_count;
+
+private:
+
+    /** Stack heads keep the top block address in the low bits and a counter of pushes in the high ones,
+     *  so a block popped and pushed back between a read and a compare-exchange does not pass unnoticed
+     */
+    static constexpr const unsigned tag_shift = 48;
+
+    static_assert(sizeof(void *) == sizeof(uint64_t), "stack heads pack a tag next to a 48-bit address");
+
+    /** Lives at the beginning of trusted memory.
+     *  free_counts grow before blocks get pushed and shrink after they get popped, so they never go below zero
+     */
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        size_t slab_size;
+        std::mutex mutex{};
+        void *chunks;
+        std::array<std::atomic<uint64_t>, size_classes_count> free_heads{};
+        std::array<std::atomic<size_t>, size_classes_count> free_counts{};
+        allocation_statistics statistics{};
+    };
+
+    /** Starts every slab and every block above max_block_size, both aligned to slab_size,
+     *  so a block finds its chunk by masking its address. block_size is zero for a single big block
+     */
+    struct chunk_header
+    {
+        void *trusted;
+        size_t block_size;
+        size_t size;
+        void *prev = nullptr;
+        void *next = nullptr;
+    };
+
+    void *_trusted_memory;
+
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
+
+    static constexpr const size_t chunk_header_size = align_up(sizeof(chunk_header), default_alignment);
+
+public:
+
+    /** slab_size must be a power of two able to hold at least one block of max_block_size */
+    explicit allocator_pool(
+            size_t slab_size = 64 * 1024,
+            std::pmr::memory_resource *parent_allocator = nullptr,
+            logger *logger = nullptr);
+
+    allocator_pool(
+        allocator_pool const &other) = delete;
+
+    allocator_pool &operator=(
+        allocator_pool const &other) = delete;
+
+    allocator_pool(
+        allocator_pool &&other) noexcept;
+
+    allocator_pool &operator=(
+        allocator_pool &&other) noexcept;
+
+    ~allocator_pool() override;
+
+public:
+
+    [[nodiscard]] void *do_allocate_sm(
+        size_t size) override;
+
+    void do_deallocate_sm(
+        void *at) override;
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    /** A snapshot that is exact only while no other thread allocates or deallocates */
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
+
+    /** Free space is the sum of free blocks of all classes, big blocks never leave any */
+    allocation_statistics::snapshot get_statistics() const noexcept override;
+
+private:
+
+    std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
+
+    /** Cuts a new slab for the class and pushes all of its blocks, mutex must be held */
+    void add_slab(
+        size_t size_class);
+
+    void *allocate_big(
+        size_t size);
+
+    void deallocate_big(
+        void *chunk);
+
+    void push(
+        size_t size_class,
+        void *first,
+        void *last) noexcept;
+
+    void *pop(
+        size_t size_class) noexcept;
+
+    static std::atomic_ref<uintptr_t> next_of(void *block) noexcept;
+
+    allocator_metadata &get_metadata() const noexcept;
+
+    static chunk_header &get_chunk(void *chunk) noexcept;
+
+    void link_chunk(
+        void *chunk) noexcept;
+
+    void unlink_chunk(
+        void *chunk) noexcept;
+
+    void destroy() noexcept;
+
+    inline logger *get_logger() const override;
+
+    inline std::string get_typename() const override;
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
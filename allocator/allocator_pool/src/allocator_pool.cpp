@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <new>
+#include "../include/allocator_pool.h"
+
+allocator_pool::~allocator_pool()
+{
+    debug_with_guard([&] { return get_typename() + "::~allocator_pool() called"; });
+    destroy();
+}
+
+allocator_pool::allocator_pool(
+    allocator_pool &&other) noexcept : _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_pool &allocator_pool::operator=(
+    allocator_pool &&other) noexcept
+{
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
+}
+
+allocator_pool::allocator_pool(
+    size_t slab_size,
+    std::pmr::memory_resource *parent_allocator,
+    logger *logger)
+{
+    if (!std::has_single_bit(slab_size) || slab_size < chunk_header_size + max_block_size)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_pool: slab size must be a power of two that holds the largest block");
+        }
+        throw std::logic_error("allocator_pool: slab size must be a power of two that holds the largest block");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size, default_alignment);
+
+    new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .slab_size = slab_size,
+            .chunks = nullptr
+        };
+
+    debug_with_guard([&] { return get_typename() + "::allocator_pool(size_t, std::pmr::memory_resource *, logger *) finished"; });
+}
+
+[[nodiscard]] void *allocator_pool::do_allocate_sm(
+    size_t size)
+{
+    if (size > max_block_size)
+    {
+        return allocate_big(size);
+    }
+
+    size_t const size_class = size == 0 ? 0 : (size - 1) / size_class_step;
+
+    void *block = pop(size_class);
+
+    if (block == nullptr)
+    {
+        std::lock_guard lock(get_metadata().mutex);
+
+        // other threads may take the new blocks before this one gets to them
+        try
+        {
+            while ((block = pop(size_class)) == nullptr)
+            {
+                add_slab(size_class);
+            }
+        }
+        catch (std::bad_alloc const &)
+        {
+            get_metadata().statistics.on_failure();
+            throw;
+        }
+    }
+
+    get_metadata().statistics.on_allocate((size_class + 1) * size_class_step);
+
+    return block;
+}
+
+void allocator_pool::do_deallocate_sm(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    void *chunk = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(at) & ~(get_metadata().slab_size - 1));
+    auto const &header = get_chunk(chunk);
+    size_t const offset = reinterpret_cast<std::byte *>(at) - reinterpret_cast<std::byte *>(chunk);
+
+    if (header.trusted != _trusted_memory || offset < chunk_header_size ||
+        (header.block_size == 0 ? offset != chunk_header_size : (offset - chunk_header_size) % header.block_size != 0))
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_pool: block does not belong to this allocator");
+    }
+
+    if (header.block_size == 0)
+    {
+        deallocate_big(chunk);
+        return;
+    }
+
+    size_t const size_class = header.block_size / size_class_step - 1;
+
+    get_metadata().statistics.on_deallocate(header.block_size);
+    get_metadata().free_counts[size_class].fetch_add(1, std::memory_order_relaxed);
+    push(size_class, at, at);
+}
+
+bool allocator_pool::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    auto p = dynamic_cast<const allocator_pool*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
+}
+
+std::vector<allocator_test_utils::block_info> allocator_pool::get_blocks_info() const
+{
+    std::lock_guard lock(get_metadata().mutex);
+    return get_blocks_info_inner();
+}
+
+allocation_statistics::snapshot allocator_pool::get_statistics() const noexcept
+{
+    auto res = get_metadata().statistics.get();
+
+    res.free_bytes = res.free_blocks_count = res.largest_free_block = 0;
+    for (size_t size_class = 0; size_class < size_classes_count; ++size_class)
+    {
+        size_t const count = get_metadata().free_counts[size_class].load(std::memory_order_relaxed);
+        size_t const block_size = (size_class + 1) * size_class_step;
+
+        res.free_bytes += count * block_size;
+        res.free_blocks_count += count;
+        if (count != 0)
+        {
+            res.largest_free_block = block_size;
+        }
+    }
+
+    return res;
+}
+
+std::vector<allocator_test_utils::block_info> allocator_pool::get_blocks_info_inner() const
+{
+    std::vector<void *> free_blocks;
+    for (auto const &head : get_metadata().free_heads)
+    {
+        for (uintptr_t block = head.load(std::memory_order_acquire) & ((uint64_t(1) << tag_shift) - 1); block != 0; )
+        {
+            free_blocks.push_back(reinterpret_cast<void *>(block));
+            block = next_of(reinterpret_cast<void *>(block)).load(std::memory_order_relaxed);
+        }
+    }
+    std::sort(free_blocks.begin(), free_blocks.end());
+
+    std::vector<void *> chunks;
+    for (void *chunk = get_metadata().chunks; chunk != nullptr; chunk = get_chunk(chunk).next)
+    {
+        chunks.push_back(chunk);
+    }
+    std::sort(chunks.begin(), chunks.end());
+
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (void *chunk : chunks)
+    {
+        auto const &header = get_chunk(chunk);
+
+        if (header.block_size == 0)
+        {
+            res.push_back({ .block_size = header.size - chunk_header_size, .is_block_occupied = true });
+            continue;
+        }
+
+        auto *block = reinterpret_cast<std::byte *>(chunk) + chunk_header_size;
+        for (auto *chunk_end = reinterpret_cast<std::byte *>(chunk) + header.size; block + header.block_size <= chunk_end; block += header.block_size)
+        {
+            res.push_back({ .block_size = header.block_size,
+                            .is_block_occupied = !std::binary_search(free_blocks.begin(), free_blocks.end(), block) });
+        }
+    }
+
+    return res;
+}
+
+void allocator_pool::add_slab(
+    size_t size_class)
+{
+    size_t const slab_size = get_metadata().slab_size;
+    size_t const block_size = (size_class + 1) * size_class_step;
+
+    void *chunk;
+    try
+    {
+        chunk = get_metadata().parent_allocator->allocate(slab_size, slab_size);
+    }
+    catch (std::bad_alloc const &)
+    {
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(block_size) + "): parent allocator has no space for a slab"; });
+        throw;
+    }
+
+    get_chunk(chunk) = { .trusted = _trusted_memory, .block_size = block_size, .size = slab_size };
+    link_chunk(chunk);
+
+    auto *first = reinterpret_cast<std::byte *>(chunk) + chunk_header_size;
+    size_t const blocks_count = (slab_size - chunk_header_size) / block_size;
+    auto *last = first + (blocks_count - 1) * block_size;
+
+    for (auto *block = first; block != last; block += block_size)
+    {
+        next_of(block).store(reinterpret_cast<uintptr_t>(block + block_size), std::memory_order_relaxed);
+    }
+
+    get_metadata().free_counts[size_class].fetch_add(blocks_count, std::memory_order_relaxed);
+    push(size_class, first, last);
+
+    debug_with_guard([&] { return get_typename() + "::add_slab(size_t): slab of " + std::to_string(blocks_count) + " blocks of " + std::to_string(block_size) + " bytes added"; });
+}
+
+void *allocator_pool::allocate_big(
+    size_t size)
+{
+    if (size > std::numeric_limits<size_t>::max() - chunk_header_size)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): request is too big"; });
+        throw std::bad_alloc();
+    }
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    void *chunk;
+    try
+    {
+        chunk = get_metadata().parent_allocator->allocate(chunk_header_size + size, get_metadata().slab_size);
+    }
+    catch (std::bad_alloc const &)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): parent allocator has no space"; });
+        throw;
+    }
+
+    get_chunk(chunk) = { .trusted = _trusted_memory, .block_size = 0, .size = chunk_header_size + size };
+    link_chunk(chunk);
+    get_metadata().statistics.on_allocate(size);
+
+    return reinterpret_cast<std::byte *>(chunk) + chunk_header_size;
+}
+
+void allocator_pool::deallocate_big(
+    void *chunk)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    unlink_chunk(chunk);
+    get_metadata().statistics.on_deallocate(get_chunk(chunk).size - chunk_header_size);
+    get_metadata().parent_allocator->deallocate(chunk, get_chunk(chunk).size, get_metadata().slab_size);
+}
+
+void allocator_pool::push(
+    size_t size_class,
+    void *first,
+    void *last) noexcept
+{
+    auto &head = get_metadata().free_heads[size_class];
+    uint64_t expected = head.load(std::memory_order_relaxed);
+    uint64_t desired;
+
+    do
+    {
+        next_of(last).store(expected & ((uint64_t(1) << tag_shift) - 1), std::memory_order_relaxed);
+        desired = reinterpret_cast<uintptr_t>(first) | (((expected >> tag_shift) + 1) << tag_shift);
+    }
+    while (!head.compare_exchange_weak(expected, desired, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void *allocator_pool::pop(
+    size_t size_class) noexcept
+{
+    auto &head = get_metadata().free_heads[size_class];
+    uint64_t expected = head.load(std::memory_order_acquire);
+    uint64_t desired;
+
+    do
+    {
+        auto top = expected & ((uint64_t(1) << tag_shift) - 1);
+        if (top == 0)
+        {
+            return nullptr;
+        }
+
+        // the block may be taken by another thread meanwhile, then the tag has changed and the exchange fails
+        desired = next_of(reinterpret_cast<void *>(top)).load(std::memory_order_relaxed) | (((expected >> tag_shift) + 1) << tag_shift);
+    }
+    while (!head.compare_exchange_weak(expected, desired, std::memory_order_acquire, std::memory_order_acquire));
+
+    get_metadata().free_counts[size_class].fetch_sub(1, std::memory_order_relaxed);
+
+    return reinterpret_cast<void *>(expected & ((uint64_t(1) << tag_shift) - 1));
+}
+
+std::atomic_ref<uintptr_t> allocator_pool::next_of(void *block) noexcept
+{
+    return std::atomic_ref<uintptr_t>(*reinterpret_cast<uintptr_t *>(block));
+}
+
+allocator_pool::allocator_metadata &allocator_pool::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_pool::chunk_header &allocator_pool::get_chunk(void *chunk) noexcept
+{
+    return *reinterpret_cast<chunk_header *>(chunk);
+}
+
+void allocator_pool::link_chunk(
+    void *chunk) noexcept
+{
+    auto &header = get_chunk(chunk);
+
+    header.prev = nullptr;
+    header.next = get_metadata().chunks;
+    if (header.next != nullptr)
+    {
+        get_chunk(header.next).prev = chunk;
+    }
+    get_metadata().chunks = chunk;
+}
+
+void allocator_pool::unlink_chunk(
+    void *chunk) noexcept
+{
+    auto &header = get_chunk(chunk);
+
+    if (header.prev == nullptr)
+    {
+        get_metadata().chunks = header.next;
+    }
+    else
+    {
+        get_chunk(header.prev).next = header.next;
+    }
+
+    if (header.next != nullptr)
+    {
+        get_chunk(header.next).prev = header.prev;
+    }
+}
+
+void allocator_pool::destroy() noexcept
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const slab_size = get_metadata().slab_size;
+
+    for (void *chunk = get_metadata().chunks; chunk != nullptr; )
+    {
+        void *next = get_chunk(chunk).next;
+        parent->deallocate(chunk, get_chunk(chunk).size, slab_size);
+        chunk = next;
+    }
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, allocator_metadata_size, default_alignment);
+    _trusted_memory = nullptr;
+}
+
+inline logger *allocator_pool::get_logger() const
+{
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
+}
+
+inline std::string allocator_pool::get_typename() const
+{
+    return "allocator_pool";
+}
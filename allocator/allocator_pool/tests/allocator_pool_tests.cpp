@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <allocator_pool.h>
+#include <list>
+#include <random>
+#include <thread>
+
+TEST(allocatorPoolPositiveTests, test1)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to other size classes";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_pool(4096));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(allocator.get());
+
+    void *first_block = allocator->allocate(sizeof(char) * 24);
+    void *second_block = allocator->allocate(sizeof(char) * 24);
+    void *big_block = allocator->allocate(sizeof(char) * 2000);
+
+    auto actual_blocks_info = blocks_info->get_blocks_info();
+    size_t occupied_small_blocks = 0, occupied_big_blocks = 0;
+    for (auto const &block : actual_blocks_info)
+    {
+        ASSERT_TRUE(block.block_size == 32 || block.block_size == 2000);
+        if (block.is_block_occupied)
+        {
+            ++(block.block_size == 32 ? occupied_small_blocks : occupied_big_blocks);
+        }
+    }
+    ASSERT_EQ(occupied_small_blocks, 2);
+    ASSERT_EQ(occupied_big_blocks, 1);
+
+    allocator->deallocate(first_block, 24);
+    allocator->deallocate(big_block, 2000);
+
+    // the block freed last is the first to be reused
+    ASSERT_EQ(allocator->allocate(sizeof(char) * 20), first_block);
+
+    allocator->deallocate(first_block, 20);
+    allocator->deallocate(second_block, 24);
+
+    for (auto const &block : blocks_info->get_blocks_info())
+    {
+        ASSERT_EQ(block.block_size, 32);
+        ASSERT_FALSE(block.is_block_occupied);
+    }
+}
+
+TEST(allocatorPoolPositiveTests, test2)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_pool());
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 8; ++i)
+    {
+        workers.emplace_back([&allocator, i]
+        {
+            std::mt19937 engine(i);
+            std::list<int, pp_allocator<int>> nodes(pp_allocator<int>(allocator.get()));
+
+            for (int j = 0; j < 100'000; ++j)
+            {
+                if (nodes.empty() || engine() % 2 == 0)
+                {
+                    nodes.push_back(j);
+                }
+                else
+                {
+                    nodes.pop_front();
+                }
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    allocator->flush_quarantine();
+
+    for (auto const &block : dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info())
+    {
+        ASSERT_FALSE(block.is_block_occupied);
+    }
+}
+
+TEST(allocatorPoolNegativeTests, test1)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "the quarantine checks the owner only when the block leaves it";
+#endif
+
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_pool());
+    std::unique_ptr<smart_mem_resource> another_allocator(new allocator_pool());
+
+    void *block = allocator->allocate(sizeof(char) * 100);
+
+    ASSERT_THROW(another_allocator->deallocate(block, 100), std::logic_error);
+    ASSERT_THROW(new allocator_pool(1000), std::logic_error);
+
+    allocator->deallocate(block, 100);
+}
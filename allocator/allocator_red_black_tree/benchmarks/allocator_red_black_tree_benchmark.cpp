@@ -0,0 +1,81 @@
+#include <allocator_red_black_tree.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /** Keeps live_blocks blocks of random sizes allocated and measures free + allocate pairs at random positions.
+     *  Every freed slot leaves a hole, so the free tree grows to a large share of live_blocks
+     */
+    void run(
+        size_t live_blocks,
+        size_t operations_count,
+        allocator_with_fit_mode::fit_mode mode,
+        std::string const &mode_name)
+    {
+        size_t const max_block_size = 256;
+
+        std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(live_blocks * (max_block_size + 64) * 2, nullptr, nullptr, mode));
+        std::mt19937_64 engine(live_blocks);
+        std::uniform_int_distribution<size_t> sizes(16, max_block_size);
+
+        std::vector<std::pair<void *, size_t>> blocks;
+        blocks.reserve(live_blocks);
+
+        // every other block goes away, so the holes stay apart and the tree holds about live_blocks / 2 nodes
+        for (size_t i = 0; i < 2 * live_blocks; ++i)
+        {
+            size_t const size = sizes(engine);
+            blocks.emplace_back(allocator->allocate(size), size);
+        }
+        for (size_t i = 0; i < blocks.size(); i += 2)
+        {
+            allocator->deallocate(blocks[i].first, blocks[i].second);
+        }
+        std::erase_if(blocks, [&blocks](auto const &block) { return (&block - blocks.data()) % 2 == 0; });
+
+        auto const churn_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operations_count; ++i)
+        {
+            auto &[block, size] = blocks[engine() % blocks.size()];
+            allocator->deallocate(block, size);
+            size = sizes(engine);
+            block = allocator->allocate(size);
+        }
+        auto const churn_end = std::chrono::steady_clock::now();
+
+        for (auto [block, size] : blocks)
+        {
+            allocator->deallocate(block, size);
+        }
+
+        std::cout << std::setw(14) << mode_name
+                  << std::setw(10) << live_blocks
+                  << std::setw(20) << std::fixed << std::setprecision(1)
+                  << std::chrono::duration<double, std::nano>(churn_end - churn_start).count() / static_cast<double>(operations_count)
+                  << std::endl;
+    }
+}
+
+int main()
+{
+    std::cout << std::setw(14) << "mode" << std::setw(10) << "live" << std::setw(20) << "churn ns/free+alloc" << std::endl;
+
+    for (auto [mode, mode_name] : {
+            std::pair{ allocator_with_fit_mode::fit_mode::first_fit, "first_fit" },
+            std::pair{ allocator_with_fit_mode::fit_mode::the_best_fit, "the_best_fit" },
+            std::pair{ allocator_with_fit_mode::fit_mode::the_worst_fit, "the_worst_fit" } })
+    {
+        for (size_t live_blocks : { 1'000, 10'000, 100'000 })
+        {
+            run(live_blocks, 100'000, mode, mode_name);
+        }
+    }
+
+    return 0;
+}
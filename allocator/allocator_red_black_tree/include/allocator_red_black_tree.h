@@ -6,7 +6,9 @@
 #include <allocator_with_fit_mode.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <arena_chain.h>
 #include <mutex>
+#include <optional>
 
 class allocator_red_black_tree final:
     public smart_mem_resource,
@@ -27,21 +29,45 @@ private:
         block_color color : 4;
     };
 
+    /** Lives at the beginning of trusted memory, blocks follow it.
+     *  Statistics cover the own space only, extra arenas keep their own
+     */
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        allocator_with_fit_mode::fit_mode mode;
+        size_t space_size;
+        std::mutex mutex{};
+        void *root = nullptr;
+        std::optional<arena_chain> arenas{};
+        allocation_statistics statistics{};
+        size_t free_bytes = 0;
+        size_t free_blocks_count = 0;
+    };
+
     void *_trusted_memory;
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(void*);
-    static constexpr const size_t occupied_block_metadata_size = sizeof(block_data) + 3 * sizeof(void*);
-    static constexpr const size_t free_block_metadata_size = sizeof(block_data) + 5 * sizeof(void*);
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
+
+    /** block_data is padded to pointer size. Both kinds of blocks start with data, prev and next, free blocks keep
+     *  parent, left and right tree links after them. The occupied header and block sizes are multiples of
+     *  default_alignment, so every block and its payload start on a default_alignment boundary.
+     *  The free tree is ordered by block size, then by address
+     */
+    static constexpr const size_t block_data_size = align_up(sizeof(block_data), alignof(void*));
+    static constexpr const size_t occupied_block_metadata_size = align_up(block_data_size + 2 * sizeof(void*), default_alignment);
+    static constexpr const size_t free_block_metadata_size = block_data_size + 5 * sizeof(void*);
 
 public:
     
     ~allocator_red_black_tree() override;
     
     allocator_red_black_tree(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree &operator=(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree(
         allocator_red_black_tree &&other) noexcept;
@@ -55,7 +81,8 @@ public:
             size_t space_size,
             std::pmr::memory_resource *parent_allocator = nullptr,
             logger *logger = nullptr,
-            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+            bool growable = false);
 
 public:
     
@@ -68,6 +95,8 @@ public:
     bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
 
     std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
+
+    allocation_statistics::snapshot get_statistics() const noexcept override;
     
     inline void set_fit_mode(allocator_with_fit_mode::fit_mode mode) override;
 
@@ -75,10 +104,80 @@ public:
 
 private:
 
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    void *allocate_inner(
+        size_t size,
+        size_t alignment);
+
+    /** nullptr when no free block fits, mutex must be held */
+    void *allocate_unlocked(
+        size_t size,
+        size_t alignment);
+
+    /** Another allocator of the same space size taken from the parent allocator */
+    arena_chain::arena make_arena() const;
+
     std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
 
     inline std::string get_typename() const noexcept override;
 
+    allocator_metadata &get_metadata() const noexcept;
+
+    static block_data &get_data(void *block) noexcept;
+
+    static void *&get_prev(void *block) noexcept;
+
+    static void *&get_next(void *block) noexcept;
+
+    static void *&get_parent(void *block) noexcept;
+
+    static void *&get_left(void *block) noexcept;
+
+    static void *&get_right(void *block) noexcept;
+
+    static bool is_red(void *block) noexcept;
+
+    void *blocks_begin() const noexcept;
+
+    void *blocks_end() const noexcept;
+
+    size_t get_block_size(void *block) const noexcept;
+
+    /** User pointer for the request inside a free block, nullptr if it does not fit */
+    std::byte *place_in(void *block, size_t size, size_t alignment) const noexcept;
+
+    bool tree_less(void *lhs, void *rhs) const noexcept;
+
+    void rotate_left(void *block) noexcept;
+
+    void rotate_right(void *block) noexcept;
+
+    void transplant(void *from, void *to) noexcept;
+
+    void tree_insert(void *block) noexcept;
+
+    void tree_erase(void *block) noexcept;
+
+    static void *tree_min(void *block) noexcept;
+
+    static void *tree_max(void *block) noexcept;
+
+    static void *tree_successor(void *block) noexcept;
+
+    static void *tree_predecessor(void *block) noexcept;
+
+    /** Stores the free space shape into statistics, mutex must be held */
+    void publish_free_space() noexcept;
+
+    void destroy() noexcept;
+
     class rb_iterator
     {
         void* _block_ptr;
@@ -1,140 +1,888 @@
-#include <not_implemented.h>
-
+#include <algorithm>
+#include <new>
 #include "../include/allocator_red_black_tree.h"
 
 allocator_red_black_tree::~allocator_red_black_tree()
 {
-    throw not_implemented("allocator_red_black_tree::~allocator_red_black_tree()", "your code should be here...");
+    debug_with_guard([&] { return get_typename() + "::~allocator_red_black_tree() called"; });
+    destroy();
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
-    allocator_red_black_tree &&other) noexcept
+    allocator_red_black_tree &&other) noexcept : _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(allocator_red_black_tree &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_red_black_tree &allocator_red_black_tree::operator=(
     allocator_red_black_tree &&other) noexcept
 {
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(allocator_red_black_tree &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
         size_t space_size,
         std::pmr::memory_resource *parent_allocator,
         logger *logger,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode)
+        allocator_with_fit_mode::fit_mode allocate_fit_mode,
+        bool growable)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(size_t ,std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < free_block_metadata_size)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_red_black_tree: space size is too small to hold a single block");
+        }
+        throw std::logic_error("allocator_red_black_tree: space size is too small to hold a single block");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size + space_size, default_alignment);
+
+    new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .mode = allocate_fit_mode,
+            .space_size = space_size,
+            .root = nullptr
+        };
+
+    void *first = blocks_begin();
+    get_data(first).occupied = false;
+    get_prev(first) = nullptr;
+    get_next(first) = nullptr;
+    tree_insert(first);
+    publish_free_space();
+
+    if (growable)
+    {
+        get_metadata().arenas.emplace();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::allocator_red_black_tree(size_t, std::pmr::memory_resource *, logger *, fit_mode) finished"; });
 }
 
-allocator_red_black_tree::allocator_red_black_tree(const allocator_red_black_tree &other)
+[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(
+    size_t size)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(const allocator_red_black_tree &other)", "your code should be here...");
+    return allocate_inner(size, default_alignment);
 }
 
-allocator_red_black_tree &allocator_red_black_tree::operator=(const allocator_red_black_tree &other)
+[[nodiscard]] void *allocator_red_black_tree::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(const allocator_red_black_tree &other)", "your code should be here...");
+    return allocate_inner(size, alignment);
 }
 
-bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+void *allocator_red_black_tree::allocate_inner(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") started"; });
+
+    void *user = get_metadata().arenas
+        ? get_metadata().arenas->allocate(size, alignment,
+            [this, size, alignment] { return allocate_unlocked(size, alignment); },
+            [this] { return make_arena(); })
+        : allocate_unlocked(size, alignment);
+
+    if (user == nullptr)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): no suitable free block"; });
+        throw std::bad_alloc();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") finished"; });
+
+    return user;
 }
 
-[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(
-    size_t size)
+void *allocator_red_black_tree::allocate_unlocked(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(size_t)", "your code should be here...");
-}
+    if (size > get_metadata().space_size)
+    {
+        return nullptr;
+    }
+
+    // an occupied block must be able to turn back into a free one, and the next block has to start aligned
+    size = align_up(std::max(size, free_block_metadata_size - occupied_block_metadata_size), default_alignment);
+
+    void *found = nullptr;
+    std::byte *user = nullptr;
+
+    switch (get_metadata().mode)
+    {
+        case fit_mode::first_fit:
+            // the first suitable block met on the way down from the root
+            for (void *node = get_metadata().root; node != nullptr; )
+            {
+                if ((user = place_in(node, size, alignment)) != nullptr)
+                {
+                    found = node;
+                    break;
+                }
+
+                node = get_block_size(node) < occupied_block_metadata_size + size ? get_right(node) : get_left(node);
+            }
+
+            // an aligned request may still fit into a bigger block the descent skipped
+            for (void *candidate = tree_max(get_metadata().root);
+                found == nullptr && candidate != nullptr && get_block_size(candidate) >= occupied_block_metadata_size + size;
+                candidate = tree_predecessor(candidate))
+            {
+                if ((user = place_in(candidate, size, alignment)) != nullptr)
+                {
+                    found = candidate;
+                }
+            }
+            break;
+        case fit_mode::the_best_fit:
+        case fit_mode::segregated_fit:
+        {
+            void *candidate = nullptr;
+            for (void *node = get_metadata().root; node != nullptr; )
+            {
+                if (get_block_size(node) >= occupied_block_metadata_size + size)
+                {
+                    candidate = node;
+                    node = get_left(node);
+                }
+                else
+                {
+                    node = get_right(node);
+                }
+            }
 
+            for (; candidate != nullptr; candidate = tree_successor(candidate))
+            {
+                if ((user = place_in(candidate, size, alignment)) != nullptr)
+                {
+                    found = candidate;
+                    break;
+                }
+            }
+            break;
+        }
+        case fit_mode::the_worst_fit:
+            for (void *candidate = tree_max(get_metadata().root);
+                candidate != nullptr && get_block_size(candidate) >= occupied_block_metadata_size + size;
+                candidate = tree_predecessor(candidate))
+            {
+                if ((user = place_in(candidate, size, alignment)) != nullptr)
+                {
+                    found = candidate;
+                    break;
+                }
+            }
+            break;
+    }
+
+    if (found == nullptr)
+    {
+        return nullptr;
+    }
+
+    tree_erase(found);
+
+    auto *found_end = reinterpret_cast<std::byte *>(found) + get_block_size(found);
+    void *next = get_next(found);
+    void *block = user - occupied_block_metadata_size;
+    void *rest = nullptr;
+
+    if (block != found)
+    {
+        // padding in front of an aligned block is kept as a free block of its own
+        get_next(found) = block;
+        get_prev(block) = found;
+        tree_insert(found);
+    }
+
+    size_t const tail = found_end - (user + size);
+    if (tail >= free_block_metadata_size)
+    {
+        rest = user + size;
+        get_data(rest).occupied = false;
+        get_prev(rest) = block;
+        get_next(rest) = next;
+        if (next != nullptr)
+        {
+            get_prev(next) = rest;
+        }
+        next = rest;
+    }
+    else if (tail != 0)
+    {
+        warning_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): block size changed to " + std::to_string(size + tail); });
+    }
+
+    get_next(block) = next;
+    if (next != nullptr)
+    {
+        get_prev(next) = block;
+    }
+
+    get_data(block).occupied = true;
+
+    if (rest != nullptr)
+    {
+        tree_insert(rest);
+    }
+
+    get_metadata().statistics.on_allocate(get_block_size(block));
+    publish_free_space();
+
+    return user;
+}
 
 void allocator_red_black_tree::do_deallocate_sm(
     void *at)
 {
-    throw not_implemented("void allocator_red_black_tree::do_deallocate_sm(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) started"; });
+
+    void *block = reinterpret_cast<std::byte *>(at) - occupied_block_metadata_size;
+
+    if (get_metadata().arenas && (block < blocks_begin() || block >= blocks_end()) && get_metadata().arenas->deallocate(at))
+    {
+        debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+        return;
+    }
+
+    if (block < blocks_begin() || block >= blocks_end() ||
+        (reinterpret_cast<std::byte *>(block) - reinterpret_cast<std::byte *>(blocks_begin())) % default_alignment != 0 ||
+        !get_data(block).occupied ||
+        (get_prev(block) == nullptr ? block != blocks_begin() : get_next(get_prev(block)) != block))
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_red_black_tree: block does not belong to this allocator");
+    }
+
+    get_data(block).occupied = false;
+    get_metadata().statistics.on_deallocate(get_block_size(block));
+
+    // neighbours leave the tree before their sizes change
+    void *next = get_next(block);
+    if (next != nullptr && !get_data(next).occupied)
+    {
+        tree_erase(next);
+        get_next(block) = get_next(next);
+        if (get_next(block) != nullptr)
+        {
+            get_prev(get_next(block)) = block;
+        }
+    }
+
+    void *prev = get_prev(block);
+    if (prev != nullptr && !get_data(prev).occupied)
+    {
+        tree_erase(prev);
+        get_next(prev) = get_next(block);
+        if (get_next(prev) != nullptr)
+        {
+            get_prev(get_next(prev)) = prev;
+        }
+        block = prev;
+    }
+
+    tree_insert(block);
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+}
+
+void allocator_red_black_tree::do_deallocate_aligned_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
+}
+
+bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    auto p = dynamic_cast<const allocator_red_black_tree*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
 }
 
 void allocator_red_black_tree::set_fit_mode(allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("void allocator_red_black_tree::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+    get_metadata().mode = mode;
+
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([mode](smart_mem_resource &arena)
+        {
+            dynamic_cast<allocator_with_fit_mode &>(arena).set_fit_mode(mode);
+        });
+    }
 }
 
 
 std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+
+    auto res = get_blocks_info_inner();
+
+    // blocks of extra arenas follow the own ones, arena by arena
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([&res](smart_mem_resource &arena)
+        {
+            auto arena_blocks = dynamic_cast<allocator_test_utils &>(arena).get_blocks_info();
+            res.insert(res.end(), arena_blocks.begin(), arena_blocks.end());
+        });
+    }
+
+    return res;
+}
+
+allocation_statistics::snapshot allocator_red_black_tree::get_statistics() const noexcept
+{
+    return get_metadata().statistics.get();
 }
 
 inline logger *allocator_red_black_tree::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_red_black_tree::get_logger() const", "your code should be here...");
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+    {
+        res.push_back({ .block_size = it.size(), .is_block_occupied = it.occupied() });
+    }
+
+    return res;
 }
 
 inline std::string allocator_red_black_tree::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_red_black_tree::get_typename() const noexcept", "your code should be here...");
+    return "allocator_red_black_tree";
+}
+
+arena_chain::arena allocator_red_black_tree::make_arena() const
+{
+    auto *created = new allocator_red_black_tree(get_metadata().space_size, get_metadata().parent_allocator, nullptr, get_metadata().mode);
+
+    return { .resource = std::unique_ptr<smart_mem_resource>(created), .begin = created->blocks_begin(), .end = created->blocks_end() };
+}
+
+allocator_red_black_tree::allocator_metadata &allocator_red_black_tree::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_red_black_tree::block_data &allocator_red_black_tree::get_data(void *block) noexcept
+{
+    return *reinterpret_cast<block_data *>(block);
+}
+
+void *&allocator_red_black_tree::get_prev(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + block_data_size);
+}
+
+void *&allocator_red_black_tree::get_next(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + block_data_size + sizeof(void*));
+}
+
+void *&allocator_red_black_tree::get_parent(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + block_data_size + 2 * sizeof(void*));
+}
+
+void *&allocator_red_black_tree::get_left(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + block_data_size + 3 * sizeof(void*));
+}
+
+void *&allocator_red_black_tree::get_right(void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(block) + block_data_size + 4 * sizeof(void*));
+}
+
+bool allocator_red_black_tree::is_red(void *block) noexcept
+{
+    return block != nullptr && get_data(block).color == block_color::RED;
+}
+
+void *allocator_red_black_tree::blocks_begin() const noexcept
+{
+    return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size;
+}
+
+void *allocator_red_black_tree::blocks_end() const noexcept
+{
+    return reinterpret_cast<std::byte *>(blocks_begin()) + get_metadata().space_size;
+}
+
+size_t allocator_red_black_tree::get_block_size(void *block) const noexcept
+{
+    void *next = get_next(block);
+    return reinterpret_cast<std::byte *>(next == nullptr ? blocks_end() : next) - reinterpret_cast<std::byte *>(block);
+}
+
+std::byte *allocator_red_black_tree::place_in(void *block, size_t size, size_t alignment) const noexcept
+{
+    auto *start = reinterpret_cast<std::byte *>(block);
+    auto *user = reinterpret_cast<std::byte *>(align_up(start + occupied_block_metadata_size, alignment));
+
+    // a gap in front of the block must be able to live on as a free block
+    if (user != start + occupied_block_metadata_size &&
+        static_cast<size_t>(user - occupied_block_metadata_size - start) < free_block_metadata_size)
+    {
+        user = reinterpret_cast<std::byte *>(align_up(start + free_block_metadata_size + occupied_block_metadata_size, alignment));
+    }
+
+    return static_cast<size_t>(user - start) <= get_block_size(block) &&
+        get_block_size(block) - static_cast<size_t>(user - start) >= size
+            ? user
+            : nullptr;
+}
+
+bool allocator_red_black_tree::tree_less(void *lhs, void *rhs) const noexcept
+{
+    size_t const lhs_size = get_block_size(lhs);
+    size_t const rhs_size = get_block_size(rhs);
+
+    return lhs_size < rhs_size || (lhs_size == rhs_size && lhs < rhs);
+}
+
+void allocator_red_black_tree::rotate_left(void *block) noexcept
+{
+    void *pivot = get_right(block);
+
+    get_right(block) = get_left(pivot);
+    if (get_left(pivot) != nullptr)
+    {
+        get_parent(get_left(pivot)) = block;
+    }
+
+    transplant(block, pivot);
+
+    get_left(pivot) = block;
+    get_parent(block) = pivot;
+}
+
+void allocator_red_black_tree::rotate_right(void *block) noexcept
+{
+    void *pivot = get_left(block);
+
+    get_left(block) = get_right(pivot);
+    if (get_right(pivot) != nullptr)
+    {
+        get_parent(get_right(pivot)) = block;
+    }
+
+    transplant(block, pivot);
+
+    get_right(pivot) = block;
+    get_parent(block) = pivot;
+}
+
+void allocator_red_black_tree::transplant(void *from, void *to) noexcept
+{
+    void *parent = get_parent(from);
+
+    if (parent == nullptr)
+    {
+        get_metadata().root = to;
+    }
+    else if (get_left(parent) == from)
+    {
+        get_left(parent) = to;
+    }
+    else
+    {
+        get_right(parent) = to;
+    }
+
+    if (to != nullptr)
+    {
+        get_parent(to) = parent;
+    }
+}
+
+void allocator_red_black_tree::tree_insert(void *block) noexcept
+{
+    get_metadata().free_bytes += get_block_size(block);
+    ++get_metadata().free_blocks_count;
+
+    void *parent = nullptr;
+
+    for (void *node = get_metadata().root; node != nullptr; )
+    {
+        parent = node;
+        node = tree_less(block, node) ? get_left(node) : get_right(node);
+    }
+
+    get_parent(block) = parent;
+    get_left(block) = nullptr;
+    get_right(block) = nullptr;
+    get_data(block).color = block_color::RED;
+
+    if (parent == nullptr)
+    {
+        get_metadata().root = block;
+    }
+    else if (tree_less(block, parent))
+    {
+        get_left(parent) = block;
+    }
+    else
+    {
+        get_right(parent) = block;
+    }
+
+    while (is_red(get_parent(block)))
+    {
+        parent = get_parent(block);
+        void *grandparent = get_parent(parent);
+
+        if (parent == get_left(grandparent))
+        {
+            void *uncle = get_right(grandparent);
+
+            if (is_red(uncle))
+            {
+                get_data(parent).color = block_color::BLACK;
+                get_data(uncle).color = block_color::BLACK;
+                get_data(grandparent).color = block_color::RED;
+                block = grandparent;
+                continue;
+            }
+
+            if (block == get_right(parent))
+            {
+                block = parent;
+                rotate_left(block);
+                parent = get_parent(block);
+            }
+
+            get_data(parent).color = block_color::BLACK;
+            get_data(grandparent).color = block_color::RED;
+            rotate_right(grandparent);
+        }
+        else
+        {
+            void *uncle = get_left(grandparent);
+
+            if (is_red(uncle))
+            {
+                get_data(parent).color = block_color::BLACK;
+                get_data(uncle).color = block_color::BLACK;
+                get_data(grandparent).color = block_color::RED;
+                block = grandparent;
+                continue;
+            }
+
+            if (block == get_left(parent))
+            {
+                block = parent;
+                rotate_right(block);
+                parent = get_parent(block);
+            }
+
+            get_data(parent).color = block_color::BLACK;
+            get_data(grandparent).color = block_color::RED;
+            rotate_left(grandparent);
+        }
+    }
+
+    get_data(get_metadata().root).color = block_color::BLACK;
+}
+
+void allocator_red_black_tree::tree_erase(void *block) noexcept
+{
+    get_metadata().free_bytes -= get_block_size(block);
+    --get_metadata().free_blocks_count;
+
+    void *replacement;
+    void *replacement_parent;
+    block_color removed_color = get_data(block).color;
+
+    if (get_left(block) == nullptr)
+    {
+        replacement = get_right(block);
+        replacement_parent = get_parent(block);
+        transplant(block, replacement);
+    }
+    else if (get_right(block) == nullptr)
+    {
+        replacement = get_left(block);
+        replacement_parent = get_parent(block);
+        transplant(block, replacement);
+    }
+    else
+    {
+        void *successor = tree_min(get_right(block));
+        removed_color = get_data(successor).color;
+        replacement = get_right(successor);
+
+        if (get_parent(successor) == block)
+        {
+            replacement_parent = successor;
+        }
+        else
+        {
+            replacement_parent = get_parent(successor);
+            transplant(successor, replacement);
+            get_right(successor) = get_right(block);
+            get_parent(get_right(successor)) = successor;
+        }
+
+        transplant(block, successor);
+        get_left(successor) = get_left(block);
+        get_parent(get_left(successor)) = successor;
+        get_data(successor).color = get_data(block).color;
+    }
+
+    if (removed_color == block_color::RED)
+    {
+        return;
+    }
+
+    // nullptr leaves are black, so the missing black height is tracked through replacement_parent
+    while (replacement != get_metadata().root && !is_red(replacement))
+    {
+        if (replacement == get_left(replacement_parent))
+        {
+            void *sibling = get_right(replacement_parent);
+
+            if (is_red(sibling))
+            {
+                get_data(sibling).color = block_color::BLACK;
+                get_data(replacement_parent).color = block_color::RED;
+                rotate_left(replacement_parent);
+                sibling = get_right(replacement_parent);
+            }
+
+            if (!is_red(get_left(sibling)) && !is_red(get_right(sibling)))
+            {
+                get_data(sibling).color = block_color::RED;
+                replacement = replacement_parent;
+                replacement_parent = get_parent(replacement);
+                continue;
+            }
+
+            if (!is_red(get_right(sibling)))
+            {
+                get_data(get_left(sibling)).color = block_color::BLACK;
+                get_data(sibling).color = block_color::RED;
+                rotate_right(sibling);
+                sibling = get_right(replacement_parent);
+            }
+
+            get_data(sibling).color = get_data(replacement_parent).color;
+            get_data(replacement_parent).color = block_color::BLACK;
+            get_data(get_right(sibling)).color = block_color::BLACK;
+            rotate_left(replacement_parent);
+        }
+        else
+        {
+            void *sibling = get_left(replacement_parent);
+
+            if (is_red(sibling))
+            {
+                get_data(sibling).color = block_color::BLACK;
+                get_data(replacement_parent).color = block_color::RED;
+                rotate_right(replacement_parent);
+                sibling = get_left(replacement_parent);
+            }
+
+            if (!is_red(get_left(sibling)) && !is_red(get_right(sibling)))
+            {
+                get_data(sibling).color = block_color::RED;
+                replacement = replacement_parent;
+                replacement_parent = get_parent(replacement);
+                continue;
+            }
+
+            if (!is_red(get_left(sibling)))
+            {
+                get_data(get_right(sibling)).color = block_color::BLACK;
+                get_data(sibling).color = block_color::RED;
+                rotate_left(sibling);
+                sibling = get_left(replacement_parent);
+            }
+
+            get_data(sibling).color = get_data(replacement_parent).color;
+            get_data(replacement_parent).color = block_color::BLACK;
+            get_data(get_left(sibling)).color = block_color::BLACK;
+            rotate_right(replacement_parent);
+        }
+
+        replacement = get_metadata().root;
+    }
+
+    if (replacement != nullptr)
+    {
+        get_data(replacement).color = block_color::BLACK;
+    }
+}
+
+void *allocator_red_black_tree::tree_min(void *block) noexcept
+{
+    while (block != nullptr && get_left(block) != nullptr)
+    {
+        block = get_left(block);
+    }
+    return block;
+}
+
+void *allocator_red_black_tree::tree_max(void *block) noexcept
+{
+    while (block != nullptr && get_right(block) != nullptr)
+    {
+        block = get_right(block);
+    }
+    return block;
+}
+
+void *allocator_red_black_tree::tree_successor(void *block) noexcept
+{
+    if (get_right(block) != nullptr)
+    {
+        return tree_min(get_right(block));
+    }
+
+    void *parent = get_parent(block);
+    while (parent != nullptr && block == get_right(parent))
+    {
+        block = parent;
+        parent = get_parent(parent);
+    }
+    return parent;
+}
+
+void *allocator_red_black_tree::tree_predecessor(void *block) noexcept
+{
+    if (get_left(block) != nullptr)
+    {
+        return tree_max(get_left(block));
+    }
+
+    void *parent = get_parent(block);
+    while (parent != nullptr && block == get_left(parent))
+    {
+        block = parent;
+        parent = get_parent(parent);
+    }
+    return parent;
+}
+
+void allocator_red_black_tree::publish_free_space() noexcept
+{
+    auto &meta = get_metadata();
+    void *largest = tree_max(meta.root);
+
+    meta.statistics.set_free_space(meta.free_bytes, largest == nullptr ? 0 : get_block_size(largest), meta.free_blocks_count);
+}
+
+void allocator_red_black_tree::destroy() noexcept
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const total_size = allocator_metadata_size + get_metadata().space_size;
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, total_size, default_alignment);
+    _trusted_memory = nullptr;
 }
 
 
 allocator_red_black_tree::rb_iterator allocator_red_black_tree::begin() const noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_red_black_tree::rb_iterator allocator_red_black_tree::end() const noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::end() const noexcept", "your code should be here...");
+    return {};
 }
 
 
 bool allocator_red_black_tree::rb_iterator::operator==(const allocator_red_black_tree::rb_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::operator==(const allocator_red_black_tree::rb_iterator &) const noexcept", "your code should be here...");
+    return _block_ptr == other._block_ptr;
 }
 
 bool allocator_red_black_tree::rb_iterator::operator!=(const allocator_red_black_tree::rb_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::operator!=(const allocator_red_black_tree::rb_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_red_black_tree::rb_iterator &allocator_red_black_tree::rb_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator &allocator_red_black_tree::rb_iterator::operator++() & noexcept", "your code should be here...");
+    _block_ptr = get_next(_block_ptr);
+    return *this;
 }
 
-allocator_red_black_tree::rb_iterator allocator_red_black_tree::rb_iterator::operator++(int n)
+allocator_red_black_tree::rb_iterator allocator_red_black_tree::rb_iterator::operator++(int)
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::rb_iterator::operator++(int)", "your code should be here...");
+    auto tmp = *this;
+    ++*this;
+    return tmp;
 }
 
 size_t allocator_red_black_tree::rb_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_red_black_tree::rb_iterator::size() const noexcept", "your code should be here...");
+    void *next = get_next(_block_ptr);
+
+    if (next == nullptr)
+    {
+        auto &metadata = *reinterpret_cast<allocator_metadata *>(_trusted);
+        next = reinterpret_cast<std::byte *>(_trusted) + allocator_metadata_size + metadata.space_size;
+    }
+
+    return reinterpret_cast<std::byte *>(next) - reinterpret_cast<std::byte *>(_block_ptr);
 }
 
 void *allocator_red_black_tree::rb_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_red_black_tree::rb_iterator::operator*() const noexcept", "your code should be here...");
+    return _block_ptr;
 }
 
-allocator_red_black_tree::rb_iterator::rb_iterator()
-{
-    throw not_implemented("allocator_red_black_tree::rb_iterator::rb_iterator()", "your code should be here...");
-}
+allocator_red_black_tree::rb_iterator::rb_iterator() : _block_ptr(nullptr), _trusted(nullptr) {}
 
-allocator_red_black_tree::rb_iterator::rb_iterator(void *trusted)
-{
-    throw not_implemented("allocator_red_black_tree::rb_iterator::rb_iterator(void *)", "your code should be here...");
-}
+allocator_red_black_tree::rb_iterator::rb_iterator(void *trusted) :
+    _block_ptr(reinterpret_cast<std::byte *>(trusted) + allocator_metadata_size),
+    _trusted(trusted) {}
 
 bool allocator_red_black_tree::rb_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::occupied() const noexcept", "your code should be here...");
+    return get_data(_block_ptr).occupied;
 }
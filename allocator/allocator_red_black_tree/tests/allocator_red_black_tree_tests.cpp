@@ -55,7 +55,7 @@ TEST(allocatorRBTPositiveTests, test1)
 													}
 												}));
 
-	std::unique_ptr<smart_mem_resource> alloc(new allocator_red_black_tree(3000, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
+	std::unique_ptr<smart_mem_resource> alloc(new allocator_red_black_tree(3100 + 3 * smart_mem_resource::guard_overhead(), nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
 
 	auto first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 250));
 
@@ -72,6 +72,37 @@ TEST(allocatorRBTPositiveTests, test1)
 
 }
 
+TEST(allocatorRBTPositiveTests, test2)
+{
+	std::unique_ptr<smart_mem_resource> alloc(new allocator_red_black_tree(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, true));
+	size_t const guard = smart_mem_resource::guard_overhead();
+	// an extra arena is an allocator of its own and guards the block once more
+	size_t const arena_guard = guard * 2;
+
+	auto first_block = alloc->allocate(sizeof(char) * 600);
+	auto second_block = alloc->allocate(sizeof(char) * 600);
+
+	std::vector<allocator_test_utils::block_info> expected_blocks_info
+		{
+			{ .block_size = 640 + guard, .is_block_occupied = true },
+			{ .block_size = 360 - guard, .is_block_occupied = false },
+			{ .block_size = 640 + arena_guard, .is_block_occupied = true },
+			{ .block_size = 360 - arena_guard, .is_block_occupied = false }
+		};
+	ASSERT_EQ(dynamic_cast<allocator_test_utils *>(alloc.get())->get_blocks_info(), expected_blocks_info);
+
+	alloc->deallocate(first_block, 1);
+	alloc->deallocate(second_block, 1);
+	alloc->flush_quarantine();
+
+	expected_blocks_info =
+		{
+			{ .block_size = 1000, .is_block_occupied = false },
+			{ .block_size = 1000, .is_block_occupied = false }
+		};
+	ASSERT_EQ(dynamic_cast<allocator_test_utils *>(alloc.get())->get_blocks_info(), expected_blocks_info);
+}
+
 TEST(allocatorRBTPositiveTests, test5)
 {
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -219,6 +250,38 @@ TEST(allocatorRBTPositiveTests, test7)
 	void* eleven = allocator->allocate(1 * 234);
 }
 
+TEST(allocatorRBTPositiveTests, test8)
+{
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_worst_fit));
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 10);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 100, 64);
+    void *third_block = allocator_instance->allocate(sizeof(char) * 40, 256);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 256, 0);
+
+    void *odd_block = allocator_instance->allocate(5, 8);
+    void *fourth_block = allocator_instance->allocate(8, 8);
+    void *fifth_block = allocator_instance->allocate(16, 16);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fourth_block) % 8, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fifth_block) % 16, 0);
+
+    allocator_instance->deallocate(odd_block, 5, 8);
+    allocator_instance->deallocate(fourth_block, 8, 8);
+    allocator_instance->deallocate(fifth_block, 16, 16);
+    allocator_instance->deallocate(second_block, 100, 64);
+    allocator_instance->deallocate(first_block, 10);
+    allocator_instance->deallocate(third_block, 40, 256);
+    allocator_instance->flush_quarantine();
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 3000);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+}
+
 
 int main(
     int argc,
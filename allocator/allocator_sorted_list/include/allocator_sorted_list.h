@@ -6,8 +6,14 @@
 #include <allocator_with_fit_mode.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <thread_local_cache.h>
+#include <arena_chain.h>
+#include <sequenced_mutex.h>
+#include <array>
+#include <cstdint>
 #include <iterator>
 #include <mutex>
+#include <optional>
 
 class allocator_sorted_list final:
     public smart_mem_resource,
@@ -19,11 +25,55 @@ class allocator_sorted_list final:
 
 private:
     
+    /** Lives at the beginning of trusted memory, blocks follow it.
+     *  Statistics cover the own space only and count blocks in thread stocks as occupied,
+     *  the largest free block is searched again only after it gets taken.
+     *  Block walks read the blocks without the mutex and start over when it was taken meanwhile
+     */
+    struct allocator_metadata
+    {
+        logger *logger_ptr;
+        std::pmr::memory_resource *parent_allocator;
+        allocator_with_fit_mode::fit_mode mode;
+        size_t space_size;
+        sequenced_mutex mutex{};
+        void *first_free = nullptr;
+        std::optional<thread_local_cache> cache{};
+        std::optional<arena_chain> arenas{};
+        uint64_t bins_bitmap = 0;
+        std::array<void *, sizeof(uint64_t) * 8> bins{};
+        allocation_statistics statistics{};
+        size_t occupied_bytes = 0;
+        size_t free_blocks_count = 0;
+        size_t largest_free = 0;
+        bool largest_free_stale = false;
+    };
+
+    /** next points to the next free block for free blocks and to trusted memory for occupied ones */
+    struct block_metadata
+    {
+        size_t size;
+        void *next;
+    };
+
+    /** Kept at the beginning of a free block payload in segregated_fit mode. Blocks too small for it stay
+     *  in the address-ordered list only, small requests missing the bins look for them there.
+     *  Bin i holds blocks with payload in [2^i, 2^(i+1))
+     */
+    struct free_block_links
+    {
+        void *prev_free;
+        void *bin_prev;
+        void *bin_next;
+    };
+
     void *_trusted_memory;
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(std::pmr::memory_resource *) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(void*);
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(allocator_metadata), default_alignment);
 
-    static constexpr const size_t block_metadata_size = sizeof(void*) + sizeof(size_t);
+    static constexpr const size_t block_metadata_size = sizeof(block_metadata);
+
+    static constexpr const size_t min_binned_size = sizeof(free_block_links);
 
 public:
 
@@ -31,13 +81,15 @@ public:
             size_t space_size,
             std::pmr::memory_resource *parent_allocator = nullptr,
             logger *logger = nullptr,
-            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+            bool use_thread_cache = false,
+            bool growable = false);
     
     allocator_sorted_list(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
     
     allocator_sorted_list &operator=(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
 
     allocator_sorted_list(
         allocator_sorted_list &&other) noexcept;
@@ -60,9 +112,137 @@ public:
 
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
 
+    /** Runs without the mutex unless thread stocks or arenas are on, or writers keep interrupting the walk */
+    void visit_blocks(
+        block_visitor &visitor) const override;
+
+    allocation_statistics::snapshot get_statistics() const noexcept override;
+
 private:
 
+    [[nodiscard]] void *do_allocate_aligned_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_aligned_sm(
+        void *at,
+        size_t alignment) override;
+
+    /** Takes the free block right behind, what is left of it stays free if it can still hold a header */
+    bool do_try_expand_sm(
+        void *at,
+        size_t new_size) override;
+
+    /** Cuts the tail off as a block of its own and frees it, so it merges with a free neighbour */
+    bool do_shrink_sm(
+        void *at,
+        size_t new_size) override;
+
+    /** Carves the blocks one after another out of the free block left behind the previous one,
+     *  a new free block is searched for only when that one runs out
+     */
+    void do_allocate_batch_sm(
+        size_t size,
+        size_t count,
+        void **out) override;
+
+    void do_deallocate_batch_sm(
+        void *const *at,
+        size_t count) override;
+
+    void *allocate_inner(
+        size_t size,
+        size_t alignment);
+
+    /** Block sizes are kept multiples of default_alignment, so a block placed right behind another one starts aligned */
+    static size_t round_size(
+        size_t size) noexcept;
+
+    /** nullptr when no free block fits, mutex must be held */
+    void *allocate_unlocked(
+        size_t size,
+        size_t alignment);
+
+    /** User pointer inside the free block chosen by the fit mode, nullptr when none fits.
+     *  found gets the block and prev_found the free block before it
+     */
+    std::byte *find_free(
+        size_t size,
+        size_t alignment,
+        void *&prev_found,
+        void *&found);
+
+    /** Occupies the request at user inside the free block found. Afterwards prev_found precedes rest,
+     *  the free block left behind the request or nullptr. Free space is not published
+     */
+    std::byte *carve(
+        void *&prev_found,
+        void *found,
+        std::byte *user,
+        size_t size,
+        void *&rest);
+
+    void deallocate_unlocked(
+        void *at);
+
+    /** Own blocks go to deallocate_unlocked, others to the arena holding them, mutex must be held */
+    void deallocate_batch_unlocked(
+        void *const *at,
+        size_t count);
+
+    /** Puts an occupied block into the free list merging it with free neighbours, mutex must be held */
+    void release_unlocked(
+        void *block);
+
+    /** Another allocator of the same space size taken from the parent allocator */
+    arena_chain::arena make_arena() const;
+
+    /** Refills the calling thread stock with blocks of the class and returns one of them */
+    void *allocate_cached(
+        size_t size_class);
+
+    /** Gives blocks from thread stocks back to the shared list, mutex must be held */
+    void release_cached(
+        std::vector<void *> const &blocks);
+
     std::vector<allocator_test_utils::block_info> get_blocks_info_inner() const override;
+
+    /** Blocks with thread stocks and arenas taken into account, takes the mutex */
+    std::vector<allocator_test_utils::block_info> get_blocks_info_locked() const;
+
+    /** Walks the own blocks reading them through sequenced_mutex::load, false as soon as
+     *  what it reads cannot be a consistent heap. Writers change what it reads through sequenced_mutex::store
+     */
+    bool walk_blocks(
+        block_visitor &visitor) const;
+
+    allocator_metadata &get_metadata() const noexcept;
+
+    static block_metadata &get_block(void *block) noexcept;
+
+    static free_block_links &get_links(void *block) noexcept;
+
+    /** User pointer for the request inside a free block, nullptr if it does not fit */
+    static std::byte *place_in(void *block, size_t size, size_t alignment) noexcept;
+
+    /** Free block from the first non-empty bin that surely fits, the bin below is scanned as a fallback */
+    void *find_in_bins(size_t size, size_t alignment) const noexcept;
+
+    void bin_insert(void *block) noexcept;
+
+    void bin_erase(void *block) noexcept;
+
+    /** Sorts the whole free list into bins when segregated_fit gets switched on */
+    void rebuild_bins() noexcept;
+
+    /** Stores the free space shape into statistics, mutex must be held */
+    void publish_free_space() noexcept;
+
+    void *blocks_begin() const noexcept;
+
+    void *blocks_end() const noexcept;
+
+    void destroy() noexcept;
     
     inline logger *get_logger() const override;
     
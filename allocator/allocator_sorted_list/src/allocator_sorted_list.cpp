@@ -1,190 +1,1207 @@
-#include <not_implemented.h>
 #include "../include/allocator_sorted_list.h"
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <new>
+#include <thread>
 
 allocator_sorted_list::~allocator_sorted_list()
 {
-    throw not_implemented("allocator_sorted_list::~allocator_sorted_list()", "your code should be here...");
+    debug_with_guard([&] { return get_typename() + "::~allocator_sorted_list() called"; });
+    destroy();
 }
 
 allocator_sorted_list::allocator_sorted_list(
-    allocator_sorted_list &&other) noexcept
+    allocator_sorted_list &&other) noexcept : _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(allocator_sorted_list &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_sorted_list &allocator_sorted_list::operator=(
     allocator_sorted_list &&other) noexcept
 {
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(allocator_sorted_list &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        destroy();
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+    return *this;
 }
 
 allocator_sorted_list::allocator_sorted_list(
         size_t space_size,
         std::pmr::memory_resource *parent_allocator,
         logger *logger,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode)
+        allocator_with_fit_mode::fit_mode allocate_fit_mode,
+        bool use_thread_cache,
+        bool growable)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(size_t, std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < block_metadata_size)
+    {
+        if (logger != nullptr)
+        {
+            logger->error("allocator_sorted_list: space size is too small to hold a single block");
+        }
+        throw std::logic_error("allocator_sorted_list: space size is too small to hold a single block");
+    }
+
+    if (parent_allocator == nullptr)
+    {
+        parent_allocator = std::pmr::get_default_resource();
+    }
+
+    _trusted_memory = parent_allocator->allocate(allocator_metadata_size + space_size, default_alignment);
+
+    auto *metadata = new (_trusted_memory) allocator_metadata
+        {
+            .logger_ptr = logger,
+            .parent_allocator = parent_allocator,
+            .mode = allocate_fit_mode,
+            .space_size = space_size
+        };
+    metadata->first_free = blocks_begin();
+
+    if (use_thread_cache)
+    {
+        metadata->cache.emplace();
+    }
+
+    if (growable)
+    {
+        metadata->arenas.emplace();
+    }
+
+    auto &first = get_block(metadata->first_free);
+    first.size = space_size - block_metadata_size;
+    first.next = nullptr;
+
+    if (allocate_fit_mode == fit_mode::segregated_fit)
+    {
+        rebuild_bins();
+    }
+
+    metadata->free_blocks_count = 1;
+    metadata->largest_free = space_size;
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::allocator_sorted_list(size_t, std::pmr::memory_resource *, logger *, fit_mode) finished"; });
 }
 
 [[nodiscard]] void *allocator_sorted_list::do_allocate_sm(
     size_t size)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_sorted_list::do_allocate_sm(size_t)", "your code should be here...");
+    auto &cache = get_metadata().cache;
+
+    if (cache)
+    {
+        size_t const size_class = thread_local_cache::size_class(size);
+
+        if (size_class != thread_local_cache::size_classes_count)
+        {
+            void *block = cache->pop(size_class);
+            return block != nullptr ? block : allocate_cached(size_class);
+        }
+    }
+
+    return allocate_inner(size, default_alignment);
+}
+
+size_t allocator_sorted_list::round_size(
+    size_t size) noexcept
+{
+    // a size no block can take stays as it is and fails the search
+    return size > std::numeric_limits<size_t>::max() - default_alignment ? size : align_up(size, default_alignment);
+}
+
+[[nodiscard]] void *allocator_sorted_list::do_allocate_aligned_sm(
+    size_t size,
+    size_t alignment)
+{
+    return allocate_inner(size, alignment);
+}
+
+void *allocator_sorted_list::allocate_inner(
+    size_t size,
+    size_t alignment)
+{
+    size = round_size(size);
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") started"; });
+
+    auto own_allocate = [this, size, alignment]
+    {
+        void *user = allocate_unlocked(size, alignment);
+
+        if (user == nullptr && get_metadata().cache)
+        {
+            // blocks resting in thread stocks may be what the request is missing
+            std::vector<void *> cached;
+            get_metadata().cache->collect(cached, true);
+            release_cached(cached);
+            user = allocate_unlocked(size, alignment);
+        }
+
+        return user;
+    };
+
+    void *user = get_metadata().arenas
+        ? get_metadata().arenas->allocate(size, alignment, own_allocate, [this] { return make_arena(); })
+        : own_allocate();
+
+    if (user == nullptr)
+    {
+        get_metadata().statistics.on_failure();
+        error_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): no suitable free block"; });
+        throw std::bad_alloc();
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + ") finished"; });
+
+    return user;
+}
+
+void *allocator_sorted_list::allocate_unlocked(
+    size_t size,
+    size_t alignment)
+{
+    void *prev_found = nullptr, *found = nullptr, *rest = nullptr;
+    std::byte *user = find_free(size, alignment, prev_found, found);
+
+    if (user == nullptr)
+    {
+        return nullptr;
+    }
+
+    user = carve(prev_found, found, user, size, rest);
+    publish_free_space();
+
+    return user;
+}
+
+std::byte *allocator_sorted_list::find_free(
+    size_t size,
+    size_t alignment,
+    void *&prev_found,
+    void *&found)
+{
+    auto const mode = get_metadata().mode;
+
+    std::byte *found_user = nullptr;
+    size_t found_size = 0;
+    prev_found = nullptr;
+    found = nullptr;
+
+    if (mode == fit_mode::segregated_fit)
+    {
+        found = find_in_bins(size, alignment);
+
+        if (found != nullptr)
+        {
+            prev_found = get_links(found).prev_free;
+            return place_in(found, size, alignment);
+        }
+
+        // blocks too small for a bin are reachable through the list only, and only small requests fit them
+        if (size >= min_binned_size)
+        {
+            return nullptr;
+        }
+    }
+
+    void *prev = nullptr;
+    for (auto it = free_begin(), end = free_end(); it != end; prev = *it, ++it)
+    {
+        auto *user = mode == fit_mode::segregated_fit && it.size() >= min_binned_size
+            ? nullptr
+            : place_in(*it, size, alignment);
+
+        if (user == nullptr)
+        {
+            continue;
+        }
+
+        if (found == nullptr ||
+            (mode == fit_mode::the_best_fit && it.size() < found_size) ||
+            (mode == fit_mode::the_worst_fit && it.size() > found_size))
+        {
+            prev_found = prev;
+            found = *it;
+            found_user = user;
+            found_size = it.size();
+        }
+
+        if (mode == fit_mode::first_fit || mode == fit_mode::segregated_fit)
+        {
+            break;
+        }
+    }
+
+    return found_user;
+}
+
+std::byte *allocator_sorted_list::carve(
+    void *&prev_found,
+    void *found,
+    std::byte *user,
+    size_t size,
+    void *&rest)
+{
+    bool const segregated = get_metadata().mode == fit_mode::segregated_fit;
+    size_t const found_size = get_block(found).size;
+
+    if (segregated && found_size >= min_binned_size)
+    {
+        bin_erase(found);
+    }
+
+    auto *block = reinterpret_cast<std::byte *>(found);
+    auto *block_end = block + block_metadata_size + found_size;
+    void *const following_free = get_block(found).next;
+    void *next_free = following_free;
+    rest = nullptr;
+
+    if (user != block + block_metadata_size)
+    {
+        // the front gap stays in the free list on its own
+        sequenced_mutex::store(get_block(block).size, user - block - 2 * block_metadata_size);
+        prev_found = block;
+
+        if (segregated && get_block(block).size >= min_binned_size)
+        {
+            bin_insert(block);
+        }
+    }
+
+    auto *occupied = user - block_metadata_size;
+    size_t tail = block_end - user - size;
+
+    if (tail >= block_metadata_size)
+    {
+        rest = user + size;
+        sequenced_mutex::store(get_block(rest).size, tail - block_metadata_size);
+        sequenced_mutex::store(get_block(rest).next, next_free);
+        next_free = rest;
+    }
+    else
+    {
+        if (tail != 0)
+        {
+            warning_with_guard([&] { return get_typename() + "::do_allocate_sm(" + std::to_string(size) + "): block size changed to " + std::to_string(size + tail); });
+        }
+        size += tail;
+    }
+
+    if (prev_found == nullptr)
+    {
+        get_metadata().first_free = next_free;
+    }
+    else
+    {
+        sequenced_mutex::store(get_block(prev_found).next, next_free);
+    }
+
+    sequenced_mutex::store(get_block(occupied).size, size);
+    sequenced_mutex::store(get_block(occupied).next, _trusted_memory);
+
+    auto &meta = get_metadata();
+    meta.occupied_bytes += block_metadata_size + size;
+    meta.free_blocks_count += (prev_found == block) + (rest != nullptr) - 1;
+    meta.largest_free_stale |= block_metadata_size + found_size == meta.largest_free;
+    meta.statistics.on_allocate(block_metadata_size + size);
+
+    if (segregated)
+    {
+        void *last_free = prev_found;
+
+        if (rest != nullptr)
+        {
+            if (get_block(rest).size >= min_binned_size)
+            {
+                get_links(rest).prev_free = prev_found;
+                bin_insert(rest);
+            }
+            last_free = rest;
+        }
+
+        if (following_free != nullptr && get_block(following_free).size >= min_binned_size)
+        {
+            get_links(following_free).prev_free = last_free;
+        }
+    }
+
+    return user;
+}
+
+void *allocator_sorted_list::allocate_cached(
+    size_t size_class)
+{
+    size_t const size = thread_local_cache::class_size(size_class);
+    std::array<void *, thread_local_cache::batch_size> blocks;
+    size_t count = 0;
+
+    {
+        std::lock_guard lock(get_metadata().mutex);
+
+        std::vector<void *> parked;
+        get_metadata().cache->collect(parked, false);
+        release_cached(parked);
+
+        while (count < blocks.size() && (blocks[count] = allocate_unlocked(size, default_alignment)) != nullptr)
+        {
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return allocate_inner(size, default_alignment);
+    }
+
+    get_metadata().cache->fill(size_class, blocks.data() + 1, count - 1);
+
+    return blocks[0];
 }
 
-allocator_sorted_list::allocator_sorted_list(const allocator_sorted_list &other)
+void allocator_sorted_list::do_allocate_batch_sm(
+    size_t size,
+    size_t count,
+    void **out)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(const allocator_sorted_list &other)", "your code should be here...");
+    size = round_size(size);
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + ") started"; });
+
+    void *prev = nullptr, *rest = nullptr;
+    bool own_space_exhausted = false, cache_collected = false;
+
+    for (size_t taken = 0; taken < count; ++taken)
+    {
+        void *found = rest;
+        std::byte *user = found == nullptr ? nullptr : place_in(found, size, default_alignment);
+
+        if (user == nullptr && !own_space_exhausted && (user = find_free(size, default_alignment, prev, found)) == nullptr &&
+            get_metadata().cache && !cache_collected)
+        {
+            // blocks resting in thread stocks may be what the batch is missing
+            std::vector<void *> cached;
+            get_metadata().cache->collect(cached, true);
+            release_cached(cached);
+            cache_collected = true;
+            user = find_free(size, default_alignment, prev, found);
+        }
+
+        if (user != nullptr)
+        {
+            out[taken] = carve(prev, found, user, size, rest);
+            continue;
+        }
+
+        own_space_exhausted = true;
+        rest = nullptr;
+        out[taken] = get_metadata().arenas
+            ? get_metadata().arenas->allocate(size, default_alignment, [] { return nullptr; }, [this] { return make_arena(); })
+            : nullptr;
+
+        if (out[taken] == nullptr)
+        {
+            deallocate_batch_unlocked(out, taken);
+            get_metadata().statistics.on_failure();
+            error_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + "): no suitable free block"; });
+            throw std::bad_alloc();
+        }
+    }
+
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::allocate_batch(" + std::to_string(size) + ", " + std::to_string(count) + ") finished"; });
+}
+
+arena_chain::arena allocator_sorted_list::make_arena() const
+{
+    auto *created = new allocator_sorted_list(get_metadata().space_size, get_metadata().parent_allocator, nullptr, get_metadata().mode);
+
+    return { .resource = std::unique_ptr<smart_mem_resource>(created), .begin = created->blocks_begin(), .end = created->blocks_end() };
 }
 
-allocator_sorted_list &allocator_sorted_list::operator=(const allocator_sorted_list &other)
+void allocator_sorted_list::release_cached(
+    std::vector<void *> const &blocks)
 {
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(const allocator_sorted_list &other)", "your code should be here...");
+    for (void *block : blocks)
+    {
+        deallocate_unlocked(block);
+    }
 }
 
 bool allocator_sorted_list::do_is_equal(const std::pmr::memory_resource &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    auto p = dynamic_cast<const allocator_sorted_list*>(&other);
+
+    return p != nullptr && p->_trusted_memory == _trusted_memory;
 }
 
 void allocator_sorted_list::do_deallocate_sm(
     void *at)
 {
-    throw not_implemented("void allocator_sorted_list::do_deallocate_sm(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    auto &cache = get_metadata().cache;
+    auto *block = reinterpret_cast<std::byte *>(at) - block_metadata_size;
+
+    // only blocks cut exactly to a size class go back to the thread stock
+    if (cache && block >= blocks_begin() && block < blocks_end() && get_block(block).next == _trusted_memory)
+    {
+        size_t const size_class = thread_local_cache::size_class(get_block(block).size);
+
+        if (size_class != thread_local_cache::size_classes_count &&
+            thread_local_cache::class_size(size_class) == get_block(block).size)
+        {
+            std::array<void *, thread_local_cache::batch_size> overflow;
+            size_t const released = cache->push(size_class, at, overflow.data());
+
+            if (released != 0)
+            {
+                std::lock_guard lock(get_metadata().mutex);
+                release_cached(std::vector<void *>(overflow.begin(), overflow.begin() + released));
+            }
+
+            return;
+        }
+    }
+
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) started"; });
+
+    if (!get_metadata().arenas || (block >= blocks_begin() && block < blocks_end()) || !get_metadata().arenas->deallocate(at))
+    {
+        deallocate_unlocked(at);
+    }
+
+    debug_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *) finished"; });
+}
+
+void allocator_sorted_list::deallocate_unlocked(
+    void *at)
+{
+    auto *block = reinterpret_cast<std::byte *>(at) - block_metadata_size;
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).next != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::do_deallocate_sm(void *): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_sorted_list: block does not belong to this allocator");
+    }
+
+    get_metadata().statistics.on_deallocate(block_metadata_size + get_block(block).size);
+    release_unlocked(block);
+}
+
+void allocator_sorted_list::do_deallocate_batch_sm(
+    void *const *at,
+    size_t count)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::deallocate_batch(" + std::to_string(count) + ") started"; });
+
+    deallocate_batch_unlocked(at, count);
+
+    debug_with_guard([&] { return get_typename() + "::deallocate_batch(" + std::to_string(count) + ") finished"; });
+}
+
+void allocator_sorted_list::deallocate_batch_unlocked(
+    void *const *at,
+    size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto *block = reinterpret_cast<std::byte *>(at[i]) - block_metadata_size;
+
+        if (at[i] != nullptr &&
+            (!get_metadata().arenas || (block >= blocks_begin() && block < blocks_end()) || !get_metadata().arenas->deallocate(at[i])))
+        {
+            deallocate_unlocked(at[i]);
+        }
+    }
+}
+
+void allocator_sorted_list::release_unlocked(
+    void *block)
+{
+    bool const segregated = get_metadata().mode == fit_mode::segregated_fit;
+
+    auto &meta = get_metadata();
+    meta.occupied_bytes -= block_metadata_size + get_block(block).size;
+    ++meta.free_blocks_count;
+
+    void *prev_prev = nullptr;
+    void *prev = nullptr;
+    void *next = get_metadata().first_free;
+    while (next != nullptr && next < block)
+    {
+        prev_prev = prev;
+        prev = next;
+        next = get_block(next).next;
+    }
+
+    sequenced_mutex::store(get_block(block).next, next);
+
+    if (next != nullptr && reinterpret_cast<std::byte *>(block) + block_metadata_size + get_block(block).size == next)
+    {
+        if (segregated && get_block(next).size >= min_binned_size)
+        {
+            bin_erase(next);
+        }
+
+        sequenced_mutex::store(get_block(block).size, get_block(block).size + block_metadata_size + get_block(next).size);
+        sequenced_mutex::store(get_block(block).next, get_block(next).next);
+        --meta.free_blocks_count;
+    }
+
+    void *merged = block;
+    void *merged_prev = prev;
+
+    if (prev == nullptr)
+    {
+        get_metadata().first_free = block;
+    }
+    else if (reinterpret_cast<std::byte *>(prev) + block_metadata_size + get_block(prev).size == block)
+    {
+        if (segregated && get_block(prev).size >= min_binned_size)
+        {
+            bin_erase(prev);
+        }
+
+        sequenced_mutex::store(get_block(prev).size, get_block(prev).size + block_metadata_size + get_block(block).size);
+        sequenced_mutex::store(get_block(prev).next, get_block(block).next);
+        merged = prev;
+        merged_prev = prev_prev;
+        --meta.free_blocks_count;
+    }
+    else
+    {
+        sequenced_mutex::store(get_block(prev).next, block);
+    }
+
+    if (segregated)
+    {
+        if (get_block(merged).size >= min_binned_size)
+        {
+            get_links(merged).prev_free = merged_prev;
+            bin_insert(merged);
+        }
+
+        void *following_free = get_block(merged).next;
+        if (following_free != nullptr && get_block(following_free).size >= min_binned_size)
+        {
+            get_links(following_free).prev_free = merged;
+        }
+    }
+
+    meta.largest_free = std::max(meta.largest_free, block_metadata_size + get_block(merged).size);
+    publish_free_space();
+}
+
+void allocator_sorted_list::do_deallocate_aligned_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
+}
+
+bool allocator_sorted_list::do_try_expand_sm(
+    void *at,
+    size_t new_size)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::try_expand(void *, " + std::to_string(new_size) + ") started"; });
+
+    auto *block = reinterpret_cast<std::byte *>(at) - block_metadata_size;
+
+    if (get_metadata().arenas && (block < blocks_begin() || block >= blocks_end()))
+    {
+        if (auto *arena = get_metadata().arenas->find(at); arena != nullptr)
+        {
+            return arena->try_expand(at, new_size);
+        }
+    }
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).next != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::try_expand(void *, size_t): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_sorted_list: block does not belong to this allocator");
+    }
+
+    size_t const old_size = get_block(block).size;
+
+    if (new_size <= old_size)
+    {
+        return true;
+    }
+
+    auto *next = reinterpret_cast<std::byte *>(at) + old_size;
+
+    if (next == blocks_end() || get_block(next).next == _trusted_memory ||
+        old_size + block_metadata_size + get_block(next).size < new_size)
+    {
+        return false;
+    }
+
+    auto &meta = get_metadata();
+    bool const segregated = meta.mode == fit_mode::segregated_fit;
+    size_t const next_size = get_block(next).size;
+    void *const following = get_block(next).next;
+    size_t const available = old_size + block_metadata_size + next_size;
+
+    // only the arena tail may end unaligned, there the block takes what is left
+    new_size = std::min(round_size(new_size), available);
+
+    void *prev = nullptr;
+    for (void *it = meta.first_free; it != next; it = get_block(it).next)
+    {
+        prev = it;
+    }
+
+    if (segregated && next_size >= min_binned_size)
+    {
+        bin_erase(next);
+    }
+
+    // the header of the free block moves forward, or the block is gone when the rest cannot hold a header
+    void *rest = nullptr;
+    if (available - new_size >= block_metadata_size)
+    {
+        rest = reinterpret_cast<std::byte *>(at) + new_size;
+        sequenced_mutex::store(get_block(rest).size, available - new_size - block_metadata_size);
+        sequenced_mutex::store(get_block(rest).next, following);
+    }
+    else
+    {
+        new_size = available;
+        --meta.free_blocks_count;
+    }
+
+    sequenced_mutex::store(prev == nullptr ? meta.first_free : get_block(prev).next, rest == nullptr ? following : rest);
+
+    if (segregated)
+    {
+        if (rest != nullptr && get_block(rest).size >= min_binned_size)
+        {
+            get_links(rest).prev_free = prev;
+            bin_insert(rest);
+        }
+
+        if (following != nullptr && get_block(following).size >= min_binned_size)
+        {
+            get_links(following).prev_free = rest == nullptr ? prev : rest;
+        }
+    }
+
+    meta.occupied_bytes += new_size - old_size;
+    meta.largest_free_stale |= block_metadata_size + next_size == meta.largest_free;
+    meta.statistics.on_resize(block_metadata_size + old_size, block_metadata_size + new_size);
+    sequenced_mutex::store(get_block(block).size, new_size);
+    publish_free_space();
+
+    debug_with_guard([&] { return get_typename() + "::try_expand(void *, " + std::to_string(new_size) + ") finished"; });
+
+    return true;
+}
+
+bool allocator_sorted_list::do_shrink_sm(
+    void *at,
+    size_t new_size)
+{
+    std::lock_guard lock(get_metadata().mutex);
+
+    debug_with_guard([&] { return get_typename() + "::shrink(void *, " + std::to_string(new_size) + ") started"; });
+
+    auto *block = reinterpret_cast<std::byte *>(at) - block_metadata_size;
+
+    if (get_metadata().arenas && (block < blocks_begin() || block >= blocks_end()))
+    {
+        if (auto *arena = get_metadata().arenas->find(at); arena != nullptr)
+        {
+            return arena->shrink(at, new_size);
+        }
+    }
+
+    if (block < blocks_begin() || block >= blocks_end() || get_block(block).next != _trusted_memory)
+    {
+        error_with_guard([&] { return get_typename() + "::shrink(void *, size_t): block does not belong to this allocator"; });
+        throw std::logic_error("allocator_sorted_list: block does not belong to this allocator");
+    }
+
+    size_t const old_size = get_block(block).size;
+    new_size = round_size(new_size);
+
+    if (new_size >= old_size || old_size - new_size < block_metadata_size)
+    {
+        return false;
+    }
+
+    void *tail = reinterpret_cast<std::byte *>(at) + new_size;
+    sequenced_mutex::store(get_block(tail).size, old_size - new_size - block_metadata_size);
+    sequenced_mutex::store(get_block(tail).next, _trusted_memory);
+    sequenced_mutex::store(get_block(block).size, new_size);
+
+    get_metadata().statistics.on_resize(block_metadata_size + old_size, block_metadata_size + new_size);
+    release_unlocked(tail);
+
+    debug_with_guard([&] { return get_typename() + "::shrink(void *, " + std::to_string(new_size) + ") finished"; });
+
+    return true;
 }
 
 inline void allocator_sorted_list::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_sorted_list::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_metadata().mutex);
+
+    if (mode == fit_mode::segregated_fit && get_metadata().mode != fit_mode::segregated_fit)
+    {
+        rebuild_bins();
+    }
+
+    get_metadata().mode = mode;
+
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([mode](smart_mem_resource &arena)
+        {
+            dynamic_cast<allocator_with_fit_mode &>(arena).set_fit_mode(mode);
+        });
+    }
 }
 
 std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept", "your code should be here...");
+    blocks_collector collector;
+    visit_blocks(collector);
+    return std::move(collector.blocks);
+}
+
+void allocator_sorted_list::visit_blocks(
+    block_visitor &visitor) const
+{
+    auto &meta = get_metadata();
+
+    for (size_t pass = 0; pass < optimistic_passes; ++pass)
+    {
+        uint64_t const seen = meta.mutex.read_begin();
+        if (seen & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // thread stocks and arenas are read under the sequence check too, blocks they hold take the mutex
+        if (meta.cache || meta.arenas)
+        {
+            break;
+        }
+
+        visitor.reset();
+        if (walk_blocks(visitor) && meta.mutex.read_validate(seen))
+        {
+            return;
+        }
+    }
+
+    visitor.reset();
+    for (auto const &block : get_blocks_info_locked())
+    {
+        visitor.visit(block);
+    }
+}
+
+std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info_locked() const
+{
+    std::lock_guard lock(get_metadata().mutex);
+    std::vector<allocator_test_utils::block_info> res;
+
+    if (!get_metadata().cache)
+    {
+        res = get_blocks_info_inner();
+    }
+    else
+    {
+        // blocks in thread stocks are free for the user even though the shared list sees them as occupied
+        get_metadata().cache->visit([this, &res](std::vector<void *> const &cached)
+        {
+            for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+            {
+                void *user = reinterpret_cast<std::byte *>(*it) + block_metadata_size;
+                res.push_back({ .block_size = it.size() + block_metadata_size,
+                                .is_block_occupied = it.occupied() && !std::binary_search(cached.begin(), cached.end(), user) });
+            }
+        });
+    }
+
+    // blocks of extra arenas follow the own ones, arena by arena
+    if (get_metadata().arenas)
+    {
+        get_metadata().arenas->for_each([&res](smart_mem_resource &arena)
+        {
+            auto arena_blocks = dynamic_cast<allocator_test_utils &>(arena).get_blocks_info();
+            res.insert(res.end(), arena_blocks.begin(), arena_blocks.end());
+        });
+    }
+
+    return res;
+}
+
+allocation_statistics::snapshot allocator_sorted_list::get_statistics() const noexcept
+{
+    return get_metadata().statistics.get();
+}
+
+void allocator_sorted_list::publish_free_space() noexcept
+{
+    auto &meta = get_metadata();
+
+    if (meta.largest_free_stale)
+    {
+        meta.largest_free = 0;
+        for (auto it = free_begin(), sentinel = free_end(); it != sentinel; ++it)
+        {
+            meta.largest_free = std::max(meta.largest_free, block_metadata_size + it.size());
+        }
+        meta.largest_free_stale = false;
+    }
+
+    meta.statistics.set_free_space(meta.space_size - meta.occupied_bytes, meta.largest_free, meta.free_blocks_count);
 }
 
 inline logger *allocator_sorted_list::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_sorted_list::get_logger() const", "your code should be here...");
+    return _trusted_memory == nullptr ? nullptr : get_metadata().logger_ptr;
 }
 
 inline std::string allocator_sorted_list::get_typename() const
 {
-    throw not_implemented("inline std::string allocator_sorted_list::get_typename() const", "your code should be here...");
+    return "allocator_sorted_list";
 }
 
 
 std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> res;
+
+    for (auto it = begin(), sentinel = end(); it != sentinel; ++it)
+    {
+        res.push_back({ .block_size = it.size() + block_metadata_size, .is_block_occupied = it.occupied() });
+    }
+
+    return res;
+}
+
+bool allocator_sorted_list::walk_blocks(
+    block_visitor &visitor) const
+{
+    auto *cursor = reinterpret_cast<std::byte *>(blocks_begin());
+    auto *const end = reinterpret_cast<std::byte *>(blocks_end());
+
+    while (cursor != end)
+    {
+        if (static_cast<size_t>(end - cursor) < block_metadata_size)
+        {
+            return false;
+        }
+
+        auto const &block = *reinterpret_cast<block_metadata const *>(cursor);
+        size_t const size = sequenced_mutex::load(block.size);
+
+        if (size > static_cast<size_t>(end - cursor) - block_metadata_size)
+        {
+            return false;
+        }
+
+        visitor.visit({ .block_size = block_metadata_size + size,
+                        .is_block_occupied = sequenced_mutex::load(block.next) == _trusted_memory });
+        cursor += block_metadata_size + size;
+    }
+
+    return true;
+}
+
+allocator_sorted_list::allocator_metadata &allocator_sorted_list::get_metadata() const noexcept
+{
+    return *reinterpret_cast<allocator_metadata *>(_trusted_memory);
+}
+
+allocator_sorted_list::block_metadata &allocator_sorted_list::get_block(void *block) noexcept
+{
+    return *reinterpret_cast<block_metadata *>(block);
+}
+
+allocator_sorted_list::free_block_links &allocator_sorted_list::get_links(void *block) noexcept
+{
+    return *reinterpret_cast<free_block_links *>(reinterpret_cast<std::byte *>(block) + block_metadata_size);
+}
+
+std::byte *allocator_sorted_list::place_in(void *block, size_t size, size_t alignment) noexcept
+{
+    auto *start = reinterpret_cast<std::byte *>(block);
+    auto *block_end = start + block_metadata_size + get_block(block).size;
+
+    // the gap in front of an aligned block must be able to hold a free block itself
+    auto *user = reinterpret_cast<std::byte *>(align_up(start + block_metadata_size, alignment));
+    if (user != start + block_metadata_size && static_cast<size_t>(user - start) < 2 * block_metadata_size)
+    {
+        user = reinterpret_cast<std::byte *>(align_up(start + 2 * block_metadata_size, alignment));
+    }
+
+    return user <= block_end && static_cast<size_t>(block_end - user) >= size ? user : nullptr;
+}
+
+void *allocator_sorted_list::find_in_bins(size_t size, size_t alignment) const noexcept
+{
+    auto const &metadata = get_metadata();
+
+    // blocks start at default_alignment, so only a stricter one needs room for the worst padding
+    size_t const padding = alignment <= default_alignment ? 0 : alignment - 1 + 2 * block_metadata_size;
+    size_t const needed = size + padding;
+
+    if (needed < size)
+    {
+        return nullptr;
+    }
+
+    size_t const first_bin = needed <= 1 ? 0 : std::bit_width(needed - 1);
+
+    if (first_bin < metadata.bins.size())
+    {
+        uint64_t const candidates = metadata.bins_bitmap & (~uint64_t(0) << first_bin);
+
+        if (candidates != 0)
+        {
+            return metadata.bins[std::countr_zero(candidates)];
+        }
+    }
+
+    if (first_bin == 0)
+    {
+        return nullptr;
+    }
+
+    for (void *block = metadata.bins[std::min(first_bin, metadata.bins.size()) - 1]; block != nullptr; block = get_links(block).bin_next)
+    {
+        if (place_in(block, size, alignment) != nullptr)
+        {
+            return block;
+        }
+    }
+
+    return nullptr;
+}
+
+void allocator_sorted_list::bin_insert(void *block) noexcept
+{
+    auto &metadata = get_metadata();
+    size_t const bin = std::bit_width(get_block(block).size) - 1;
+
+    auto &links = get_links(block);
+    sequenced_mutex::store(links.bin_prev, nullptr);
+    sequenced_mutex::store(links.bin_next, metadata.bins[bin]);
+
+    if (links.bin_next != nullptr)
+    {
+        sequenced_mutex::store(get_links(links.bin_next).bin_prev, block);
+    }
+
+    metadata.bins[bin] = block;
+    metadata.bins_bitmap |= uint64_t(1) << bin;
+}
+
+void allocator_sorted_list::bin_erase(void *block) noexcept
+{
+    auto &metadata = get_metadata();
+    size_t const bin = std::bit_width(get_block(block).size) - 1;
+
+    auto &links = get_links(block);
+
+    if (links.bin_prev == nullptr)
+    {
+        metadata.bins[bin] = links.bin_next;
+    }
+    else
+    {
+        sequenced_mutex::store(get_links(links.bin_prev).bin_next, links.bin_next);
+    }
+
+    if (links.bin_next != nullptr)
+    {
+        sequenced_mutex::store(get_links(links.bin_next).bin_prev, links.bin_prev);
+    }
+
+    if (metadata.bins[bin] == nullptr)
+    {
+        metadata.bins_bitmap &= ~(uint64_t(1) << bin);
+    }
+}
+
+void allocator_sorted_list::rebuild_bins() noexcept
+{
+    auto &metadata = get_metadata();
+    metadata.bins_bitmap = 0;
+    metadata.bins.fill(nullptr);
+
+    void *prev = nullptr;
+    for (auto it = free_begin(), end = free_end(); it != end; prev = *it, ++it)
+    {
+        if (it.size() >= min_binned_size)
+        {
+            get_links(*it).prev_free = prev;
+            bin_insert(*it);
+        }
+    }
+}
+
+void *allocator_sorted_list::blocks_begin() const noexcept
+{
+    return reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size;
+}
+
+void *allocator_sorted_list::blocks_end() const noexcept
+{
+    return reinterpret_cast<std::byte *>(blocks_begin()) + get_metadata().space_size;
+}
+
+void allocator_sorted_list::destroy() noexcept
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    auto *parent = get_metadata().parent_allocator;
+    size_t const total_size = allocator_metadata_size + get_metadata().space_size;
+
+    get_metadata().~allocator_metadata();
+    parent->deallocate(_trusted_memory, total_size, default_alignment);
+    _trusted_memory = nullptr;
 }
 
 allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_begin() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_end() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_end() const noexcept", "your code should be here...");
+    return {};
 }
 
 allocator_sorted_list::sorted_iterator allocator_sorted_list::begin() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_sorted_list::sorted_iterator allocator_sorted_list::end() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::end() const noexcept", "your code should be here...");
+    return {};
 }
 
 
 bool allocator_sorted_list::sorted_free_iterator::operator==(
         const allocator_sorted_list::sorted_free_iterator & other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_free_iterator::operator==(const allocator_sorted_list::sorted_free_iterator &) const noexcept", "your code should be here...");
+    return _free_ptr == other._free_ptr;
 }
 
 bool allocator_sorted_list::sorted_free_iterator::operator!=(
         const allocator_sorted_list::sorted_free_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_free_iterator::operator!=(const allocator_sorted_list::sorted_free_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_sorted_list::sorted_free_iterator &allocator_sorted_list::sorted_free_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator &allocator_sorted_list::sorted_free_iterator::operator++() & noexcept", "your code should be here...");
+    _free_ptr = get_block(_free_ptr).next;
+    return *this;
 }
 
-allocator_sorted_list::sorted_free_iterator allocator_sorted_list::sorted_free_iterator::operator++(int n)
+allocator_sorted_list::sorted_free_iterator allocator_sorted_list::sorted_free_iterator::operator++(int)
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::sorted_free_iterator::operator++(int)", "your code should be here...");
+    auto tmp = *this;
+    ++*this;
+    return tmp;
 }
 
 size_t allocator_sorted_list::sorted_free_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_sorted_list::sorted_free_iterator::size() const noexcept", "your code should be here...");
+    return get_block(_free_ptr).size;
 }
 
 void *allocator_sorted_list::sorted_free_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_sorted_list::sorted_free_iterator::operator*() const noexcept", "your code should be here...");
+    return _free_ptr;
 }
 
-allocator_sorted_list::sorted_free_iterator::sorted_free_iterator()
-{
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator::sorted_free_iterator()", "your code should be here...");
-}
+allocator_sorted_list::sorted_free_iterator::sorted_free_iterator() : _free_ptr(nullptr) {}
 
 allocator_sorted_list::sorted_free_iterator::sorted_free_iterator(void *trusted)
-{
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator::sorted_free_iterator(void *)", "your code should be here...");
-}
+    : _free_ptr(reinterpret_cast<allocator_metadata *>(trusted)->first_free) {}
 
 bool allocator_sorted_list::sorted_iterator::operator==(const allocator_sorted_list::sorted_iterator & other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::operator==(const allocator_sorted_list::sorted_iterator &) const noexcept", "your code should be here...");
+    return _current_ptr == other._current_ptr;
 }
 
 bool allocator_sorted_list::sorted_iterator::operator!=(const allocator_sorted_list::sorted_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::operator!=(const allocator_sorted_list::sorted_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_sorted_list::sorted_iterator &allocator_sorted_list::sorted_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator &allocator_sorted_list::sorted_iterator::operator++() & noexcept", "your code should be here...");
+    if (_current_ptr == _free_ptr)
+    {
+        _free_ptr = get_block(_free_ptr).next;
+    }
+
+    auto *next = reinterpret_cast<std::byte *>(_current_ptr) + block_metadata_size + get_block(_current_ptr).size;
+    auto *end = reinterpret_cast<std::byte *>(_trusted_memory) + allocator_metadata_size +
+            reinterpret_cast<allocator_metadata *>(_trusted_memory)->space_size;
+
+    _current_ptr = next < end ? next : nullptr;
+    return *this;
 }
 
-allocator_sorted_list::sorted_iterator allocator_sorted_list::sorted_iterator::operator++(int n)
+allocator_sorted_list::sorted_iterator allocator_sorted_list::sorted_iterator::operator++(int)
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::sorted_iterator::operator++(int)", "your code should be here...");
+    auto tmp = *this;
+    ++*this;
+    return tmp;
 }
 
 size_t allocator_sorted_list::sorted_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_sorted_list::sorted_iterator::size() const noexcept", "your code should be here...");
+    return get_block(_current_ptr).size;
 }
 
 void *allocator_sorted_list::sorted_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_sorted_list::sorted_iterator::operator*() const noexcept", "your code should be here...");
+    return _current_ptr;
 }
 
-allocator_sorted_list::sorted_iterator::sorted_iterator()
-{
-    throw not_implemented("allocator_sorted_list::sorted_iterator::sorted_iterator() ", "your code should be here...");
-}
+allocator_sorted_list::sorted_iterator::sorted_iterator() : _free_ptr(nullptr), _current_ptr(nullptr), _trusted_memory(nullptr) {}
 
 allocator_sorted_list::sorted_iterator::sorted_iterator(void *trusted)
-{
-    throw not_implemented("allocator_sorted_list::sorted_iterator::sorted_iterator(void *)", "your code should be here...");
-}
+    : _free_ptr(reinterpret_cast<allocator_metadata *>(trusted)->first_free),
+      _current_ptr(reinterpret_cast<std::byte *>(trusted) + allocator_metadata_size),
+      _trusted_memory(trusted) {}
 
 bool allocator_sorted_list::sorted_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::occupied() const noexcept", "your code should be here...");
+    return _current_ptr != _free_ptr;
 }
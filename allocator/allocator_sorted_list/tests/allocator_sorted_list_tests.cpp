@@ -2,7 +2,10 @@
 #include <logger.h>
 #include <logger_builder.h>
 #include <client_logger_builder.h>
+#include <algorithm>
 #include <list>
+#include <random>
+#include <thread>
 
 #include "../include/allocator_sorted_list.h"
 
@@ -44,6 +47,7 @@ TEST(allocatorSortedListPositiveTests, test1)
     
     auto second_block = reinterpret_cast<char *>(alloc->allocate(sizeof(int) * 250));
     alloc->deallocate(first_block, 1);
+    alloc->flush_quarantine();
     
     first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 245));
     
@@ -145,7 +149,7 @@ TEST(allocatorSortedListPositiveTests, test4)
                                                             }
                                                     }));
 
-    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000 + smart_mem_resource::guard_overhead() * 5, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
     
     auto first_block = reinterpret_cast<unsigned char *>(alloc->allocate(sizeof(unsigned char) * 250));
     auto second_block = reinterpret_cast<unsigned char *>(alloc->allocate(sizeof(char) * 150));
@@ -242,6 +246,458 @@ TEST(allocatorSortedListPositiveTests, test5)
     }
 }
 
+TEST(allocatorSortedListPositiveTests, test6)
+{
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+
+    void *first_block = allocator_instance->allocate(sizeof(char) * 10);
+    void *second_block = allocator_instance->allocate(sizeof(char) * 100, 64);
+    void *third_block = allocator_instance->allocate(sizeof(char) * 40, 256);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(third_block) % 256, 0);
+
+    void *odd_block = allocator_instance->allocate(5, 8);
+    void *fourth_block = allocator_instance->allocate(8, 8);
+    void *fifth_block = allocator_instance->allocate(16, 16);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fourth_block) % 8, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fifth_block) % 16, 0);
+
+    allocator_instance->deallocate(odd_block, 5, 8);
+    allocator_instance->deallocate(fourth_block, 8, 8);
+    allocator_instance->deallocate(fifth_block, 16, 16);
+    allocator_instance->deallocate(second_block, 100, 64);
+    allocator_instance->deallocate(first_block, 10);
+    allocator_instance->deallocate(third_block, 40, 256);
+    allocator_instance->flush_quarantine();
+
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 3000);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+}
+
+TEST(allocatorSortedListPositiveTests, test7)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_sorted_list(200'000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, true));
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 8; ++i)
+    {
+        workers.emplace_back([&allocator, i]
+        {
+            std::mt19937 engine(i);
+            std::vector<void *> allocated_blocks;
+
+            for (int j = 0; j < 10'000; ++j)
+            {
+                if (allocated_blocks.empty() || (allocated_blocks.size() < 32 && engine() % 3 != 0))
+                {
+                    allocated_blocks.push_back(allocator->allocate(engine() % 256 + 1));
+                    continue;
+                }
+
+                std::swap(allocated_blocks[engine() % allocated_blocks.size()], allocated_blocks.back());
+                allocator->deallocate(allocated_blocks.back(), 1);
+                allocated_blocks.pop_back();
+            }
+
+            for (auto block : allocated_blocks)
+            {
+                allocator->deallocate(block, 1);
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    allocator->flush_quarantine();
+
+    size_t total_size = 0;
+    for (auto const &block : dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info())
+    {
+        ASSERT_FALSE(block.is_block_occupied);
+        total_size += block.block_size;
+    }
+    ASSERT_EQ(total_size, 200'000);
+}
+
+TEST(allocatorSortedListPositiveTests, test8)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to other bins";
+#endif
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::segregated_fit));
+
+    auto first_block = alloc->allocate(sizeof(char) * 100);
+    auto second_block = alloc->allocate(sizeof(char) * 200);
+    auto third_block = alloc->allocate(sizeof(char) * 300);
+
+    alloc->deallocate(second_block, 1);
+
+    // 100 bytes round up to the [128, 256) bin, which holds only the block just freed
+    auto fourth_block = alloc->allocate(sizeof(char) * 100);
+    ASSERT_EQ(fourth_block, second_block);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 96, .is_block_occupied = false },
+            { .block_size = 320, .is_block_occupied = true },
+            { .block_size = 2328, .is_block_occupied = false }
+        };
+    ASSERT_EQ(dynamic_cast<allocator_test_utils *>(alloc.get())->get_blocks_info(), expected_blocks_info);
+
+    alloc->deallocate(fourth_block, 1);
+    alloc->deallocate(first_block, 1);
+    alloc->deallocate(third_block, 1);
+
+    auto actual_blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get())->get_blocks_info();
+    ASSERT_EQ(actual_blocks_info.size(), 1);
+    ASSERT_EQ(actual_blocks_info[0].block_size, 3000);
+    ASSERT_EQ(actual_blocks_info[0].is_block_occupied, false);
+}
+
+TEST(allocatorSortedListPositiveTests, test9)
+{
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, false, true));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+    size_t const guard = smart_mem_resource::guard_overhead();
+    // an extra arena is an allocator of its own and guards the block once more
+    size_t const arena_guard = guard * 2;
+
+    auto first_block = alloc->allocate(sizeof(char) * 600);
+    auto second_block = alloc->allocate(sizeof(char) * 600);
+    auto third_block = alloc->allocate(sizeof(char) * 600);
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 624 + guard, .is_block_occupied = true },
+            { .block_size = 376 - guard, .is_block_occupied = false },
+            { .block_size = 624 + arena_guard, .is_block_occupied = true },
+            { .block_size = 376 - arena_guard, .is_block_occupied = false },
+            { .block_size = 624 + arena_guard, .is_block_occupied = true },
+            { .block_size = 376 - arena_guard, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // an emptied arena goes back to the parent, the one in use stays
+    alloc->deallocate(second_block, 1);
+    alloc->deallocate(third_block, 1);
+    alloc->deallocate(first_block, 1);
+    alloc->flush_quarantine();
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false },
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    first_block = alloc->allocate(sizeof(char) * 600);
+    ASSERT_THROW(alloc->allocate(sizeof(char) * 1100), std::bad_alloc);
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false },
+            { .block_size = 624 + arena_guard, .is_block_occupied = true },
+            { .block_size = 376 - arena_guard, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    alloc->deallocate(first_block, 1);
+}
+
+TEST(allocatorSortedListPositiveTests, test10)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones change every statistic";
+#endif
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *stats = dynamic_cast<allocator_test_utils *>(alloc.get());
+
+    void *first_block = alloc->allocate(sizeof(char) * 100);
+    void *second_block = alloc->allocate(sizeof(char) * 200);
+    void *third_block = alloc->allocate(sizeof(char) * 100);
+
+    auto snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 480);
+    ASSERT_EQ(snapshot.allocations_count, 3);
+    ASSERT_EQ(snapshot.free_bytes, 520);
+    ASSERT_EQ(snapshot.largest_free_block, 520);
+    ASSERT_EQ(snapshot.free_blocks_count, 1);
+    ASSERT_EQ(snapshot.external_fragmentation(), 0.0);
+
+    alloc->deallocate(second_block, 1);
+    ASSERT_THROW(static_cast<void>(alloc->allocate(sizeof(char) * 900)), std::bad_alloc);
+
+    snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.bytes_in_use, 256);
+    ASSERT_EQ(snapshot.peak_bytes_in_use, 480);
+    ASSERT_EQ(snapshot.failed_allocations_count, 1);
+    ASSERT_EQ(snapshot.free_bytes, 744);
+    ASSERT_EQ(snapshot.largest_free_block, 520);
+    ASSERT_EQ(snapshot.free_blocks_count, 2);
+    ASSERT_DOUBLE_EQ(snapshot.external_fragmentation(), 1.0 - 520.0 / 744.0);
+
+    // the largest free block gets taken and has to be found again
+    void *fourth_block = alloc->allocate(sizeof(char) * 400);
+
+    snapshot = stats->get_statistics();
+    ASSERT_EQ(snapshot.largest_free_block, 224);
+    ASSERT_EQ(snapshot.free_blocks_count, 2);
+
+    alloc->deallocate(fourth_block, 1);
+    alloc->deallocate(first_block, 1);
+    alloc->deallocate(third_block, 1);
+
+    auto json = stats->get_statistics_json();
+    ASSERT_EQ(json["bytes_in_use"], 0);
+    ASSERT_EQ(json["peak_bytes_in_use"], 672);
+    ASSERT_EQ(json["deallocations_count"], 4);
+    ASSERT_EQ(json["largest_free_block"], 1000);
+    ASSERT_EQ(json["free_blocks_count"], 1);
+    ASSERT_EQ(json["external_fragmentation"], 0.0);
+}
+
+TEST(allocatorSortedListPositiveTests, test11)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guarded blocks are never resized in place";
+#endif
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::segregated_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+    pp_allocator<char> chars(alloc.get());
+
+    auto *first_block = chars.allocate(100);
+    auto *second_block = chars.allocate(100);
+
+    ASSERT_FALSE(alloc->try_expand(first_block, 200));
+    ASSERT_TRUE(chars.resize_in_place(second_block, 100, 300));
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 320, .is_block_occupied = true },
+            { .block_size = 552, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // the cut tail merges with the free block behind it
+    ASSERT_TRUE(chars.resize_in_place(second_block, 300, 50));
+    // sizes round up to alignof(std::max_align_t), so a few bytes less leave the block as it is
+    ASSERT_FALSE(alloc->shrink(first_block, 100));
+
+    expected_blocks_info =
+        {
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 792, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+
+    // a rest too small for a header goes to the block as well
+    ASSERT_TRUE(alloc->try_expand(second_block, 840));
+    ASSERT_FALSE(alloc->try_expand(second_block, 1000));
+
+    expected_blocks_info =
+        {
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 872, .is_block_occupied = true }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(blocks_info->get_statistics().bytes_in_use, 1000);
+
+    chars.deallocate(first_block, 100);
+    chars.deallocate(second_block, 840);
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+}
+
+TEST(allocatorSortedListPositiveTests, test12)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guarded batches go block by block";
+#endif
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+
+    auto *first_block = alloc->allocate(100, 1);
+    auto *second_block = alloc->allocate(100, 1);
+    auto *third_block = alloc->allocate(100, 1);
+    alloc->deallocate(second_block, 1);
+
+    // the batch goes on right behind its previous block while there is room for it
+    std::array<void *, 3> batch;
+    alloc->allocate_batch(50, batch.size(), batch.data());
+
+    std::vector<allocator_test_utils::block_info> expected_blocks_info
+        {
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 48, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = true },
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 80, .is_block_occupied = true },
+            { .block_size = 456, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(reinterpret_cast<char *>(batch[2]) - reinterpret_cast<char *>(batch[1]), 80);
+
+    // two of three blocks fit, the batch takes none
+    std::array<void *, 3> failed;
+    ASSERT_THROW(alloc->allocate_batch(200, failed.size(), failed.data()), std::bad_alloc);
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    ASSERT_EQ(blocks_info->get_statistics().failed_allocations_count, 1);
+
+    alloc->deallocate_batch(batch.data(), batch.size());
+    alloc->deallocate(first_block, 1);
+    alloc->deallocate(third_block, 1);
+
+    expected_blocks_info =
+        {
+            { .block_size = 1000, .is_block_occupied = false }
+        };
+    ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+}
+
+TEST(allocatorSortedListPositiveTests, test13)
+{
+    class space_counter final:
+        public allocator_test_utils::block_visitor
+    {
+
+    public:
+
+        size_t total = 0;
+        size_t occupied = 0;
+
+        void reset() override
+        {
+            total = occupied = 0;
+        }
+
+        void visit(allocator_test_utils::block_info const &block) override
+        {
+            total += block.block_size;
+            occupied += block.is_block_occupied ? block.block_size : 0;
+        }
+
+    };
+
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(10000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> workers;
+
+    for (int id = 0; id < 3; ++id)
+    {
+        workers.emplace_back([&alloc, &stop, id]
+        {
+            std::mt19937 engine(id);
+            std::vector<void *> blocks;
+
+            while (!stop)
+            {
+                if (blocks.size() < 8 && engine() % 2 == 0)
+                {
+                    try
+                    {
+                        blocks.push_back(alloc->allocate(engine() % 200 + 1, 1));
+                    }
+                    catch (std::bad_alloc const &)
+                    {
+                    }
+                }
+                else if (!blocks.empty())
+                {
+                    alloc->deallocate(blocks.back(), 1);
+                    blocks.pop_back();
+                }
+            }
+
+            for (auto *block : blocks)
+            {
+                alloc->deallocate(block, 1);
+            }
+        });
+    }
+
+    // every walk, whether it got through without the mutex or not, sees a whole heap
+    space_counter counter;
+    for (int i = 0; i < 2000; ++i)
+    {
+        size_t total = 0;
+        for (auto const &block : blocks_info->get_blocks_info())
+        {
+            total += block.block_size;
+        }
+        ASSERT_EQ(total, 10000);
+
+        blocks_info->visit_blocks(counter);
+        ASSERT_EQ(counter.total, 10000);
+        ASSERT_LE(counter.occupied, 10000);
+    }
+
+    stop = true;
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    alloc->flush_quarantine();
+    blocks_info->visit_blocks(counter);
+    ASSERT_EQ(counter.total, 10000);
+    ASSERT_EQ(counter.occupied, 0);
+}
+
+TEST(allocatorSortedListPositiveTests, test14)
+{
+#ifdef MP_OS_ALLOCATOR_HARDENED
+    GTEST_SKIP() << "guard zones move blocks to other bins";
+#endif
+
+    for (auto mode : { allocator_with_fit_mode::fit_mode::first_fit, allocator_with_fit_mode::fit_mode::segregated_fit })
+    {
+        std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(4096, nullptr, nullptr, mode));
+        auto *blocks_info = dynamic_cast<allocator_test_utils *>(alloc.get());
+
+        auto *small_block = alloc->allocate(40, 1);
+        auto *filler_block = alloc->allocate(4096 - 64 - 16, 1);
+        alloc->deallocate(small_block, 1);
+
+        // the free block left behind is too small for a bin, only the list leads to it
+        auto *first_block = alloc->allocate(16, 1);
+        auto *second_block = alloc->allocate(8, 1);
+        ASSERT_EQ(reinterpret_cast<char *>(second_block), reinterpret_cast<char *>(first_block) + 32);
+        ASSERT_THROW(alloc->allocate(8, 1), std::bad_alloc);
+
+        alloc->deallocate(first_block, 1);
+        alloc->deallocate(second_block, 1);
+        alloc->deallocate(filler_block, 1);
+
+        std::vector<allocator_test_utils::block_info> expected_blocks_info
+            {
+                { .block_size = 4096, .is_block_occupied = false }
+            };
+        ASSERT_EQ(blocks_info->get_blocks_info(), expected_blocks_info);
+    }
+}
+
 TEST(allocatorSortedListNegativeTests, test1)
 {
     std::unique_ptr<logger> logger(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -0,0 +1,317 @@
+#include <allocation_trace.h>
+#include <allocator_boundary_tags.h>
+#include <allocator_buddies_system.h>
+#include <allocator_global_heap.h>
+#include <allocator_red_black_tree.h>
+#include <allocator_sorted_list.h>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /** Parent resource that remembers how much memory an allocator held from it at most */
+    class counting_resource final:
+        public std::pmr::memory_resource
+    {
+        size_t _held = 0;
+        size_t _peak = 0;
+
+    public:
+
+        size_t peak() const noexcept
+        {
+            return _peak;
+        }
+
+    private:
+
+        void *do_allocate(
+            size_t size,
+            size_t alignment) override
+        {
+            void *res = std::pmr::new_delete_resource()->allocate(size, alignment);
+            _peak = std::max(_peak, _held += size);
+            return res;
+        }
+
+        void do_deallocate(
+            void *at,
+            size_t size,
+            size_t alignment) override
+        {
+            _held -= size;
+            std::pmr::new_delete_resource()->deallocate(at, size, alignment);
+        }
+
+        bool do_is_equal(
+            std::pmr::memory_resource const &other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    /** Several threads allocating blocks of mixed sizes and lifetimes, recorded the way real traffic would be */
+    allocation_trace synthesize(
+        size_t threads_count,
+        size_t operations_per_thread)
+    {
+        std::stringstream stream;
+
+        {
+            allocation_trace_recorder recorder(stream, std::pmr::new_delete_resource());
+            std::vector<std::thread> threads;
+
+            for (size_t t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&recorder, t, operations_per_thread]
+                {
+                    std::mt19937_64 engine(t);
+                    std::vector<std::tuple<void *, size_t, size_t>> live;
+
+                    auto const next_size = [&engine]() -> size_t
+                    {
+                        auto const kind = engine() % 100;
+                        return kind < 70 ? 8 + engine() % 121 : kind < 95 ? 129 + engine() % 896 : 1025 + engine() % 7168;
+                    };
+
+                    for (size_t i = 0; i < operations_per_thread; ++i)
+                    {
+                        if (live.size() < 64 || (live.size() < 2048 && engine() % 2 == 0))
+                        {
+                            size_t const size = next_size();
+                            size_t const alignment = engine() % 50 == 0 ? 64 : alignof(std::max_align_t);
+                            live.emplace_back(recorder.allocate(size, alignment), size, alignment);
+                        }
+                        else
+                        {
+                            auto &victim = live[engine() % live.size()];
+                            recorder.deallocate(std::get<0>(victim), std::get<1>(victim), std::get<2>(victim));
+                            victim = live.back();
+                            live.pop_back();
+                        }
+                    }
+
+                    for (auto [at, size, alignment] : live)
+                    {
+                        recorder.deallocate(at, size, alignment);
+                    }
+                });
+            }
+
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        return allocation_trace::read(stream);
+    }
+
+    /** Space for one arena of a growable allocator: twice the live peak of the trace with room for headers */
+    size_t arena_size(
+        allocation_trace const &trace)
+    {
+        std::vector<uint64_t> sizes;
+        size_t live_bytes = 0, live_blocks = 0, peak = 0;
+
+        for (auto const &event : trace.events)
+        {
+            if (event.kind == allocation_trace::event_kind::allocate)
+            {
+                if (sizes.size() <= event.id)
+                {
+                    sizes.resize(event.id + 1);
+                }
+                sizes[event.id] = event.size + (size_t(1) << event.alignment_power);
+                live_bytes += sizes[event.id];
+                ++live_blocks;
+            }
+            else
+            {
+                live_bytes -= sizes[event.id];
+                --live_blocks;
+            }
+
+            peak = std::max(peak, live_bytes + 64 * live_blocks);
+        }
+
+        return std::bit_ceil(2 * peak);
+    }
+
+    struct replay_result
+    {
+        double seconds = 0;
+        std::vector<uint64_t> latencies;
+        size_t failures = 0;
+        double fragmentation = -1;
+    };
+
+    /** Replays events in their recorded order in one thread, timing every event.
+     *  Fragmentation is the mean of the allocator statistics sampled every few events
+     */
+    replay_result replay(
+        allocation_trace const &trace,
+        std::pmr::memory_resource &allocator)
+    {
+        constexpr size_t sample_period = 256;
+
+        auto *stats = dynamic_cast<allocator_test_utils *>(&allocator);
+        std::vector<void *> blocks;
+        replay_result res;
+        res.latencies.reserve(trace.events.size());
+        double fragmentation_sum = 0;
+        size_t samples = 0;
+
+        auto const start = std::chrono::steady_clock::now();
+        auto previous = start;
+
+        for (size_t i = 0; i < trace.events.size(); ++i)
+        {
+            auto const &event = trace.events[i];
+            size_t const alignment = size_t(1) << event.alignment_power;
+
+            if (event.kind == allocation_trace::event_kind::allocate)
+            {
+                if (blocks.size() <= event.id)
+                {
+                    blocks.resize(std::max<size_t>(event.id + 1, 2 * blocks.size()));
+                }
+
+                try
+                {
+                    blocks[event.id] = allocator.allocate(event.size, alignment);
+                }
+                catch (std::bad_alloc const &)
+                {
+                    ++res.failures;
+                }
+            }
+            else if (blocks[event.id] != nullptr)
+            {
+                allocator.deallocate(blocks[event.id], event.size, alignment);
+                blocks[event.id] = nullptr;
+            }
+
+            auto const now = std::chrono::steady_clock::now();
+            res.latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(now - previous).count());
+
+            if (stats != nullptr && i % sample_period == 0)
+            {
+                fragmentation_sum += stats->get_statistics().external_fragmentation();
+                ++samples;
+                previous = std::chrono::steady_clock::now();
+            }
+            else
+            {
+                previous = now;
+            }
+        }
+
+        res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (samples != 0)
+        {
+            res.fragmentation = fragmentation_sum / static_cast<double>(samples);
+        }
+
+        return res;
+    }
+
+    uint64_t percentile(
+        std::vector<uint64_t> &values,
+        double fraction)
+    {
+        auto it = values.begin() + static_cast<ptrdiff_t>(fraction * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), it, values.end());
+        return *it;
+    }
+
+    void report(
+        std::string const &name,
+        std::string const &mode,
+        allocation_trace const &trace,
+        replay_result &result,
+        size_t footprint)
+    {
+        std::cout << std::left << std::setw(26) << name << std::setw(16) << mode << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(2) << static_cast<double>(trace.events.size()) / result.seconds / 1e6
+                  << std::setw(10) << percentile(result.latencies, 0.5)
+                  << std::setw(10) << percentile(result.latencies, 0.99)
+                  << std::setw(14) << (footprint == 0 ? std::string("-") : std::to_string(footprint / 1024))
+                  << std::setw(8) << (result.fragmentation < 0 ? std::string("-") : (std::ostringstream() << std::setprecision(3) << result.fragmentation).str())
+                  << std::setw(10) << result.failures << std::endl;
+    }
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    allocation_trace trace;
+
+    if (argc > 1)
+    {
+        std::ifstream stream(argv[1], std::ios::binary);
+        trace = allocation_trace::read(stream);
+    }
+    else
+    {
+        trace = synthesize(4, 100'000);
+    }
+
+    size_t const space_size = arena_size(trace);
+
+    std::cout << trace.events.size() << " events, arena of " << space_size / 1024 << " KB" << std::endl
+              << std::left << std::setw(26) << "allocator" << std::setw(16) << "mode" << std::right
+              << std::setw(12) << "Mops/s" << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns"
+              << std::setw(14) << "peak KB" << std::setw(8) << "frag" << std::setw(10) << "failures" << std::endl;
+
+    using fit_mode = allocator_with_fit_mode::fit_mode;
+    std::vector<std::pair<fit_mode, std::string>> const modes
+        {
+            { fit_mode::first_fit, "first_fit" },
+            { fit_mode::the_best_fit, "best_fit" },
+            { fit_mode::the_worst_fit, "worst_fit" },
+            { fit_mode::segregated_fit, "segregated_fit" }
+        };
+
+    std::vector<std::pair<std::string, std::function<std::unique_ptr<smart_mem_resource>(std::pmr::memory_resource *, fit_mode)>>> const allocators
+        {
+            { "allocator_sorted_list", [space_size](std::pmr::memory_resource *parent, fit_mode mode)
+                { return std::make_unique<allocator_sorted_list>(space_size, parent, nullptr, mode, false, true); } },
+            { "allocator_boundary_tags", [space_size](std::pmr::memory_resource *parent, fit_mode mode)
+                { return std::make_unique<allocator_boundary_tags>(space_size, parent, nullptr, mode, false, true); } },
+            { "allocator_buddies_system", [space_size](std::pmr::memory_resource *parent, fit_mode mode)
+                { return std::make_unique<allocator_buddies_system>(std::bit_width(space_size) - 1, parent, nullptr, mode, true); } },
+            { "allocator_red_black_tree", [space_size](std::pmr::memory_resource *parent, fit_mode mode)
+                { return std::make_unique<allocator_red_black_tree>(space_size, parent, nullptr, mode, true); } }
+        };
+
+    for (auto const &[name, make] : allocators)
+    {
+        for (auto const &[mode, mode_name] : modes)
+        {
+            counting_resource parent;
+            auto allocator = make(&parent, mode);
+            auto result = replay(trace, *allocator);
+            report(name, mode_name, trace, result, parent.peak());
+        }
+    }
+
+    allocator_global_heap global_heap;
+    auto result = replay(trace, global_heap);
+    report("allocator_global_heap", "-", trace, result, 0);
+
+    return 0;
+}
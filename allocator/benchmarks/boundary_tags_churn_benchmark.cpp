@@ -0,0 +1,97 @@
+#include <allocator_boundary_tags.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct churn_result
+    {
+        double seconds = 0;
+        double fragmentation = 0;
+    };
+
+    /** A request loop: every step frees one of the live blocks and allocates a block of the same size right away,
+     *  every tenth step the slot switches to another size
+     */
+    churn_result churn(
+        allocator_boundary_tags &allocator,
+        size_t slots_count,
+        size_t steps)
+    {
+        static constexpr size_t sizes[] = { 16, 24, 32, 48, 64, 96, 128, 256 };
+
+        std::mt19937_64 engine(42);
+        std::vector<std::pair<void *, size_t>> slots(slots_count);
+
+        for (auto &[at, size] : slots)
+        {
+            size = sizes[engine() % std::size(sizes)];
+            at = allocator.allocate(size, 1);
+        }
+
+        auto const start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            auto &[at, size] = slots[engine() % slots.size()];
+
+            allocator.deallocate(at, size, 1);
+
+            if (engine() % 10 == 0)
+            {
+                size = sizes[engine() % std::size(sizes)];
+            }
+
+            at = allocator.allocate(size, 1);
+        }
+
+        churn_result res;
+        res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        res.fragmentation = allocator.get_statistics().external_fragmentation();
+
+        for (auto [at, size] : slots)
+        {
+            allocator.deallocate(at, size, 1);
+        }
+
+        return res;
+    }
+}
+
+int main()
+{
+    constexpr size_t slots_count = 4096;
+    constexpr size_t steps = 200'000;
+
+    std::cout << slots_count << " live blocks, " << steps << " free/allocate steps" << std::endl
+              << std::left << std::setw(16) << "mode" << std::setw(12) << "coalescing" << std::right
+              << std::setw(12) << "Mops/s" << std::setw(8) << "frag" << std::endl;
+
+    using fit_mode = allocator_with_fit_mode::fit_mode;
+    std::vector<std::pair<fit_mode, std::string>> const modes
+        {
+            { fit_mode::first_fit, "first_fit" },
+            { fit_mode::the_best_fit, "best_fit" },
+            { fit_mode::the_worst_fit, "worst_fit" },
+            { fit_mode::segregated_fit, "segregated_fit" }
+        };
+
+    for (auto const &[mode, mode_name] : modes)
+    {
+        for (bool deferred : { false, true })
+        {
+            allocator_boundary_tags allocator(size_t(1) << 22, nullptr, nullptr, mode, false, false, deferred);
+            auto const result = churn(allocator, slots_count, steps);
+
+            std::cout << std::left << std::setw(16) << mode_name << std::setw(12) << (deferred ? "deferred" : "immediate") << std::right
+                      << std::setw(12) << std::fixed << std::setprecision(2) << 2 * static_cast<double>(steps) / result.seconds / 1e6
+                      << std::setw(8) << std::setprecision(3) << result.fragmentation << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <allocator_global_heap.h>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t live_blocks = 1000;
+
+    constexpr size_t steps = 2'000'000;
+
+    /** Drops everything, as a logger whose streams filter out debug and trace does */
+    class silent_logger final:
+        public logger
+    {
+
+    public:
+
+        logger &log(
+            std::string const &,
+            logger::severity) & override
+        {
+            return *this;
+        }
+
+        bool is_enabled(
+            logger::severity) const noexcept override
+        {
+            return false;
+        }
+
+    };
+
+    /** allocator_global_heap as it was before the size-class cache: a header, ::operator new and log strings
+     *  built on every call whether or not the logger writes them anywhere
+     */
+    class legacy_global_heap final:
+        public smart_mem_resource
+    {
+
+    private:
+
+        logger *_logger;
+
+        static constexpr size_t block_metadata_size = 16;
+
+    public:
+
+        explicit legacy_global_heap(
+            logger *logger) : _logger(logger) {}
+
+    private:
+
+        void *do_allocate_sm(
+            size_t size) override
+        {
+            if (_logger) {
+                _logger->debug("do_allocate_sm" + std::to_string(size) + " bytes");
+                _logger->trace("do_allocate_sm" + std::to_string(size) + " bytes");
+            }
+
+            void *raw_ptr = ::operator new(size + block_metadata_size);
+            *static_cast<size_t *>(raw_ptr) = size;
+
+            if (_logger) {
+                _logger->debug("do_allocate_sm" + std::to_string(size) + " bytes");
+                _logger->trace("do_allocate_sm" + std::to_string(size) + " bytes");
+            }
+
+            return static_cast<std::byte *>(raw_ptr) + block_metadata_size;
+        }
+
+        void do_deallocate_sm(
+            void *at) override
+        {
+            if (_logger) {
+                _logger->debug("do_deallocate_sm called");
+                _logger->trace("do_deallocate_sm called");
+            }
+
+            auto *ptr = static_cast<std::byte *>(at) - block_metadata_size;
+            size_t const size = *reinterpret_cast<size_t *>(ptr);
+            ::operator delete(ptr);
+
+            if (_logger) {
+                _logger->debug("do_deallocate_sm deallocated " + std::to_string(size) + " bytes");
+                _logger->trace("do_deallocate_sm deallocated " + std::to_string(size) + " bytes");
+            }
+        }
+
+        bool do_is_equal(
+            std::pmr::memory_resource const &other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    };
+
+    /** Keeps live_blocks small blocks of random sizes alive while random ones are replaced */
+    template<typename allocate_type, typename deallocate_type>
+    double churn(
+        allocate_type const &allocate,
+        deallocate_type const &deallocate)
+    {
+        std::mt19937_64 engine(42);
+        std::vector<std::pair<void *, size_t>> blocks(live_blocks);
+
+        for (auto &[block, size] : blocks)
+        {
+            size = 8 + engine() % 248;
+            block = allocate(size);
+        }
+
+        auto const start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            auto &[block, size] = blocks[engine() % live_blocks];
+
+            deallocate(block, size);
+            size = 8 + engine() % 248;
+            block = allocate(size);
+        }
+
+        double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (auto &[block, size] : blocks)
+        {
+            deallocate(block, size);
+        }
+
+        return seconds;
+    }
+
+    double churn_resource(
+        smart_mem_resource &resource)
+    {
+        return churn(
+            [&resource](size_t size) { return resource.allocate(size); },
+            [&resource](void *block, size_t size) { resource.deallocate(block, size); });
+    }
+}
+
+int main()
+{
+    silent_logger logger;
+
+    std::cout << live_blocks << " live blocks of 8 to 255 bytes, " << steps << " free/allocate steps" << std::endl
+              << std::left << std::setw(40) << "allocator" << std::right << std::setw(12) << "Mops/s" << std::endl;
+
+    auto const print = [](std::string const &name, double seconds)
+    {
+        std::cout << std::left << std::setw(40) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+                  << static_cast<double>(steps) / seconds / 1e6 << std::endl;
+    };
+
+    print("::operator new", churn(
+        [](size_t size) { return ::operator new(size); },
+        [](void *block, size_t) { ::operator delete(block); }));
+
+    legacy_global_heap legacy_silent(&logger);
+    print("legacy global_heap, filtered logger", churn_resource(legacy_silent));
+
+    legacy_global_heap legacy(nullptr);
+    print("legacy global_heap, no logger", churn_resource(legacy));
+
+    allocator_global_heap current_silent(&logger);
+    print("allocator_global_heap, filtered logger", churn_resource(current_silent));
+
+    allocator_global_heap current(nullptr);
+    print("allocator_global_heap, no logger", churn_resource(current));
+
+    return 0;
+}
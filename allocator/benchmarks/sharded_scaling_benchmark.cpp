@@ -0,0 +1,109 @@
+#include <allocator_red_black_tree.h>
+#include <allocator_sorted_list.h>
+#include <sharded_memory_resource.h>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t space_size = size_t(1) << 20;
+
+    /** Every thread keeps a few live blocks and replaces a random one of them at every step */
+    double run(
+        smart_mem_resource &resource,
+        size_t threads_count,
+        size_t steps)
+    {
+        static constexpr size_t sizes[] = { 16, 32, 48, 64, 128 };
+        static constexpr size_t live_blocks = 32;
+
+        std::vector<std::thread> threads;
+        auto const start = std::chrono::steady_clock::now();
+
+        for (size_t id = 0; id < threads_count; ++id)
+        {
+            threads.emplace_back([&resource, steps, id]
+            {
+                std::mt19937_64 engine(id);
+                std::vector<void *> blocks(live_blocks);
+
+                for (auto &block : blocks)
+                {
+                    block = resource.allocate(sizes[engine() % std::size(sizes)], 1);
+                }
+
+                for (size_t i = 0; i < steps; ++i)
+                {
+                    auto &block = blocks[engine() % blocks.size()];
+                    resource.deallocate(block, 1);
+                    block = resource.allocate(sizes[engine() % std::size(sizes)], 1);
+                }
+
+                for (auto *block : blocks)
+                {
+                    resource.deallocate(block, 1);
+                }
+            });
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+/** The only optional argument is the largest threads count, the hardware concurrency by default */
+int main(
+    int argc,
+    char **argv)
+{
+    constexpr size_t steps = 100'000;
+
+    size_t const max_threads = argc > 1
+        ? std::max<size_t>(std::stoul(argv[1]), 1)
+        : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    std::vector<std::pair<std::string, sharded_memory_resource::shard_factory>> const kinds
+        {
+            { "sorted_list", [](std::pmr::memory_resource *parent)
+                { return std::make_unique<allocator_sorted_list>(space_size, parent); } },
+            { "red_black_tree", [](std::pmr::memory_resource *parent)
+                { return std::make_unique<allocator_red_black_tree>(space_size, parent); } }
+        };
+
+    std::cout << steps << " free/allocate steps per thread" << std::endl
+              << std::left << std::setw(16) << "allocator" << std::right << std::setw(8) << "threads"
+              << std::setw(8) << "shards" << std::setw(12) << "Mops/s" << std::endl;
+
+    for (auto const &[name, make_shard] : kinds)
+    {
+        for (size_t threads_count = 1; threads_count <= max_threads; threads_count *= 2)
+        {
+            for (size_t shards_count : { size_t(1), threads_count })
+            {
+                sharded_memory_resource resource(shards_count, make_shard);
+                double const seconds = run(resource, threads_count, steps);
+
+                std::cout << std::left << std::setw(16) << name << std::right << std::setw(8) << threads_count
+                          << std::setw(8) << shards_count << std::setw(12) << std::fixed << std::setprecision(2)
+                          << 2 * static_cast<double>(threads_count * steps) / seconds / 1e6 << std::endl;
+
+                if (threads_count == 1)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
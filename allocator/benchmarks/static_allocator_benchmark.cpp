@@ -0,0 +1,81 @@
+#include <allocator_sorted_list.h>
+#include <static_allocator.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+
+namespace
+{
+    constexpr size_t space_size = size_t(1) << 22;
+
+    /** A map keeping about keys_count entries while random keys come and go */
+    template<typename allocator_type>
+    double churn(
+        allocator_type const &allocator,
+        size_t keys_count,
+        size_t steps)
+    {
+        std::map<size_t, size_t, std::less<size_t>, allocator_type> map(allocator);
+        std::mt19937_64 engine(42);
+
+        auto const start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < steps; ++i)
+        {
+            size_t const key = engine() % (2 * keys_count);
+
+            if (map.erase(key) == 0)
+            {
+                map.emplace(key, i);
+            }
+        }
+
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template<typename fit_policy, typename lock_policy>
+    double churn_static(
+        size_t keys_count,
+        size_t steps)
+    {
+        static_heap<fit_policy, lock_policy> heap(space_size);
+        return churn(static_allocator<std::pair<size_t const, size_t>, decltype(heap)>(heap), keys_count, steps);
+    }
+
+    double churn_dynamic(
+        allocator_with_fit_mode::fit_mode mode,
+        size_t keys_count,
+        size_t steps)
+    {
+        allocator_sorted_list resource(space_size, nullptr, nullptr, mode);
+        return churn(pp_allocator<std::pair<size_t const, size_t>>(&resource), keys_count, steps);
+    }
+}
+
+int main()
+{
+    constexpr size_t keys_count = 1000;
+    constexpr size_t steps = 500'000;
+
+    std::cout << "std::map with about " << keys_count << " keys, " << steps << " erase/emplace steps" << std::endl
+              << std::left << std::setw(36) << "allocator" << std::right << std::setw(12) << "Mops/s" << std::endl;
+
+    auto const print = [](std::string const &name, double seconds)
+    {
+        std::cout << std::left << std::setw(36) << name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+                  << static_cast<double>(steps) / seconds / 1e6 << std::endl;
+    };
+
+    print("sorted_list first_fit", churn_dynamic(allocator_with_fit_mode::fit_mode::first_fit, keys_count, steps));
+    print("static_heap first_fit, mutex", churn_static<first_fit_policy, mutex_lock_policy>(keys_count, steps));
+    print("static_heap first_fit, spin", churn_static<first_fit_policy, spin_lock_policy>(keys_count, steps));
+    print("static_heap first_fit, no lock", churn_static<first_fit_policy, no_lock_policy>(keys_count, steps));
+    print("sorted_list best_fit", churn_dynamic(allocator_with_fit_mode::fit_mode::the_best_fit, keys_count, steps));
+    print("static_heap best_fit, no lock", churn_static<best_fit_policy, no_lock_policy>(keys_count, steps));
+    print("static_heap worst_fit, no lock", churn_static<worst_fit_policy, no_lock_policy>(keys_count, steps));
+
+    return 0;
+}
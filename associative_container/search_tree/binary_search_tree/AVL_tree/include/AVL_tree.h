@@ -7,31 +7,31 @@ namespace __detail
 {
     class AVL_TAG;
 
-    template<typename tkey, typename tvalue, typename compare>
-    class bst_impl<tkey, tvalue, compare, AVL_TAG>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    class bst_impl<tkey, tvalue, compare, AVL_TAG, tallocator>
     {
-        friend class binary_search_tree<tkey, tvalue, compare, AVL_TAG>;
+        friend class binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>;
         template<class ...Args>
-        static binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node* create_node(binary_search_tree<tkey, tvalue, compare, AVL_TAG>& cont, Args&& ...args);
+        static binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node* create_node(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& cont, Args&& ...args);
 
-        static void delete_node(binary_search_tree<tkey, tvalue, compare, AVL_TAG>& cont, typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node** node);
+        static void delete_node(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& cont, typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node** node);
 
-        static void post_search(binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node**){}
+        static void post_search(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node**){}
 
-        static void post_insert(binary_search_tree<tkey, tvalue, compare, AVL_TAG>& cont, binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node**);
+        static void post_insert(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node**);
 
-        static void erase(binary_search_tree<tkey, tvalue, compare, AVL_TAG>& cont, binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node**);
+        static void erase(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node**);
 
-        static void swap(binary_search_tree<tkey, tvalue, compare, AVL_TAG>& lhs, binary_search_tree<tkey, tvalue, compare, AVL_TAG>& rhs) noexcept;
+        static void swap(binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& lhs, binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>& rhs) noexcept;
     };
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>>
+template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>, typename tallocator = pp_allocator<std::pair<const tkey, tvalue>>>
 class AVL_tree final:
-    public binary_search_tree<tkey, tvalue, compare, __detail::AVL_TAG>
+    public binary_search_tree<tkey, tvalue, compare, __detail::AVL_TAG, tallocator>
 {
-    using parent = binary_search_tree<tkey, tvalue, compare, __detail::AVL_TAG>;
-    friend class __detail::bst_impl<tkey, tvalue, compare, __detail::AVL_TAG>;
+    using parent = binary_search_tree<tkey, tvalue, compare, __detail::AVL_TAG, tallocator>;
+    friend class __detail::bst_impl<tkey, tvalue, compare, __detail::AVL_TAG, tallocator>;
 private:
     
     struct node final: public parent::node
@@ -495,12 +495,12 @@ public:
 
     explicit AVL_tree(
         const compare& comp = compare(),
-        pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+        tallocator alloc = tallocator(),
         logger *logger = nullptr
         );
 
     explicit AVL_tree(
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         const compare& comp = compare(),
         logger *logger = nullptr
         );
@@ -510,7 +510,7 @@ public:
         iterator begin,
         iterator end,
         const compare& cmp = compare(),
-        pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+        tallocator alloc = tallocator(),
         logger* logger = nullptr
         );
 
@@ -518,7 +518,7 @@ public:
     explicit AVL_tree(
         Range&& range,
         const compare& cmp = compare(),
-        pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+        tallocator alloc = tallocator(),
         logger* logger = nullptr
         );
 
@@ -526,7 +526,7 @@ public:
     AVL_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
         const compare& cmp = compare(),
-        pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+        tallocator alloc = tallocator(),
         logger* logger = nullptr
         );
 
@@ -606,38 +606,38 @@ AVL_tree(
 
 namespace __detail
 {
-    template<typename tkey, typename tvalue, typename compare>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
     template<class ...Args>
-    binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node* bst_impl<tkey, tvalue, compare, AVL_TAG>::create_node(
-            binary_search_tree <tkey, tvalue, compare, AVL_TAG> &cont, Args &&...args)
+    binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node* bst_impl<tkey, tvalue, compare, AVL_TAG, tallocator>::create_node(
+            binary_search_tree <tkey, tvalue, compare, AVL_TAG, tallocator> &cont, Args &&...args)
     {
-        using node_type = typename AVL_tree<tkey, tvalue, compare>::node;
+        using node_type = typename AVL_tree<tkey, tvalue, compare, tallocator>::node;
 
-        node_type* new_node = cont._allocator.template new_object<node_type>(std::forward<Args>(args)...);
+        node_type* new_node = cont.template new_node<node_type>(std::forward<Args>(args)...);
         return new_node;
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, AVL_TAG>::delete_node(
-            binary_search_tree <tkey, tvalue, compare, AVL_TAG> &cont,
-            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node** node)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, AVL_TAG, tallocator>::delete_node(
+            binary_search_tree <tkey, tvalue, compare, AVL_TAG, tallocator> &cont,
+            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node** node)
     {
-        using node_type = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node;
+        using node_type = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node;
         if (node){
             cont._allocator.template delete_object<node_type>(*node);
             *node = nullptr;
         }
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, AVL_TAG>::post_insert(
-            binary_search_tree <tkey, tvalue, compare, AVL_TAG> &cont,
-            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node **node)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, AVL_TAG, tallocator>::post_insert(
+            binary_search_tree <tkey, tvalue, compare, AVL_TAG, tallocator> &cont,
+            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node **node)
     {
         if (!node || !*node) return;
 
-        using avl_node = typename AVL_tree<tkey, tvalue, compare>::node;
-        using bst_node = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node;
+        using avl_node = typename AVL_tree<tkey, tvalue, compare, tallocator>::node;
+        using bst_node = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node;
 
         auto* current = static_cast<avl_node*>((*node)->parent);
 
@@ -686,13 +686,13 @@ namespace __detail
     }
 
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, AVL_TAG>::erase(
-            binary_search_tree <tkey, tvalue, compare, AVL_TAG> &cont,
-            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node **node_ptr)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, AVL_TAG, tallocator>::erase(
+            binary_search_tree <tkey, tvalue, compare, AVL_TAG, tallocator> &cont,
+            typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node **node_ptr)
     {
-        using avl_node = typename AVL_tree<tkey, tvalue, compare>::node;
-        using bst_node = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG>::node;
+        using avl_node = typename AVL_tree<tkey, tvalue, compare, tallocator>::node;
+        using bst_node = typename binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator>::node;
         bst_node* node = *node_ptr;
         bst_node* balance_from = nullptr;
         if (!node) return;
@@ -819,10 +819,10 @@ namespace __detail
     }
 }
 
-template<typename tkey, typename tvalue, typename compare>
-void __detail::bst_impl<tkey, tvalue, compare, __detail::AVL_TAG>::swap(
-    binary_search_tree<tkey, tvalue, compare, AVL_TAG> &lhs,
-    binary_search_tree<tkey, tvalue, compare, AVL_TAG> &rhs
+template<typename tkey, typename tvalue, typename compare, typename tallocator>
+void __detail::bst_impl<tkey, tvalue, compare, __detail::AVL_TAG, tallocator>::swap(
+    binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator> &lhs,
+    binary_search_tree<tkey, tvalue, compare, AVL_TAG, tallocator> &rhs
     ) noexcept
 {
     using std::swap;
@@ -834,8 +834,8 @@ void __detail::bst_impl<tkey, tvalue, compare, __detail::AVL_TAG>::swap(
 
 // region node implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-void AVL_tree<tkey, tvalue, compare>::node::recalculate_height() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+void AVL_tree<tkey, tvalue, compare, tallocator>::node::recalculate_height() noexcept
 {
     const size_t left_height = this->left_subtree ? static_cast<node*>(this->left_subtree)->height : 0;
     const size_t right_height = this->right_subtree ? static_cast<node*>(this->right_subtree)->height : 0;
@@ -843,18 +843,18 @@ void AVL_tree<tkey, tvalue, compare>::node::recalculate_height() noexcept
     this->height = std::max(left_height, right_height) + 1;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-short AVL_tree<tkey, tvalue, compare>::node::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+short AVL_tree<tkey, tvalue, compare, tallocator>::node::get_balance() const noexcept
 {
-    const size_t left_height = this->left_subtree ? static_cast<AVL_tree<tkey, tvalue, compare>::node*>(this->left_subtree)->height : 0;
-    const size_t right_height = this->right_subtree ? static_cast<AVL_tree<tkey, tvalue, compare>::node*>(this->right_subtree)->height : 0;
+    const size_t left_height = this->left_subtree ? static_cast<AVL_tree<tkey, tvalue, compare, tallocator>::node*>(this->left_subtree)->height : 0;
+    const size_t right_height = this->right_subtree ? static_cast<AVL_tree<tkey, tvalue, compare, tallocator>::node*>(this->right_subtree)->height : 0;
 
     return static_cast<short>(right_height) - static_cast<short>(left_height);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-AVL_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args):
+AVL_tree<tkey, tvalue, compare, tallocator>::node::node(parent::node* par, Args&&... args):
     parent::node(par, std::forward<Args>(args)...),
     height(1)
 {}
@@ -863,25 +863,25 @@ AVL_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args):
 
 // region prefix_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::prefix_iterator(parent::node* n) noexcept:
     parent::prefix_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::prefix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::prefix_iterator(parent::prefix_iterator it) noexcept:
     parent::prefix_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::get_height() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->height;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::get_balance() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->get_balance();
@@ -891,29 +891,29 @@ size_t AVL_tree<tkey, tvalue, compare>::prefix_iterator::get_balance() const noe
 
 // region prefix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(parent::node* n) noexcept:
     parent::prefix_const_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::prefix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(parent::prefix_const_iterator it) noexcept:
     parent::prefix_const_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(prefix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(prefix_iterator it) noexcept:
     parent::prefix_const_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::get_height() const noexcept
 {
     return prefix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::get_balance() const noexcept
 {
     return prefix_iterator(this->_base).get_balance();
 }
@@ -922,42 +922,42 @@ size_t AVL_tree<tkey, tvalue, compare>::prefix_const_iterator::get_balance() con
 
 // region prefix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(parent::node* n) noexcept:
     parent::prefix_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::prefix_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(parent::prefix_reverse_iterator it) noexcept:
     parent::prefix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::get_height() const noexcept
 {
     return prefix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::get_balance() const noexcept
 {
     return prefix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(prefix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(prefix_iterator it) noexcept:
     parent::prefix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::prefix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator() const noexcept
 {
     return parent::prefix_reverse_iterator::operator prefix_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_iterator
-AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::base() const noexcept
 {
     return parent::prefix_reverse_iterator::base();
 }
@@ -966,42 +966,42 @@ AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator::base() const noexcept
 
 // region prefix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::node* n) noexcept:
     parent::prefix_const_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::prefix_const_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::prefix_const_reverse_iterator it) noexcept:
     parent::prefix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::get_height() const noexcept
 {
     return prefix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::get_balance() const noexcept
 {
     return prefix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(prefix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(prefix_const_iterator it) noexcept:
     parent::prefix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::prefix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator() const noexcept
 {
     return parent::prefix_const_reverse_iterator::operator prefix_const_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_iterator
-AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::base() const noexcept
 {
     return parent::prefix_const_reverse_iterator::base();
 }
@@ -1010,25 +1010,25 @@ AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::base() const noe
 
 // region infix_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator::infix_iterator(parent::node* n) noexcept:
     parent::infix_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::infix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator::infix_iterator(parent::infix_iterator it) noexcept:
 parent::infix_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator::get_height() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->height;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator::get_balance() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->get_balance();
@@ -1038,30 +1038,30 @@ size_t AVL_tree<tkey, tvalue, compare>::infix_iterator::get_balance() const noex
 
 // region infix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(parent::node* n) noexcept:
 parent::infix_const_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::infix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(parent::infix_const_iterator it) noexcept:
 parent::infix_const_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_const_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::get_height() const noexcept
 {
     return infix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_const_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::get_balance() const noexcept
 {
     return infix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(infix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(infix_iterator it) noexcept:
 parent::infix_const_iterator(it)
 {}
 
@@ -1069,41 +1069,41 @@ parent::infix_const_iterator(it)
 
 // region infix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(parent::node* n) noexcept:
 parent::infix_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::infix_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(parent::infix_reverse_iterator it) noexcept:
 parent::infix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::get_height() const noexcept
 {
     return infix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::get_balance() const noexcept
 {
     return infix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(infix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(infix_iterator it) noexcept:
 parent::infix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::infix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator() const noexcept
 {
     return parent::infix_reverse_iterator::operator infix_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::base() const noexcept
 {
     return parent::infix_reverse_iterator::base();
 }
@@ -1112,41 +1112,41 @@ typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue,
 
 // region infix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::node* n) noexcept:
 parent::infix_const_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::infix_const_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::infix_const_reverse_iterator it) noexcept:
 parent::infix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::get_height() const noexcept
 {
     return infix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::get_balance() const noexcept
 {
     return infix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(infix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(infix_const_iterator it) noexcept:
 parent::infix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::infix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator() const noexcept
 {
     return parent::infix_const_reverse_iterator::operator infix_const_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::base() const noexcept
 {
     return parent::infix_const_reverse_iterator::base();
 }
@@ -1155,25 +1155,25 @@ typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tv
 
 // region postfix_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::postfix_iterator(parent::node* n) noexcept:
 parent::postfix_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::postfix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::postfix_iterator(parent::postfix_iterator it) noexcept:
 parent::postfix_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::get_height() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->height;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::get_balance() const noexcept
 {
     if (!this->_data) return 0;
     return static_cast<node*>(this->_data)->get_balance();
@@ -1183,30 +1183,30 @@ size_t AVL_tree<tkey, tvalue, compare>::postfix_iterator::get_balance() const no
 
 // region postfix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(parent::node* n) noexcept:
 parent::postfix_const_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::postfix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(parent::postfix_const_iterator it) noexcept:
 parent::postfix_const_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_const_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::get_height() const noexcept
 {
     return postfix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_const_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::get_balance() const noexcept
 {
     return postfix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(postfix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(postfix_iterator it) noexcept:
 parent::postfix_const_iterator(it)
 {}
 
@@ -1214,41 +1214,41 @@ parent::postfix_const_iterator(it)
 
 // region postfix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(parent::node* n) noexcept:
 parent::postfix_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::postfix_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(parent::postfix_reverse_iterator it) noexcept:
 parent::postfix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::get_height() const noexcept
 {
     return postfix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::get_balance() const noexcept
 {
     return postfix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(postfix_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(postfix_iterator it) noexcept:
 parent::postfix_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::postfix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator() const noexcept
 {
     return parent::postfix_reverse_iterator::operator postfix_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_iterator AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::base() const noexcept
 {
     return parent::postfix_reverse_iterator::base();
 }
@@ -1257,41 +1257,41 @@ typename AVL_tree<tkey, tvalue, compare>::postfix_iterator AVL_tree<tkey, tvalue
 
 // region postfix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::node* n) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::node* n) noexcept:
 parent::postfix_const_reverse_iterator(n)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::postfix_const_reverse_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::postfix_const_reverse_iterator it) noexcept:
 parent::postfix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::get_height() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::get_height() const noexcept
 {
     return postfix_iterator(this->_base).get_height();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-size_t AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::get_balance() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+size_t AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::get_balance() const noexcept
 {
     return postfix_iterator(this->_base).get_balance();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(postfix_const_iterator it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(postfix_const_iterator it) noexcept:
 parent::postfix_const_reverse_iterator(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare>::postfix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::operator AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator() const noexcept
 {
     return parent::postfix_const_reverse_iterator::operator postfix_const_iterator();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::base() const noexcept
 {
     return parent::postfix_const_reverse_iterator::base();
 }
@@ -1301,294 +1301,294 @@ typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey,
 // region iterator requests implementation
 
 // Infix iterators
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue, compare>::begin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin() noexcept
 {
     return infix_iterator(parent::begin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue, compare>::end() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end() noexcept
 {
     return infix_iterator(parent::end());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::begin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin() const noexcept
 {
     return infix_const_iterator(parent::begin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::end() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end() const noexcept
 {
     return infix_const_iterator(parent::end());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::cbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cbegin() const noexcept
 {
     return infix_const_iterator(parent::cbegin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::cend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cend() const noexcept
 {
     return infix_const_iterator(parent::cend());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin() noexcept
 {
     return infix_reverse_iterator(parent::rbegin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend() noexcept
 {
     return infix_reverse_iterator(parent::rend());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin() const noexcept
 {
     return infix_const_reverse_iterator(parent::rbegin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend() const noexcept
 {
     return infix_const_reverse_iterator(parent::rend());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crbegin() const noexcept
 {
     return infix_const_reverse_iterator(parent::crbegin());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crend() const noexcept
 {
     return infix_const_reverse_iterator(parent::crend());
 }
 
 // region prefix iterators
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_iterator AVL_tree<tkey, tvalue, compare>::begin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_prefix() noexcept
 {
     return prefix_iterator(parent::begin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_iterator AVL_tree<tkey, tvalue, compare>::end_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_prefix() noexcept
 {
     return prefix_iterator(parent::end_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_iterator AVL_tree<tkey, tvalue, compare>::begin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_prefix() const noexcept
 {
     return prefix_const_iterator(parent::begin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_iterator AVL_tree<tkey, tvalue, compare>::end_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_prefix() const noexcept
 {
     return prefix_const_iterator(parent::end_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_iterator AVL_tree<tkey, tvalue, compare>::cbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cbegin_prefix() const noexcept
 {
     return prefix_const_iterator(parent::cbegin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_iterator AVL_tree<tkey, tvalue, compare>::cend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cend_prefix() const noexcept
 {
     return prefix_const_iterator(parent::cend_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_prefix() noexcept
 {
     return prefix_reverse_iterator(parent::rbegin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_prefix() noexcept
 {
     return prefix_reverse_iterator(parent::rend_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_prefix() const noexcept
 {
     return prefix_const_reverse_iterator(parent::rbegin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_prefix() const noexcept
 {
     return prefix_const_reverse_iterator(parent::rend_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crbegin_prefix() const noexcept
 {
     return prefix_const_reverse_iterator(parent::crbegin_prefix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crend_prefix() const noexcept
 {
     return prefix_const_reverse_iterator(parent::crend_prefix());
 }
 
 // region infix iterators
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue, compare>::begin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_infix() noexcept
 {
     return infix_iterator(parent::begin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator AVL_tree<tkey, tvalue, compare>::end_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_infix() noexcept
 {
     return infix_iterator(parent::end_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::begin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_infix() const noexcept
 {
     return infix_const_iterator(parent::begin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::end_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_infix() const noexcept
 {
     return infix_const_iterator(parent::end_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::cbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cbegin_infix() const noexcept
 {
     return infix_const_iterator(parent::cbegin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator AVL_tree<tkey, tvalue, compare>::cend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cend_infix() const noexcept
 {
     return infix_const_iterator(parent::cend_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_infix() noexcept
 {
     return infix_reverse_iterator(parent::rbegin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_infix() noexcept
 {
     return infix_reverse_iterator(parent::rend_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_infix() const noexcept
 {
     return infix_const_reverse_iterator(parent::rbegin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_infix() const noexcept
 {
     return infix_const_reverse_iterator(parent::rend_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crbegin_infix() const noexcept
 {
     return infix_const_reverse_iterator(parent::crbegin_infix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crend_infix() const noexcept
 {
     return infix_const_reverse_iterator(parent::crend_infix());
 }
 
 // region postfix iterators
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_iterator AVL_tree<tkey, tvalue, compare>::begin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_postfix() noexcept
 {
     return postfix_iterator(parent::begin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_iterator AVL_tree<tkey, tvalue, compare>::end_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_postfix() noexcept
 {
     return postfix_iterator(parent::end_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey, tvalue, compare>::begin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::begin_postfix() const noexcept
 {
     return postfix_const_iterator(parent::begin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey, tvalue, compare>::end_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::end_postfix() const noexcept
 {
     return postfix_const_iterator(parent::end_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey, tvalue, compare>::cbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cbegin_postfix() const noexcept
 {
     return postfix_const_iterator(parent::cbegin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_iterator AVL_tree<tkey, tvalue, compare>::cend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator AVL_tree<tkey, tvalue, compare, tallocator>::cend_postfix() const noexcept
 {
     return postfix_const_iterator(parent::cend_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_postfix() noexcept
 {
     return postfix_reverse_iterator(parent::rbegin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_postfix() noexcept
 {
     return postfix_reverse_iterator(parent::rend_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rbegin_postfix() const noexcept
 {
     return postfix_const_reverse_iterator(parent::rbegin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::rend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::rend_postfix() const noexcept
 {
     return postfix_const_reverse_iterator(parent::rend_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crbegin_postfix() const noexcept
 {
     return postfix_const_reverse_iterator(parent::crbegin_postfix());
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare>::crend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator AVL_tree<tkey, tvalue, compare, tallocator>::crend_postfix() const noexcept
 {
     return postfix_const_reverse_iterator(parent::crend_postfix());
 }
@@ -1598,28 +1598,28 @@ typename AVL_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator AVL_tre
 // region AVL_tree constructors
 
 // Constructors
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(
         const compare& comp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger):
         parent(comp, alloc, logger)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(
-        pp_allocator<value_type> alloc,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(
+        tallocator alloc,
         const compare& comp,
         logger* logger):
         parent(comp, alloc, logger)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<input_iterator_for_pair<tkey, tvalue> iterator>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(
         iterator begin, iterator end,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger):
         parent(cmp, alloc, logger)
 {
@@ -1628,12 +1628,12 @@ AVL_tree<tkey, tvalue, compare>::AVL_tree(
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<std::ranges::input_range Range>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(
         Range&& range,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger):
         parent(cmp, alloc, logger)
 {
@@ -1642,10 +1642,10 @@ AVL_tree<tkey, tvalue, compare>::AVL_tree(
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
-        const compare& cmp, pp_allocator<value_type> alloc,
+        const compare& cmp, tallocator alloc,
         logger* logger):
     parent(cmp, alloc, logger)
 {
@@ -1654,8 +1654,8 @@ AVL_tree<tkey, tvalue, compare>::AVL_tree(
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>::AVL_tree(const AVL_tree& other):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>::AVL_tree(const AVL_tree& other):
 parent(other._compare, other._allocator, other._logger)
 {
     for (auto it = other.begin(); it != other.end(); ++it) {
@@ -1663,8 +1663,8 @@ parent(other._compare, other._allocator, other._logger)
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-AVL_tree<tkey, tvalue, compare>& AVL_tree<tkey, tvalue, compare>::operator=(const AVL_tree& other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+AVL_tree<tkey, tvalue, compare, tallocator>& AVL_tree<tkey, tvalue, compare, tallocator>::operator=(const AVL_tree& other)
 {
     if (this == &other) return *this;
 
@@ -1673,8 +1673,8 @@ AVL_tree<tkey, tvalue, compare>& AVL_tree<tkey, tvalue, compare>::operator=(cons
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-void AVL_tree<tkey, tvalue, compare>::swap(parent& other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+void AVL_tree<tkey, tvalue, compare, tallocator>::swap(parent& other) noexcept
 {
     parent::swap(other);
 }
@@ -1683,32 +1683,32 @@ void AVL_tree<tkey, tvalue, compare>::swap(parent& other) noexcept
 
 // region AVL_tree methods
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-std::pair<typename AVL_tree<tkey, tvalue, compare>::infix_iterator, bool>
-AVL_tree<tkey, tvalue, compare>::insert(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+std::pair<typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+AVL_tree<tkey, tvalue, compare, tallocator>::insert(const value_type& value)
 {
     return parent::insert(value);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-std::pair<typename AVL_tree<tkey, tvalue, compare>::infix_iterator, bool>
-AVL_tree<tkey, tvalue, compare>::insert(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+std::pair<typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+AVL_tree<tkey, tvalue, compare, tallocator>::insert(value_type&& value)
 {
     return insert(std::move(value));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-std::pair<typename AVL_tree<tkey, tvalue, compare>::infix_iterator, bool>
-AVL_tree<tkey, tvalue, compare>::emplace(Args&&... args)
+std::pair<typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+AVL_tree<tkey, tvalue, compare, tallocator>::emplace(Args&&... args)
 {
     value_type value(std::forward<Args>(args)...);
     return insert(value);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::insert_or_assign(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::insert_or_assign(const value_type& value)
 {
     auto res = insert(value);
     if (res.second == false) {
@@ -1718,9 +1718,9 @@ AVL_tree<tkey, tvalue, compare>::insert_or_assign(const value_type& value)
     return res.first;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::insert_or_assign(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::insert_or_assign(value_type&& value)
 {
     auto moved_val = std::move(value.second);
     auto res = insert(std::move(value));
@@ -1731,78 +1731,78 @@ AVL_tree<tkey, tvalue, compare>::insert_or_assign(value_type&& value)
     return res.first;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::emplace_or_assign(Args&&... args)
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::emplace_or_assign(Args&&... args)
 {
     value_type value(std::forward<Args>(args)...);
     return insert_or_assign(std::move(value));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::find(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::find(const tkey& key)
 {
     return infix_iterator(parent::find(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator
-AVL_tree<tkey, tvalue, compare>::find(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::find(const tkey& key) const
 {
     return infix_const_iterator(parent::find(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::lower_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::lower_bound(const tkey& key)
 {
     return infix_iterator(parent::lower_bound(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator
-AVL_tree<tkey, tvalue, compare>::lower_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::lower_bound(const tkey& key) const
 {
     return infix_const_iterator(parent::lower_bound(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::upper_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::upper_bound(const tkey& key)
 {
     return infix_iterator(parent::upper_bound(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_const_iterator
-AVL_tree<tkey, tvalue, compare>::upper_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::upper_bound(const tkey& key) const
 {
     return infix_const_iterator(parent::upper_bound(key));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::erase(infix_iterator pos) {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::erase(infix_iterator pos) {
     return parent::erase(pos);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::erase(infix_const_iterator pos) {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::erase(infix_const_iterator pos) {
     return parent::erase(pos);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::erase(infix_iterator first, infix_iterator last) {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::erase(infix_iterator first, infix_iterator last) {
     return parent::erase(first, last);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename AVL_tree<tkey, tvalue, compare>::infix_iterator
-AVL_tree<tkey, tvalue, compare>::erase(infix_const_iterator first, infix_const_iterator last) {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename AVL_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+AVL_tree<tkey, tvalue, compare, tallocator>::erase(infix_const_iterator first, infix_const_iterator last) {
     return parent::erase(first, last);
 }
 
@@ -18,14 +18,14 @@
 
 namespace __detail
 {
-    template<typename tkey, typename tvalue, typename compare, typename tag>
+    template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
     class bst_impl;
 
     class BST_TAG;
 }
 
 
-template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>, typename tag = __detail::BST_TAG>
+template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>, typename tag = __detail::BST_TAG, typename tallocator = pp_allocator<std::pair<const tkey, tvalue>>>
 class binary_search_tree : private compare
 {
 public:
@@ -33,7 +33,12 @@ public:
 
     using value_type = std::pair<const tkey, tvalue>;
 
-    friend class __detail::bst_impl<tkey, tvalue, compare, tag>;
+    /** pp_allocator or any allocator with its interface of new_object, delete_object and byte batches,
+     *  such as static_allocator over a static_heap
+     */
+    using allocator_type = tallocator;
+
+    friend class __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>;
 
 protected:
 
@@ -288,8 +293,8 @@ public:
     {
 
     protected:
-        friend class __detail::bst_impl<tkey, tvalue, compare, tag>;
-        friend class binary_search_tree<tkey, tvalue, compare, tag>;
+        friend class __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>;
+        friend class binary_search_tree<tkey, tvalue, compare, tag, tallocator>;
         node* _data;
 
         /** If iterator == end or before_begin _data points to nullptr, _backup to last node
@@ -704,33 +709,53 @@ protected:
 
     /** You should use coercion ctor or template methods of allocator
      */
-    pp_allocator<value_type> _allocator;
+    tallocator _allocator;
+
+    /** Node blocks a bulk insert takes from the allocator in one batch. They are taken when the first node
+     *  gets created, since trees built on this one have nodes bigger than node
+     */
+    struct node_reserve
+    {
+        std::vector<void*> blocks;
+        size_t pending = 0;
+        size_t block_size = 0;
+        size_t block_alignment = 0;
+    };
+
+    node_reserve _reserve;
+
+    /** Constructs U in a reserved block when there is one of its size, in a new block otherwise */
+    template<class U, class ...Args>
+    U* new_node(Args&&... args);
+
+    /** Gives the blocks a bulk insert did not use back to the allocator */
+    void release_reserve();
 
 public:
     explicit binary_search_tree(
             const compare& comp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger *logger = nullptr);
 
     explicit binary_search_tree(
-            pp_allocator<value_type> alloc,
+            tallocator alloc,
             const compare& comp = compare(),
             logger *logger = nullptr);
 
 
     template<input_iterator_for_pair<tkey, tvalue> iterator>
     explicit binary_search_tree(iterator begin, iterator end, const compare& cmp = compare(),
-                                pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+                                tallocator alloc = tallocator(),
                                 logger* logger = nullptr);
 
     template<std::ranges::input_range Range>
     explicit binary_search_tree(Range&& range, const compare& cmp = compare(),
-                                pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+                                tallocator alloc = tallocator(),
                                 logger* logger = nullptr);
 
 
     binary_search_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp = compare(),
-                       pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+                       tallocator alloc = tallocator(),
                        logger* logger = nullptr);
 
 public:
@@ -934,30 +959,30 @@ protected:
 
 namespace __detail
 {
-    template<typename tkey, typename tvalue, typename compare, typename tag>
+    template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
     class bst_impl
     {
-        friend class binary_search_tree<tkey, tvalue, compare, tag>;
+        friend class binary_search_tree<tkey, tvalue, compare, tag, tallocator>;
         template<class ...Args>
-        static binary_search_tree<tkey, tvalue, compare, tag>::node* create_node(binary_search_tree<tkey, tvalue, compare, tag>& cont, Args&& ...args);
+        static binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node* create_node(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, Args&& ...args);
 
-        static void delete_node(binary_search_tree<tkey, tvalue, compare, tag>& cont, binary_search_tree<tkey, tvalue, compare, tag>::node** node);
+        static void delete_node(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node** node);
 
         //Does not invalidate node*, needed for splay tree
-        static void post_search(binary_search_tree<tkey, tvalue, compare, tag>::node**){}
+        static void post_search(binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node**){}
 
         //Does not invalidate node*
-        static void post_insert(binary_search_tree<tkey, tvalue, compare, tag>& cont, binary_search_tree<tkey, tvalue, compare, tag>::node**){}
+        static void post_insert(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node**){}
 
-        static void erase(binary_search_tree<tkey, tvalue, compare, tag>& cont, binary_search_tree<tkey, tvalue, compare, tag>::node**);
+        static void erase(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node**);
 
-        static void swap(binary_search_tree<tkey, tvalue, compare, tag>& lhs, binary_search_tree<tkey, tvalue, compare, tag>& rhs) noexcept;
+        static void swap(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& lhs, binary_search_tree<tkey, tvalue, compare, tag, tallocator>& rhs) noexcept;
     };
 }
 
-template<typename tkey, typename tvalue, typename compare, typename tag>
-void __detail::bst_impl<tkey, tvalue, compare, tag>::swap(binary_search_tree<tkey, tvalue, compare, tag> &lhs,
-                                                binary_search_tree<tkey, tvalue, compare, tag> &rhs) noexcept
+template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
+void __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::swap(binary_search_tree<tkey, tvalue, compare, tag, tallocator> &lhs,
+                                                binary_search_tree<tkey, tvalue, compare, tag, tallocator> &rhs) noexcept
 {
     std::swap(lhs.root, rhs.root);
     std::swap(lhs._logger, rhs._logger);
@@ -965,25 +990,25 @@ void __detail::bst_impl<tkey, tvalue, compare, tag>::swap(binary_search_tree<tke
     std::swap(lhs._allocator, rhs._allocator);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<input_iterator_for_pair<tkey, tvalue> iterator>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(iterator begin, iterator end, const compare &cmp,
-    pp_allocator<typename binary_search_tree<tkey, tvalue, compare, tag>::value_type> alloc, logger *logger):
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(iterator begin, iterator end, const compare &cmp,
+    tallocator alloc, logger *logger):
      _root(nullptr), _logger(logger), _size(0), _allocator(alloc)
 {
     insert(begin, end);
 }
 
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::compare_pairs(const binary_search_tree::value_type &lhs,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::compare_pairs(const binary_search_tree::value_type &lhs,
                                                               const binary_search_tree::value_type &rhs) const
 {
     return compare_keys(lhs.first, rhs.first);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::compare_keys(const tkey &lhs, const tkey &rhs) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::compare_keys(const tkey &lhs, const tkey &rhs) const
 {
     compare comp{};
     return comp(lhs, rhs);
@@ -1007,9 +1032,9 @@ binary_search_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const co
 
 // region node implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<class ...Args>
-binary_search_tree<tkey, tvalue, compare, tag>::node::node(node* parent, Args&& ...args)
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node::node(node* parent, Args&& ...args)
     : data(std::forward<Args>(args)...), parent(parent), left_subtree(nullptr), right_subtree(nullptr)
 {
 }
@@ -1018,30 +1043,30 @@ binary_search_tree<tkey, tvalue, compare, tag>::node::node(node* parent, Args&&
 
 // region prefix_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::prefix_iterator(node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::prefix_iterator(node* data):
     _data(data),
     _backup(nullptr)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator==(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator==(
         prefix_iterator const &other) const noexcept
 {
     return _data == other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator!=(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator!=(
         prefix_iterator const &other) const noexcept
 {
     return _data != other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator++() & noexcept
 {
     if (_data == nullptr) return *this;
 
@@ -1068,18 +1093,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator++() &
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator--() & noexcept
 {
     if (_data == nullptr && _backup == nullptr) return *this;
     if (_data == nullptr && _backup != nullptr) {
@@ -1109,18 +1134,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator--() &
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     --(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator*()
 {
     if (_data == nullptr) { // cannot be reference to nullptr
          throw std::runtime_error("Cannot create a reference out of prefix_iterator that is nullptr");
@@ -1128,16 +1153,16 @@ binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator*()
     return _data->data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::operator->() noexcept
 {
     if (_data) return &(_data->data);
     return nullptr;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator::depth() const noexcept
 {
     if (_data == nullptr) return 0;
     size_t depth = 0;
@@ -1149,80 +1174,80 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator::depth()
 
 // region prefix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::prefix_const_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::prefix_const_iterator(const node* data):
     _base(const_cast<node*>(data))
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::prefix_const_iterator(const prefix_iterator& other) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::prefix_const_iterator(const prefix_iterator& other) noexcept:
     _base(other)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator==(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator==(
         prefix_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator!=(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator!=(
         prefix_iterator const &other) const noexcept
 {
     return _base != other.base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator++() & noexcept
 {
     ++(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator--() & noexcept
 {
     --(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -1231,96 +1256,96 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator::de
 
 // region prefix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::prefix_reverse_iterator(node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(node* data):
     _base(data)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::prefix_reverse_iterator(const prefix_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(const prefix_iterator& it) noexcept:
     _base(it)
 {
     --(_base);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator() const noexcept
 {
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator==(prefix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator==(prefix_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator!=(prefix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator!=(prefix_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator++() & noexcept
 {
     --(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator--() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -1329,96 +1354,96 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator::
 
 // region prefix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(const node* data):
     _base(data)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(const prefix_const_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(const prefix_const_iterator& it) noexcept:
     _base(it)
 {
     --_base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator() const noexcept
 {
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator==(prefix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator==(prefix_const_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator!=(prefix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator!=(prefix_const_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator++() & noexcept
 {
     --_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator--() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -1426,28 +1451,28 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iter
 // endregion prefix_const_reverse_iterator implementation
 
 // region infix_iterator implementation
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::infix_iterator(node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::infix_iterator(node* data):
     _data(data),
     _backup(nullptr)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator==(infix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator==(infix_iterator const &other) const noexcept
 {
     return _data == other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator!=(infix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator!=(infix_iterator const &other) const noexcept
 {
     return _data != other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator++() & noexcept
 {
     if (_data == nullptr) return *this;
 
@@ -1470,18 +1495,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator++() & n
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator--() & noexcept
 {
     if (_data == nullptr && _backup == nullptr) return *this;
     if (_data == nullptr && _backup != nullptr){
@@ -1508,18 +1533,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator--() & n
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     --(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator*()
 {
     if (_data == nullptr) { // cannot be reference to nullptr
         throw std::runtime_error("Cannot create a reference out of prefix_iterator that is nullptr");
@@ -1527,15 +1552,15 @@ binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator*()
     return _data->data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::operator->() noexcept
 {
     return (_data) ? &(_data->data) : nullptr;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator::depth() const noexcept
 {
     if (_data == nullptr) return 0;
     size_t depth = 0;
@@ -1547,93 +1572,93 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator::depth() c
 
 // region infix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::infix_const_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::infix_const_iterator(const node* data):
     _base(const_cast<node *>(data))
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::infix_const_iterator(const infix_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::infix_const_iterator(const infix_iterator& it) noexcept:
     _base(it)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator==(infix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator==(infix_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator!=(infix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator!=(infix_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator!=(infix_const_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator!=(infix_const_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator==(infix_const_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator==(infix_const_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator++() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator--() & noexcept
 {
     --_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator--(int not_used) const noexcept
 {
     infix_const_iterator tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -1642,95 +1667,95 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator::dep
 
 // region infix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::infix_reverse_iterator(node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::infix_reverse_iterator(node* data):
     _base(data)
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::infix_reverse_iterator(const infix_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::infix_reverse_iterator(const infix_iterator& it) noexcept:
     _base(it)
 {
     --(_base);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator() const noexcept{
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator() const noexcept{
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator==(infix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator==(infix_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator!=(infix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator!=(infix_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator++() & noexcept
 {
     --(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --_base;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator--() & noexcept
 {
     ++(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -1739,95 +1764,95 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator::d
 
 // region infix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::infix_const_reverse_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(const node* data):
     _base(data)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::infix_const_reverse_iterator(const infix_const_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(const infix_const_iterator& it) noexcept:
     _base(it)
 {
     --_base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator() const noexcept
 {
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator==(infix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator==(infix_const_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator!=(infix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator!=(infix_const_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator++() & noexcept
 {
     --(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator--() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator::depth() const noexcept
 {
     return _base->depth();
 }
@@ -1836,27 +1861,27 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_itera
 
 // region postfix_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::postfix_iterator(node* data) :
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::postfix_iterator(node* data) :
     _data(data),
     _backup(nullptr)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator==(postfix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator==(postfix_iterator const &other) const noexcept
 {
     return _data == other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator!=(postfix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator!=(postfix_iterator const &other) const noexcept
 {
     return _data != other._data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator++() & noexcept
 {
     if (_data == nullptr) return *this;
 
@@ -1880,18 +1905,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator++() &
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator--() & noexcept
 {
     if (_data == nullptr && _backup == nullptr) return *this;
     if (_data == nullptr && _backup != nullptr){
@@ -1914,18 +1939,18 @@ binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator--() &
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     --(*this);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator*()
 {
     if (_data == nullptr) { // cannot be reference to nullptr
         throw std::runtime_error("Cannot create a reference out of prefix_iterator that is nullptr");
@@ -1933,15 +1958,15 @@ binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator*()
     return _data->data;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::operator->() noexcept
 {
     return _data ? &(_data->data) : nullptr;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator::depth() const noexcept
 {
     if (_data == nullptr) return 0;
     size_t depth = 0;
@@ -1953,78 +1978,78 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator::depth()
 
 // region postfix_const_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::postfix_const_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::postfix_const_iterator(const node* data):
     _base(const_cast<node*>(data))
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::postfix_const_iterator(const postfix_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::postfix_const_iterator(const postfix_iterator& it) noexcept:
     _base(it)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator==(postfix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator==(postfix_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator!=(postfix_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator!=(postfix_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator++() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator--() & noexcept
 {
     --_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -2033,95 +2058,95 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator::d
 
 // region postfix_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::postfix_reverse_iterator(node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(node* data):
     _base(data)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::postfix_reverse_iterator(const postfix_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(const postfix_iterator& it) noexcept:
     _base(it)
 {
     --_base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator() const noexcept
 {
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator==(postfix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator==(postfix_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator!=(postfix_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator!=(postfix_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator++() & noexcept
 {
     --_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator--() & noexcept
 {
     ++_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++_base;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -2130,95 +2155,95 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator:
 
 // region postfix_const_reverse_iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(const node* data):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(const node* data):
     _base(data)
 {}
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(const postfix_const_iterator& it) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(const postfix_const_iterator& it) noexcept:
     _base(it)
 {
     --_base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator() const noexcept
 {
     auto tmp = _base;
     ++tmp;
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::base() const noexcept
 {
     return _base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator==(postfix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator==(postfix_const_reverse_iterator const &other) const noexcept
 {
     return _base == other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator!=(postfix_const_reverse_iterator const &other) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator!=(postfix_const_reverse_iterator const &other) const noexcept
 {
     return _base != other._base;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator++() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator++() & noexcept
 {
     --_base;
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator++(int not_used) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator++(int not_used) noexcept
 {
     auto tmp = *this;
     --(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator &
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator--() & noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator &
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator--() & noexcept
 {
     ++(_base);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator const
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator--(int not_used) const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator const
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator--(int not_used) const noexcept
 {
     auto tmp = *this;
     ++(_base);
     return tmp;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::reference
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator*()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::reference
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator*()
 {
     return _base.operator*();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::pointer
-binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::operator->() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::pointer
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::operator->() noexcept
 {
     return _base.operator->();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator::depth() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator::depth() const noexcept
 {
     return _base.depth();
 }
@@ -2227,10 +2252,10 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_ite
 
 // region binary_search_tree implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(
         const compare& comp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger *logger):
     _root(nullptr),
     _logger(logger),
@@ -2239,9 +2264,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
-        pp_allocator<value_type> alloc,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(
+        tallocator alloc,
         const compare& comp,
         logger *logger):
     _root(nullptr),
@@ -2251,12 +2276,12 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
 {
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<std::ranges::input_range Range>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(
         Range&& range,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger):
     _root(nullptr),
     _logger(logger),
@@ -2266,11 +2291,11 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
     insert_range(std::forward<Range>(range));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger):
     _root(nullptr),
     _logger(logger),
@@ -2284,8 +2309,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(
 
 // region binary_search_tree 5_rules implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(const binary_search_tree &other):
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(const binary_search_tree &other):
     _logger(other._logger),
     _allocator(other._allocator),
     _size(0)
@@ -2297,8 +2322,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(const binary_
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(binary_search_tree &&other) noexcept:
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::binary_search_tree(binary_search_tree &&other) noexcept:
     _root(other._root),
     _logger(other._logger),
     _allocator(std::move(other._allocator)),
@@ -2309,27 +2334,27 @@ binary_search_tree<tkey, tvalue, compare, tag>::binary_search_tree(binary_search
     other._size = 0;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>&
-binary_search_tree<tkey, tvalue, compare, tag>::operator=(const binary_search_tree &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>&
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::operator=(const binary_search_tree &other)
 {
     if (this != &other){
         binary_search_tree temp(other);
-        __detail::bst_impl<tkey, tvalue, compare, tag>::swap(*this, temp);
+        __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::swap(*this, temp);
     }
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>&
-binary_search_tree<tkey, tvalue, compare, tag>::operator=(binary_search_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>&
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::operator=(binary_search_tree &&other) noexcept
 {
-    if (this != &other) __detail::bst_impl<tkey, tvalue, compare, tag>::swap(*this, other);
+    if (this != &other) __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::swap(*this, other);
     return *this;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-binary_search_tree<tkey, tvalue, compare, tag>::~binary_search_tree()
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::~binary_search_tree()
 {
     clear();
 }
@@ -2338,8 +2363,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::~binary_search_tree()
 
 // region binary_search_tree methods_access implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-tvalue& binary_search_tree<tkey, tvalue, compare, tag>::at(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+tvalue& binary_search_tree<tkey, tvalue, compare, tag, tallocator>::at(const tkey& key)
 {
     node *cur = _root;
     while (cur){
@@ -2354,8 +2379,8 @@ tvalue& binary_search_tree<tkey, tvalue, compare, tag>::at(const tkey& key)
     throw std::out_of_range("Node with such key " + std::to_string(key) + " not found");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-const tvalue& binary_search_tree<tkey, tvalue, compare, tag>::at(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+const tvalue& binary_search_tree<tkey, tvalue, compare, tag, tallocator>::at(const tkey& key) const
 {
     node *cur = _root;
     while (cur){
@@ -2370,39 +2395,46 @@ const tvalue& binary_search_tree<tkey, tvalue, compare, tag>::at(const tkey& key
     throw std::out_of_range("Node with such key " + std::to_string(key) + " not found");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-tvalue& binary_search_tree<tkey, tvalue, compare, tag>::operator[](const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+tvalue& binary_search_tree<tkey, tvalue, compare, tag, tallocator>::operator[](const tkey& key)
 {
     return at(key);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-tvalue& binary_search_tree<tkey, tvalue, compare, tag>::operator[](tkey&& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+tvalue& binary_search_tree<tkey, tvalue, compare, tag, tallocator>::operator[](tkey&& key)
 {
     return at(key);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::empty() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::empty() const noexcept
 {
     return _root == nullptr;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::size() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::size() const noexcept
 {
     return _size;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::clear() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::clear_postfix(node* subtree_root) noexcept
 {
-    for (auto it = begin_postfix(); it != end_postfix(); ) {
-        tkey key = it->first;
-        ++it; // Сдвигаем до удаления
+    if (subtree_root == nullptr) return;
 
-        erase(key);
-    }
+    clear_postfix(subtree_root->left_subtree);
+    clear_postfix(subtree_root->right_subtree);
+    // node destructors are virtual, so nodes of derived trees go the same way
+    _allocator.template delete_object<node>(subtree_root);
+}
+
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::clear() noexcept
+{
+    // nodes go back to the allocator without rebalancing, children first
+    clear_postfix(_root);
 
     _root = nullptr;
     _size = 0;
@@ -2413,9 +2445,9 @@ void binary_search_tree<tkey, tvalue, compare, tag>::clear() noexcept
 
 // region binary_search_tree methods_insert and methods_emplace implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-std::pair<typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator, bool>
-binary_search_tree<tkey, tvalue, compare, tag>::insert(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+std::pair<typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator, bool>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert(const value_type& value)
 {
     node* parent = nullptr;
     node* current = _root;
@@ -2433,7 +2465,7 @@ binary_search_tree<tkey, tvalue, compare, tag>::insert(const value_type& value)
     }
 
     // Создаём ноду через аллокатор
-    node* new_node = __detail::bst_impl<tkey, tvalue, compare, tag>::create_node(*this, parent, value);
+    node* new_node = __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::create_node(*this, parent, value);
 
     if (_root == nullptr) {
         _root = new_node;
@@ -2444,47 +2476,108 @@ binary_search_tree<tkey, tvalue, compare, tag>::insert(const value_type& value)
     }
     ++_size;
 
-    __detail::bst_impl<tkey, tvalue, compare, tag>::post_insert(*this, &new_node);
+    __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::post_insert(*this, &new_node);
     return std::make_pair(infix_iterator(new_node), true);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-std::pair<typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator, bool>
-binary_search_tree<tkey, tvalue, compare, tag>::insert(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+std::pair<typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator, bool>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert(value_type&& value)
 {
     return insert(std::move(value));
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<std::input_iterator InputIt>
-void binary_search_tree<tkey, tvalue, compare, tag>::insert(InputIt first, InputIt last)
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert(InputIt first, InputIt last)
 {
-    for (auto item = first; item != last; ++item) {
-        insert(*item);
+    if constexpr (std::forward_iterator<InputIt>) {
+        _reserve.pending = static_cast<size_t>(std::distance(first, last));
     }
+
+    try {
+        for (auto item = first; item != last; ++item) {
+            insert(*item);
+        }
+    } catch (...) {
+        release_reserve();
+        throw;
+    }
+
+    release_reserve();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<std::ranges::input_range R>
-void binary_search_tree<tkey, tvalue, compare, tag>::insert_range(R&& rg)
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert_range(R&& rg)
 {
-    for (const auto& item : rg) {
-        insert(item);
+    if constexpr (std::ranges::forward_range<R>) {
+        _reserve.pending = static_cast<size_t>(std::ranges::distance(rg));
+    }
+
+    try {
+        for (const auto& item : rg) {
+            insert(item);
+        }
+    } catch (...) {
+        release_reserve();
+        throw;
+    }
+
+    release_reserve();
+}
+
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+template<class U, class ...Args>
+U* binary_search_tree<tkey, tvalue, compare, tag, tallocator>::new_node(Args&&... args)
+{
+    if (_reserve.pending != 0) {
+        std::vector<void*> blocks(_reserve.pending);
+        _reserve.pending = 0;
+
+        try {
+            _allocator.allocate_bytes_batch(blocks.data(), blocks.size(), sizeof(U), alignof(U));
+            _reserve.blocks = std::move(blocks);
+            _reserve.block_size = sizeof(U);
+            _reserve.block_alignment = alignof(U);
+        } catch (std::bad_alloc const&) {
+            // the batch is all or nothing, single nodes may still fit
+        }
+    }
+
+    if (_reserve.blocks.empty() || _reserve.block_size != sizeof(U) || _reserve.block_alignment != alignof(U)) {
+        return _allocator.template new_object<U>(std::forward<Args>(args)...);
+    }
+
+    auto* p = static_cast<U*>(_reserve.blocks.back());
+    _allocator.construct(p, std::forward<Args>(args)...);
+    _reserve.blocks.pop_back();
+    return p;
+}
+
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::release_reserve()
+{
+    _reserve.pending = 0;
+
+    if (!_reserve.blocks.empty()) {
+        _allocator.deallocate_bytes_batch(_reserve.blocks.data(), _reserve.blocks.size(), _reserve.block_size, _reserve.block_alignment);
+        _reserve.blocks.clear();
     }
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<class ...Args>
-std::pair<typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator, bool>
-binary_search_tree<tkey, tvalue, compare, tag>::emplace(Args&&... args)
+std::pair<typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator, bool>
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::emplace(Args&&... args)
 {
     value_type value(std::forward<Args>(args)...);
     return insert(value);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::insert_or_assign(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert_or_assign(const value_type& value)
 {
 
     auto res = insert(value);
@@ -2495,9 +2588,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::insert_or_assign(const value_typ
     return res.first;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::insert_or_assign(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert_or_assign(value_type&& value)
 {
         auto moved_val = std::move(value.second);
         auto res = insert(std::move(value));
@@ -2508,23 +2601,23 @@ binary_search_tree<tkey, tvalue, compare, tag>::insert_or_assign(value_type&& va
         return res.first;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<std::input_iterator InputIt>
-void binary_search_tree<tkey, tvalue, compare, tag>::insert_or_assign(InputIt first, InputIt last)
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::insert_or_assign(InputIt first, InputIt last)
 {
-    if (_logger) _logger->log("<Range insert_or_assign>", logger::severity::debug);
+    if (_logger && _logger->is_enabled(logger::severity::debug)) _logger->log("<Range insert_or_assign>", logger::severity::debug);
 
     for (auto item = first; item != last; ++item) {
         insert_or_assign(*item);
     }
 
-    if (_logger) _logger->log("</Range insert_or_assign>", logger::severity::debug);
+    if (_logger && _logger->is_enabled(logger::severity::debug)) _logger->log("</Range insert_or_assign>", logger::severity::debug);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
 template<class ...Args>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::emplace_or_assign(Args&&... args)
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::emplace_or_assign(Args&&... args)
 {
     value_type value(std::forward<Args>(args)...);
     return insert_or_assign(std::move(value));
@@ -2534,8 +2627,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::emplace_or_assign(Args&&... args
 
 // region binary_search_tree swap_method implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::swap(binary_search_tree& other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::swap(binary_search_tree& other) noexcept
 {
     if (this == &other) return;
 
@@ -2549,8 +2642,8 @@ void binary_search_tree<tkey, tvalue, compare, tag>::swap(binary_search_tree& ot
 
 // region binary_search_tree methods_search and methods_erase implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-bool binary_search_tree<tkey, tvalue, compare, tag>::contains(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+bool binary_search_tree<tkey, tvalue, compare, tag, tallocator>::contains(const tkey& key) const
 {
     node* cur = _root;
     while (cur != nullptr){
@@ -2565,9 +2658,9 @@ bool binary_search_tree<tkey, tvalue, compare, tag>::contains(const tkey& key) c
     return false;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::find(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::find(const tkey& key)
 {
     node* cur = _root;
     while (cur != nullptr){
@@ -2582,9 +2675,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::find(const tkey& key)
     return end_infix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::find(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::find(const tkey& key) const
 {
     node* cur = _root;
     while (cur != nullptr){
@@ -2599,9 +2692,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::find(const tkey& key) const
     return cend_infix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::lower_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::lower_bound(const tkey& key)
 {
     node* current = _root;
     node* result = nullptr;
@@ -2618,9 +2711,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::lower_bound(const tkey& key)
     return infix_iterator(result);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::lower_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::lower_bound(const tkey& key) const
 {
     node* current = _root;
     node* result = nullptr;
@@ -2637,9 +2730,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::lower_bound(const tkey& key) con
     return infix_const_iterator(result);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::upper_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::upper_bound(const tkey& key)
 {
     node* current = _root;
     node* result = nullptr;
@@ -2656,9 +2749,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::upper_bound(const tkey& key)
     return infix_iterator(result);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::upper_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::upper_bound(const tkey& key) const
 {
     node* current = _root;
     node* result = nullptr;
@@ -2675,35 +2768,35 @@ binary_search_tree<tkey, tvalue, compare, tag>::upper_bound(const tkey& key) con
     return infix_const_iterator(result);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_iterator pos)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::erase(infix_iterator pos)
 {
     if (pos == end_infix()) return end_infix();
 
     auto current_node = pos._data;
     auto next = ++pos;
-    __detail::bst_impl<tkey, tvalue, compare, tag>::erase(*this, &current_node);
+    __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::erase(*this, &current_node);
     return next;
 }
 
 
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_const_iterator pos)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::erase(infix_const_iterator pos)
 {
     if (pos == end_infix()) return end_infix();
 
     auto current_node = pos._data;
     auto next = ++pos;
-    __detail::bst_impl<tkey, tvalue, compare, tag>::erase(*this, &current_node);
+    __detail::bst_impl<tkey, tvalue, compare, tag, tallocator>::erase(*this, &current_node);
     return next;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_iterator first, infix_iterator last)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::erase(infix_iterator first, infix_iterator last)
 {
     auto it = first;
     while (it != last) {
@@ -2712,9 +2805,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_iterator first, infi
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_const_iterator first, infix_const_iterator last)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::erase(infix_const_iterator first, infix_const_iterator last)
 {
     auto it = first;
     while (it != last) {
@@ -2723,8 +2816,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::erase(infix_const_iterator first
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-size_t binary_search_tree<tkey, tvalue, compare, tag>::erase(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+size_t binary_search_tree<tkey, tvalue, compare, tag, tallocator>::erase(const tkey& key)
 {
     auto it = find(key);
     if (it == end()) return 0;
@@ -2736,9 +2829,9 @@ size_t binary_search_tree<tkey, tvalue, compare, tag>::erase(const tkey& key)
 
 // region infix_iterators requests implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin() noexcept
 {
     if (_root == nullptr) return infix_iterator(nullptr);
 
@@ -2748,9 +2841,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::begin() noexcept
     return infix_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end() noexcept
 {
     if (_root == nullptr) return infix_iterator(nullptr);
 
@@ -2762,9 +2855,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::end() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin() const noexcept
 {
     if (_root == nullptr) return infix_const_iterator(nullptr);
 
@@ -2774,9 +2867,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::begin() const noexcept
     return infix_const_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end() const noexcept
 {
     if (_root == nullptr) return infix_const_iterator(nullptr);
 
@@ -2788,23 +2881,23 @@ binary_search_tree<tkey, tvalue, compare, tag>::end() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cbegin() const noexcept
 {
     return begin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cend() const noexcept
 {
     return end();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin() noexcept
 {
     if (_root == nullptr) return infix_reverse_iterator(nullptr);
 
@@ -2816,9 +2909,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rbegin() noexcept
     return infix_reverse_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend() noexcept
 {
     if (_root == nullptr) return infix_reverse_iterator(nullptr);
 
@@ -2832,9 +2925,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin() const noexcept
 {
     if (_root == nullptr) return infix_const_reverse_iterator(nullptr);
 
@@ -2846,9 +2939,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rbegin() const noexcept
     return infix_const_reverse_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend() const noexcept
 {
     if (_root == nullptr) return infix_const_reverse_iterator(nullptr);
 
@@ -2862,16 +2955,16 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crbegin() const noexcept
 {
     return rbegin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crend() const noexcept
 {
     return rend();
 }
@@ -2880,17 +2973,17 @@ binary_search_tree<tkey, tvalue, compare, tag>::crend() const noexcept
 
 // region prefix_iterators requests implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_prefix() noexcept
 {
     if (_root == nullptr) return prefix_iterator(nullptr);
     return prefix_iterator(_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_prefix() noexcept
 {
     if (_root == nullptr) return prefix_iterator(nullptr);
     node* cur = _root;
@@ -2900,17 +2993,17 @@ binary_search_tree<tkey, tvalue, compare, tag>::end_prefix() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_prefix() const noexcept
 {
     if (_root == nullptr) return prefix_const_iterator(nullptr);
     return prefix_const_iterator(_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_prefix() const noexcept
 {
     if (_root == nullptr) return prefix_const_iterator(nullptr);
     node* cur = _root;
@@ -2920,23 +3013,23 @@ binary_search_tree<tkey, tvalue, compare, tag>::end_prefix() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cbegin_prefix() const noexcept
 {
     return begin_prefix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cend_prefix() const noexcept
 {
     return end_prefix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_prefix() noexcept
 {
     if (_root == nullptr) return prefix_reverse_iterator(nullptr);
     node* cur = _root;
@@ -2944,9 +3037,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rbegin_prefix() noexcept
     return prefix_reverse_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_prefix() noexcept
 {
     if (_root == nullptr) return prefix_reverse_iterator(nullptr);
     auto it = prefix_reverse_iterator(_root);
@@ -2954,9 +3047,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend_prefix() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_prefix() const noexcept
 {
     if (_root == nullptr) return prefix_const_reverse_iterator(nullptr);
     node* cur = _root;
@@ -2964,9 +3057,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::rbegin_prefix() const noexcept
     return prefix_const_reverse_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_prefix() const noexcept
 {
     if (_root == nullptr) return prefix_const_reverse_iterator(nullptr);
     auto it = prefix_const_reverse_iterator(_root);
@@ -2974,16 +3067,16 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend_prefix() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crbegin_prefix() const noexcept
 {
     return rbegin_prefix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::prefix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::prefix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crend_prefix() const noexcept
 {
     return rend_prefix();
 }
@@ -2992,86 +3085,86 @@ binary_search_tree<tkey, tvalue, compare, tag>::crend_prefix() const noexcept
 
 // region infix_iterators methods implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_infix() noexcept
 {
     return begin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_infix() noexcept
 {
     return end();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_infix() const noexcept
 {
     return begin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_infix() const noexcept
 {
     return end();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cbegin_infix() const noexcept
 {
     return cbegin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cend_infix() const noexcept
 {
     return cend();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_infix() noexcept
 {
     return rbegin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_infix() noexcept
 {
     return rend();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_infix() const noexcept
 {
     return rbegin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_infix() const noexcept
 {
     return rend();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crbegin_infix() const noexcept
 {
     return crbegin();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::infix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::infix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crend_infix() const noexcept
 {
     return crend();
 }
@@ -3080,9 +3173,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::crend_infix() const noexcept
 
 // region postfix_iterators requests implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_postfix() noexcept
 {
     if (_root == nullptr) return postfix_iterator(nullptr);
 
@@ -3097,9 +3190,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::begin_postfix() noexcept
     return postfix_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_postfix() noexcept
 {
     if (_root == nullptr) return postfix_iterator(nullptr);
     auto it = postfix_iterator(_root);
@@ -3107,9 +3200,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::end_postfix() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::begin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::begin_postfix() const noexcept
 {
     if (_root == nullptr) return postfix_const_iterator(nullptr);
 
@@ -3124,9 +3217,9 @@ binary_search_tree<tkey, tvalue, compare, tag>::begin_postfix() const noexcept
     return postfix_const_iterator(cur);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::end_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::end_postfix() const noexcept
 {
     if (_root == nullptr) return postfix_const_iterator(nullptr);
     auto it = postfix_const_iterator(_root);
@@ -3134,31 +3227,31 @@ binary_search_tree<tkey, tvalue, compare, tag>::end_postfix() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cbegin_postfix() const noexcept
 {
     return begin_postfix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::cend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::cend_postfix() const noexcept
 {
     return end_postfix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_postfix() noexcept
 {
     if (_root == nullptr) return postfix_reverse_iterator(nullptr);
     return postfix_reverse_iterator(_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_postfix() noexcept
 {
     if (_root == nullptr) return postfix_reverse_iterator(nullptr);
 
@@ -3175,17 +3268,17 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend_postfix() noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rbegin_postfix() const noexcept
 {
     if (_root == nullptr) return postfix_const_reverse_iterator(nullptr);
     return postfix_const_reverse_iterator(_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::rend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::rend_postfix() const noexcept
 {
     if (_root == nullptr) return postfix_const_reverse_iterator(nullptr);
 
@@ -3202,16 +3295,16 @@ binary_search_tree<tkey, tvalue, compare, tag>::rend_postfix() const noexcept
     return it;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crbegin_postfix() const noexcept
 {
     return rbegin_postfix();
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-typename binary_search_tree<tkey, tvalue, compare, tag>::postfix_const_reverse_iterator
-binary_search_tree<tkey, tvalue, compare, tag>::crend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::postfix_const_reverse_iterator
+binary_search_tree<tkey, tvalue, compare, tag, tallocator>::crend_postfix() const noexcept
 {
     return rend_postfix();
 }
@@ -3222,8 +3315,8 @@ binary_search_tree<tkey, tvalue, compare, tag>::crend_postfix() const noexcept
 
 //region subtree rotations implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::small_left_rotation(node*& subtree_root) noexcept {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::small_left_rotation(node*& subtree_root) noexcept {
     if (subtree_root == nullptr || subtree_root->right_subtree == nullptr) return;
 
     node* new_root = subtree_root->right_subtree;
@@ -3247,8 +3340,8 @@ void binary_search_tree<tkey, tvalue, compare, tag>::small_left_rotation(node*&
     subtree_root = new_root;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::small_right_rotation(node*& subtree_root) noexcept {
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::small_right_rotation(node*& subtree_root) noexcept {
     if (subtree_root == nullptr || subtree_root->left_subtree == nullptr) return;
 
     node* new_root = subtree_root->left_subtree;
@@ -3271,32 +3364,32 @@ void binary_search_tree<tkey, tvalue, compare, tag>::small_right_rotation(node*&
     subtree_root = new_root;
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::big_left_rotation(node *&subtree_root) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::big_left_rotation(node *&subtree_root) noexcept
 {
     if (subtree_root == nullptr || subtree_root->right_subtree == nullptr || subtree_root->right_subtree->left_subtree == nullptr) return;
     small_right_rotation(subtree_root->right_subtree);
     small_left_rotation(subtree_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::big_right_rotation(node *&subtree_root) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::big_right_rotation(node *&subtree_root) noexcept
 {
     if (subtree_root == nullptr || subtree_root->left_subtree == nullptr || subtree_root->left_subtree->right_subtree == nullptr) return;
     small_left_rotation(subtree_root->left_subtree);
     small_right_rotation(subtree_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::double_left_rotation(node *&subtree_root) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::double_left_rotation(node *&subtree_root) noexcept
 {
     if (subtree_root == nullptr || subtree_root->right_subtree == nullptr || subtree_root->right_subtree->right_subtree == nullptr) return;
     small_left_rotation(subtree_root);
     small_left_rotation(subtree_root);
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare, typename tag>
-void binary_search_tree<tkey, tvalue, compare, tag>::double_right_rotation(node *&subtree_root) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tag, typename tallocator>
+void binary_search_tree<tkey, tvalue, compare, tag, tallocator>::double_right_rotation(node *&subtree_root) noexcept
 {
     if (subtree_root == nullptr || subtree_root->left_subtree == nullptr || subtree_root->left_subtree->left_subtree == nullptr) return;
     small_right_rotation(subtree_root);
@@ -3306,33 +3399,33 @@ void binary_search_tree<tkey, tvalue, compare, tag>::double_right_rotation(node
 //endregion subtree rotations implementation
 
 namespace __detail {
-    template<typename tkey, typename tvalue, typename compare, typename tag>
+    template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
     template<typename ...Args>
-    typename binary_search_tree<tkey, tvalue, compare, tag>::node*
-    bst_impl<tkey, tvalue, compare, tag>::create_node(binary_search_tree<tkey, tvalue, compare, tag>& cont, Args&& ...args)
+    typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node*
+    bst_impl<tkey, tvalue, compare, tag, tallocator>::create_node(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, Args&& ...args)
     {
-        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag>::node;
+        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node;
 
-        node_type* new_node = cont._allocator.template new_object<node_type>(std::forward<Args>(args)...);
+        node_type* new_node = cont.template new_node<node_type>(std::forward<Args>(args)...);
         return new_node;
     }
 
-    template<typename tkey, typename tvalue, typename compare, typename tag>
-    void bst_impl<tkey, tvalue, compare, tag>::delete_node(
-        binary_search_tree<tkey, tvalue, compare, tag>& cont,
-        typename binary_search_tree<tkey, tvalue, compare, tag>::node** node)
+    template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, tag, tallocator>::delete_node(
+        binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont,
+        typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node** node)
     {
-        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag>::node;
+        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node;
         if (node){
             cont._allocator.template delete_object<node_type>(*node);
             *node = nullptr;
         }
     }
 
-    template<typename tkey, typename tvalue, typename compare, typename tag>
-    void bst_impl<tkey, tvalue, compare, tag>::erase(binary_search_tree<tkey, tvalue, compare, tag>& cont, typename binary_search_tree<tkey, tvalue, compare, tag>::node** node_ptr)
+    template<typename tkey, typename tvalue, typename compare, typename tag, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, tag, tallocator>::erase(binary_search_tree<tkey, tvalue, compare, tag, tallocator>& cont, typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node** node_ptr)
     {
-        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag>::node;
+        using node_type = typename binary_search_tree<tkey, tvalue, compare, tag, tallocator>::node;
         node_type* node = *node_ptr;
         if (node == nullptr) return;
 
@@ -7,28 +7,28 @@ namespace __detail
 {
     class RB_TAG;
 
-    template<typename tkey, typename tvalue, typename compare>
-    class bst_impl<tkey, tvalue, compare, RB_TAG>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    class bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>
     {
         template<class ...Args>
-        static binary_search_tree<tkey, tvalue, compare, RB_TAG>::node* create_node(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, Args&& ...args);
+        static binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node* create_node(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont, Args&& ...args);
 
-        static void delete_node(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont);
+        static void delete_node(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont);
 
         //Does not invalidate node*, needed for splay tree
-        static void post_search(binary_search_tree<tkey, tvalue, compare, RB_TAG>::node**){}
+        static void post_search(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node**){}
 
         //Does not invalidate node*
-        static void post_insert(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, binary_search_tree<tkey, tvalue, compare, RB_TAG>::node**);
+        static void post_insert(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node**);
 
-        static void erase(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, binary_search_tree<tkey, tvalue, compare, RB_TAG>::node**);
+        static void erase(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node**);
 
-        static void swap(binary_search_tree<tkey, tvalue, compare, RB_TAG>& lhs, binary_search_tree<tkey, tvalue, compare, RB_TAG>& rhs) noexcept;
+        static void swap(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& lhs, binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& rhs) noexcept;
     };
 }
 
-template<typename tkey,typename tvalue, compator<tkey> compare = std::less<tkey>>
-class red_black_tree final: public binary_search_tree<tkey, tvalue, compare, __detail::RB_TAG>
+template<typename tkey,typename tvalue, compator<tkey> compare = std::less<tkey>, typename tallocator = pp_allocator<std::pair<const tkey, tvalue>>>
+class red_black_tree final: public binary_search_tree<tkey, tvalue, compare, __detail::RB_TAG, tallocator>
 {
 
 public:
@@ -41,7 +41,7 @@ public:
 
 private:
 
-    using parent = binary_search_tree<tkey, tvalue, compare, __detail::RB_TAG>;
+    using parent = binary_search_tree<tkey, tvalue, compare, __detail::RB_TAG, tallocator>;
     
     struct node final:
         parent::node
@@ -61,27 +61,27 @@ public:
 
     explicit red_black_tree(
             const compare& comp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger *logger = nullptr);
 
     explicit red_black_tree(
-            pp_allocator<value_type> alloc,
+            tallocator alloc,
             const compare& comp = compare(),
             logger *logger = nullptr);
 
     template<input_iterator_for_pair<tkey, tvalue> iterator>
     explicit red_black_tree(iterator begin, iterator end, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
     template<std::ranges::input_range Range>
     explicit red_black_tree(Range&& range, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
 
     red_black_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
 
@@ -583,40 +583,40 @@ namespace __detail {
 
     class RB_TAG {};
 
-    template<typename tkey, typename tvalue, typename compare>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
     template<class ...Args>
-    binary_search_tree<tkey, tvalue, compare, RB_TAG>::node* bst_impl<tkey, tvalue, compare, RB_TAG>::create_node(
-            binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, Args&& ...args)
+    binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node* bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>::create_node(
+            binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont, Args&& ...args)
     {
         throw not_implemented("template<typename tkey, typename tvalue, typename compare> template<class ...Args> binary_search_tree<tkey, tvalue, compare, RB_TAG>::node* bst_impl<tkey, tvalue, compare, RB_TAG>::create_node(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, Args&& ...args)", "your code should be here...");
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, RB_TAG>::delete_node(
-            binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>::delete_node(
+            binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont)
     {
         throw not_implemented("template<typename tkey, typename tvalue, typename compare> void bst_impl<tkey, tvalue, compare, RB_TAG>::delete_node(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont)", "your code should be here...");
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, RB_TAG>::post_insert(
-            binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont,
-            typename binary_search_tree<tkey, tvalue, compare, RB_TAG>::node** n)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>::post_insert(
+            binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont,
+            typename binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node** n)
     {
         throw not_implemented("template<typename tkey, typename tvalue, typename compare> void bst_impl<tkey, tvalue, compare, RB_TAG>::post_insert(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, typename binary_search_tree<tkey, tvalue, compare, RB_TAG>::node**)", "your code should be here...");
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, RB_TAG>::erase(
-            binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont,
-            typename binary_search_tree<tkey, tvalue, compare, RB_TAG>::node** n)
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>::erase(
+            binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>& cont,
+            typename binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator>::node** n)
     {
         throw not_implemented("template<typename tkey, typename tvalue, typename compare> void bst_impl<tkey, tvalue, compare, RB_TAG>::erase(binary_search_tree<tkey, tvalue, compare, RB_TAG>& cont, typename binary_search_tree<tkey, tvalue, compare, RB_TAG>::node**)", "your code should be here...");
     }
 
-    template<typename tkey, typename tvalue, typename compare>
-    void bst_impl<tkey, tvalue, compare, RB_TAG>::swap(binary_search_tree<tkey, tvalue, compare, RB_TAG> &lhs,
-                                                                            binary_search_tree<tkey, tvalue, compare, RB_TAG> &rhs) noexcept
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    void bst_impl<tkey, tvalue, compare, RB_TAG, tallocator>::swap(binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator> &lhs,
+                                                                            binary_search_tree<tkey, tvalue, compare, RB_TAG, tallocator> &rhs) noexcept
     {
         throw not_implemented("template<typename tkey, typename tvalue, typename compare>\n"
                               "void bst_impl<tkey, tvalue, compare, RB_TAG>::swap(binary_search_tree<tkey, tvalue, compare, RB_TAG> &lhs,\n"
@@ -625,58 +625,58 @@ namespace __detail {
 }
 
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-red_black_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args)
+red_black_tree<tkey, tvalue, compare, tallocator>::node::node(parent::node* par, Args&&... args)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<class ...Args> red_black_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(
         const compare& comp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger *logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> red_black_tree<tkey, tvalue, compare>::red_black_tree(const compare& , pp_allocator<value_type> , logger *)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(
-        pp_allocator<value_type> alloc,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(
+        tallocator alloc,
         const compare& comp,
         logger *logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> red_black_tree<tkey, tvalue, compare>::red_black_tree(pp_allocator<value_type> , const compare& , logger *)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<input_iterator_for_pair<tkey, tvalue> iterator>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(
         iterator begin, iterator end,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<input_iterator_for_pair<tkey, tvalue> iterator> red_black_tree<tkey, tvalue, compare>::red_black_tree(iterator , iterator , const compare& , pp_allocator<value_type> , logger* )", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<std::ranges::input_range Range>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(
         Range&& range,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<std::ranges::input_range Range> red_black_tree<tkey, tvalue, compare>::red_black_tree( Range&& range, const compare& cmp, pp_allocator<value_type> alloc, logger* logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> red_black_tree<tkey, tvalue, compare>::red_black_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp, pp_allocator<value_type> alloc, logger* logger)", "your code should be here...");
@@ -684,362 +684,362 @@ red_black_tree<tkey, tvalue, compare>::red_black_tree(
 
 // region iterator implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::prefix_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::prefix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::prefix_iterator(parent::prefix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> red_black_tree<tkey, tvalue, compare>::prefix_iterator::prefix_iterator(parent::prefix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::prefix_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::prefix_iterator::get_color() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::prefix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(parent::prefix_const_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(parent::prefix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::get_color() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(prefix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator::prefix_const_iterator(prefix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_iterator::prefix_const_iterator(prefix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::prefix_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(parent::prefix_reverse_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(parent::prefix_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::get_color() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(prefix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::prefix_reverse_iterator(prefix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::prefix_reverse_iterator(prefix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::prefix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::operator prefix_iterator() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_iterator
-red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator::base() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_iterator red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator::base() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::prefix_const_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::prefix_const_reverse_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(parent::prefix_const_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::get_color() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(prefix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(prefix_const_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::prefix_const_reverse_iterator(prefix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::prefix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::operator prefix_const_iterator() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator
-red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator::base() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator::base() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator::infix_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::infix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator::infix_iterator(parent::infix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_iterator::infix_iterator(parent::infix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::infix_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::infix_iterator::get_color() const noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::infix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(parent::infix_const_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(parent::infix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::infix_const_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::get_color() const noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::infix_const_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(infix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator::infix_const_iterator(infix_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_iterator::infix_const_iterator(infix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(parent::node* n) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::node* n) noexcept) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::infix_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(parent::infix_reverse_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(parent::infix_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::get_color() const noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(infix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::infix_reverse_iterator(infix_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::infix_reverse_iterator(infix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::infix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator() const noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::operator infix_iterator() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator::base() const noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator::base() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::node* n) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::infix_const_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::infix_const_reverse_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(parent::infix_const_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::get_color() const noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(infix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::infix_const_reverse_iterator(infix_const_iterator it) noexcept
 {
 throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::infix_const_reverse_iterator(infix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::infix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::operator infix_const_iterator() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator::base() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator::base() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::postfix_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::postfix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::postfix_iterator(parent::postfix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_iterator::postfix_iterator(parent::postfix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::postfix_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::postfix_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::postfix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(parent::postfix_const_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(parent::postfix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(postfix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator::postfix_const_iterator(postfix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_iterator::postfix_const_iterator(postfix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::postfix_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(parent::postfix_reverse_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(parent::postfix_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(postfix_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::postfix_reverse_iterator(postfix_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::postfix_reverse_iterator(postfix_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::postfix_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::operator postfix_iterator() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_iterator
-red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator::base() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_iterator red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator::base() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::node* n) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::node* n) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::node* n) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::postfix_const_reverse_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::postfix_const_reverse_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(parent::postfix_const_reverse_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::node_color
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::get_color() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::node_color
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::get_color() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::node_color red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::get_color() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(postfix_const_iterator it) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(postfix_const_iterator it) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::postfix_const_reverse_iterator(postfix_const_iterator it) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare>::postfix_const_iterator() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::operator red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::operator postfix_const_iterator() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator
-red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::base() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator::base() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::base() const noexcept", "your code should be here...");
 }
@@ -1048,338 +1048,338 @@ red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator::base() co
 
 // region iterator requests implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::begin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::begin() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::end() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::end() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::begin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::begin() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::end() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::end() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cbegin() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::cbegin() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cend() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::cend() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crbegin() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crbegin() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crbegin() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crend() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crend() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crend() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_iterator
-red_black_tree<tkey, tvalue, compare>::begin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_prefix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_iterator red_black_tree<tkey, tvalue, compare>::begin_prefix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_iterator
-red_black_tree<tkey, tvalue, compare>::end_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_prefix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_iterator red_black_tree<tkey, tvalue, compare>::end_prefix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator
-red_black_tree<tkey, tvalue, compare>::begin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator red_black_tree<tkey, tvalue, compare>::begin_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator
-red_black_tree<tkey, tvalue, compare>::end_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator red_black_tree<tkey, tvalue, compare>::end_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cbegin_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator red_black_tree<tkey, tvalue, compare>::cbegin_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cend_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_iterator red_black_tree<tkey, tvalue, compare>::cend_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_prefix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_reverse_iteratorred_black_tree<tkey, tvalue, compare>::rbegin_prefix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_prefix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_prefix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_prefix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crbegin_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crbegin_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crbegin_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crend_prefix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::prefix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crend_prefix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::prefix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crend_prefix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::begin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_infix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::begin_infix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::end_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_infix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::end_infix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::begin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::begin_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::end_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::end_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cbegin_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::cbegin_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cend_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::cend_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_infix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin_infix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_infix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_infix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_infix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crbegin_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crbegin_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crbegin_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crend_infix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crend_infix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crend_infix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_iterator
-red_black_tree<tkey, tvalue, compare>::begin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_postfix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_iterator red_black_tree<tkey, tvalue, compare>::begin_postfix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_iterator
-red_black_tree<tkey, tvalue, compare>::end_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_postfix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_iterator red_black_tree<tkey, tvalue, compare>::end_postfix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator
-red_black_tree<tkey, tvalue, compare>::begin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::begin_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator red_black_tree<tkey, tvalue, compare>::begin_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator
-red_black_tree<tkey, tvalue, compare>::end_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::end_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator red_black_tree<tkey, tvalue, compare>::end_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cbegin_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator red_black_tree<tkey, tvalue, compare>::cbegin_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator
-red_black_tree<tkey, tvalue, compare>::cend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::cend_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_iterator red_black_tree<tkey, tvalue, compare>::cend_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_postfix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin_postfix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_postfix() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_postfix() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_postfix() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rbegin_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rbegin_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::rend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::rend_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::rend_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crbegin_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crbegin_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crbegin_postfix() const noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator
-red_black_tree<tkey, tvalue, compare>::crend_postfix() const noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::postfix_const_reverse_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::crend_postfix() const noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::postfix_const_reverse_iterator red_black_tree<tkey, tvalue, compare>::crend_postfix() const noexcept", "your code should be here...");
 }
@@ -1388,156 +1388,156 @@ red_black_tree<tkey, tvalue, compare>::crend_postfix() const noexcept
 
 // region rb_tree implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::~red_black_tree() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::~red_black_tree() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::~red_black_tree() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(red_black_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(red_black_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::red_black_tree(red_black_tree const &other)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare> &
-red_black_tree<tkey, tvalue, compare>::operator=(red_black_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator> &
+red_black_tree<tkey, tvalue, compare, tallocator>::operator=(red_black_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare> & red_black_tree<tkey, tvalue, compare>::operator=(red_black_tree const &other)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare>::red_black_tree(red_black_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator>::red_black_tree(red_black_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare>::red_black_tree(red_black_tree &&other) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-red_black_tree<tkey, tvalue, compare> &
-red_black_tree<tkey, tvalue, compare>::operator=(red_black_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+red_black_tree<tkey, tvalue, compare, tallocator> &
+red_black_tree<tkey, tvalue, compare, tallocator>::operator=(red_black_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> red_black_tree<tkey, tvalue, compare> & red_black_tree<tkey, tvalue, compare>::operator=(red_black_tree &&other) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-void red_black_tree<tkey, tvalue, compare>::swap(parent& other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+void red_black_tree<tkey, tvalue, compare, tallocator>::swap(parent& other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> void red_black_tree<tkey, tvalue, compare>::swap(parent& other) noexcept", "your code should be here...");
 }
 
 // endregion rb_tree implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool>
-red_black_tree<tkey, tvalue, compare>::insert(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+std::pair<typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+red_black_tree<tkey, tvalue, compare, tallocator>::insert(const value_type& value)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool> red_black_tree<tkey, tvalue, compare>::insert(const value_type& value)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool>
-red_black_tree<tkey, tvalue, compare>::insert(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+std::pair<typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+red_black_tree<tkey, tvalue, compare, tallocator>::insert(value_type&& value)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool> red_black_tree<tkey, tvalue, compare>::insert(value_type&& value)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool>
-red_black_tree<tkey, tvalue, compare>::emplace(Args&&... args)
+std::pair<typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator, bool>
+red_black_tree<tkey, tvalue, compare, tallocator>::emplace(Args&&... args)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> template<class ...Args> std::pair<typename red_black_tree<tkey, tvalue, compare>::infix_iterator, bool> red_black_tree<tkey, tvalue, compare>::emplace(Args&&... args)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::insert_or_assign(const value_type& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::insert_or_assign(const value_type& value)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::insert_or_assign(const value_type& value)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::insert_or_assign(value_type&& value)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::insert_or_assign(value_type&& value)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::insert_or_assign(value_type&& value)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::emplace_or_assign(Args&&... args)
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::emplace_or_assign(Args&&... args)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> template<class ...Args> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::emplace_or_assign(Args&&... args)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::find(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::find(const tkey& key)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::find(const tkey& key)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::find(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::find(const tkey& key) const
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::find(const tkey& key) const", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::lower_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::lower_bound(const tkey& key)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::lower_bound(const tkey& key)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::lower_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::lower_bound(const tkey& key) const
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::lower_bound(const tkey& key) const", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::upper_bound(const tkey& key)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::upper_bound(const tkey& key)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::upper_bound(const tkey& key)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator
-red_black_tree<tkey, tvalue, compare>::upper_bound(const tkey& key) const
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_const_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::upper_bound(const tkey& key) const
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_const_iterator red_black_tree<tkey, tvalue, compare>::upper_bound(const tkey& key) const", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::erase(infix_iterator pos)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::erase(infix_iterator pos)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::erase(infix_iterator pos)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::erase(infix_const_iterator pos)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::erase(infix_const_iterator pos)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::erase(infix_const_iterator pos)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::erase(infix_iterator first, infix_iterator last)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::erase(infix_iterator first, infix_iterator last)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::erase(infix_iterator first, infix_iterator last)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-typename red_black_tree<tkey, tvalue, compare>::infix_iterator
-red_black_tree<tkey, tvalue, compare>::erase(infix_const_iterator first, infix_const_iterator last)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+typename red_black_tree<tkey, tvalue, compare, tallocator>::infix_iterator
+red_black_tree<tkey, tvalue, compare, tallocator>::erase(infix_const_iterator first, infix_const_iterator last)
 {
     throw not_implemented("template<typename tkey, typename tvalue, typename compare> typename red_black_tree<tkey, tvalue, compare>::infix_iterator red_black_tree<tkey, tvalue, compare>::erase(infix_const_iterator first, infix_const_iterator last)", "your code should be here...");
 }
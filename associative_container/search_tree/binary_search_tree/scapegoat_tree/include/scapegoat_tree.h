@@ -8,34 +8,34 @@ namespace __detail
 {
     class SPG_TAG;
 
-    template<typename tkey, typename tvalue, typename compare>
-    class bst_impl<tkey, tvalue, compare, SPG_TAG>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    class bst_impl<tkey, tvalue, compare, SPG_TAG, tallocator>
     {
         template<class ...Args>
-        static binary_search_tree<tkey, tvalue, compare, SPG_TAG>::node* create_node(binary_search_tree<tkey, tvalue, compare, SPG_TAG>& cont, Args&& ...args);
+        static binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>::node* create_node(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& cont, Args&& ...args);
 
-        static void delete_node(binary_search_tree<tkey, tvalue, compare, SPG_TAG>& cont);
+        static void delete_node(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& cont);
 
         //Does not invalidate node*, needed for splay tree
-        static void post_search(binary_search_tree<tkey, tvalue, compare, SPG_TAG>::node**){}
+        static void post_search(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>::node**){}
 
         //Does not invalidate node*
-        static void post_insert(binary_search_tree<tkey, tvalue, compare, SPG_TAG>& cont, binary_search_tree<tkey, tvalue, compare, SPG_TAG>::node**);
+        static void post_insert(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>::node**);
 
-        static void erase(binary_search_tree<tkey, tvalue, compare, SPG_TAG>& cont, binary_search_tree<tkey, tvalue, compare, SPG_TAG>::node**);
+        static void erase(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>::node**);
 
-        static void swap(binary_search_tree<tkey, tvalue, compare, SPG_TAG>& lhs, binary_search_tree<tkey, tvalue, compare, SPG_TAG>& rhs) noexcept;
+        static void swap(binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& lhs, binary_search_tree<tkey, tvalue, compare, SPG_TAG, tallocator>& rhs) noexcept;
     };
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>>
+template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>, typename tallocator = pp_allocator<std::pair<const tkey, tvalue>>>
 class scapegoat_tree final:
-    public binary_search_tree<tkey, tvalue, compare, __detail::SPG_TAG>
+    public binary_search_tree<tkey, tvalue, compare, __detail::SPG_TAG, tallocator>
 {
 
 private:
 
-    using parent = binary_search_tree<tkey, tvalue, compare, __detail::SPG_TAG>;
+    using parent = binary_search_tree<tkey, tvalue, compare, __detail::SPG_TAG, tallocator>;
     
     struct node final:
         parent::node
@@ -59,27 +59,27 @@ public:
 
     explicit scapegoat_tree(
             const compare& comp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger *logger = nullptr, double alpha = 0.7);
 
     explicit scapegoat_tree(
-            pp_allocator<value_type> alloc,
+            tallocator alloc,
             const compare& comp = compare(),
             logger *logger = nullptr, double alpha = 0.7);
 
     template<input_iterator_for_pair<tkey, tvalue> iterator>
     explicit scapegoat_tree(iterator begin, iterator end, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr, double alpha = 0.7);
 
     template<std::ranges::input_range Range>
     explicit scapegoat_tree(Range&& range, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr, double alpha = 0.7);
 
 
     scapegoat_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr, double alpha = 0.7);
 
 public:
@@ -120,50 +120,50 @@ scapegoat_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compar
 
 // region implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::node::node(tkey const &key_, tvalue &&value_)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::node::node(tkey const &key_, tvalue &&value_)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::node::node(tkey const &key_, tvalue &&value_)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::node::node(tkey const &key_, const tvalue& value_)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::node::node(tkey const &key_, const tvalue& value_)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::node::node(tkey const &key_, const tvalue& value_)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<class ...Args>
-scapegoat_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args)
+scapegoat_tree<tkey, tvalue, compare, tallocator>::node::node(parent::node* par, Args&&... args)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<class ...Args> scapegoat_tree<tkey, tvalue, compare>::node::node(parent::node* par, Args&&... args)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-void scapegoat_tree<tkey, tvalue, compare>::node::recalculate_size() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+void scapegoat_tree<tkey, tvalue, compare, tallocator>::node::recalculate_size() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> void scapegoat_tree<tkey, tvalue, compare>::node::recalculate_size() noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-bool scapegoat_tree<tkey, tvalue, compare>::node::is_disbalanced(double alpha) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+bool scapegoat_tree<tkey, tvalue, compare, tallocator>::node::is_disbalanced(double alpha) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> bool scapegoat_tree<tkey, tvalue, compare>::node::is_disbalanced(double alpha) noexcept ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(
         const compare& comp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger *logger,
         double alpha)
 {
     throw not_implemented("emplate<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(const compare& comp, pp_allocator<value_type> alloc, logger *logger, double alpha)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
-        pp_allocator<value_type> alloc,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(
+        tallocator alloc,
         const compare& comp,
         logger *logger,
         double alpha)
@@ -171,74 +171,74 @@ scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(pp_allocator<value_type> alloc, const compare& comp, logger *logger, double alpha)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<input_iterator_for_pair<tkey, tvalue> iterator>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(
         iterator begin,
         iterator end,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger,
         double alpha)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<input_iterator_for_pair<tkey, tvalue> iterator> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(iterator begin, iterator end, const compare& cmp, pp_allocator<value_type> alloc, logger* logger,double alpha)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<std::ranges::input_range Range>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(
         Range&& range,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger,
         double alpha)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<std::ranges::input_range Range>scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(Range&& range, const compare& cmp, pp_allocator<value_type> alloc, logger* logger, double alpha)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger,
         double alpha)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp, pp_allocator<value_type> alloc, logger* logger, double alpha)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::~scapegoat_tree() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::~scapegoat_tree() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::~scapegoat_tree() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(scapegoat_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(scapegoat_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(scapegoat_tree const &other)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare> &scapegoat_tree<tkey, tvalue, compare>::operator=(scapegoat_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator> &scapegoat_tree<tkey, tvalue, compare, tallocator>::operator=(scapegoat_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare> &scapegoat_tree<tkey, tvalue, compare>::operator=(scapegoat_tree const &other) ", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(scapegoat_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator>::scapegoat_tree(scapegoat_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare>::scapegoat_tree(scapegoat_tree &&other) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-scapegoat_tree<tkey, tvalue, compare> &scapegoat_tree<tkey, tvalue, compare>::operator=(scapegoat_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+scapegoat_tree<tkey, tvalue, compare, tallocator> &scapegoat_tree<tkey, tvalue, compare, tallocator>::operator=(scapegoat_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> scapegoat_tree<tkey, tvalue, compare> &scapegoat_tree<tkey, tvalue, compare>::operator=(scapegoat_tree &&other) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-void scapegoat_tree<tkey, tvalue, compare>::setup_alpha(double alpha)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+void scapegoat_tree<tkey, tvalue, compare, tallocator>::setup_alpha(double alpha)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> void scapegoat_tree<tkey, tvalue, compare>::setup_alpha(double alpha)", "your code should be here...");
 }
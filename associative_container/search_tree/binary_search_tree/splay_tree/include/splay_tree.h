@@ -7,58 +7,58 @@ namespace __detail
 {
     class SPL_TAG;
 
-    template<typename tkey, typename tvalue, typename compare>
-    class bst_impl<tkey, tvalue, compare, SPL_TAG>
+    template<typename tkey, typename tvalue, typename compare, typename tallocator>
+    class bst_impl<tkey, tvalue, compare, SPL_TAG, tallocator>
     {
         template<class ...Args>
-        static binary_search_tree<tkey, tvalue, compare, SPL_TAG>::node* create_node(binary_search_tree<tkey, tvalue, compare, SPL_TAG>& cont, Args&& ...args);
+        static binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>::node* create_node(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& cont, Args&& ...args);
 
-        static void delete_node(binary_search_tree<tkey, tvalue, compare, SPL_TAG>& cont);
+        static void delete_node(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& cont);
 
         //Does not invalidate node*, needed for splay tree
-        static void post_search(binary_search_tree<tkey, tvalue, compare, SPL_TAG>::node**){}
+        static void post_search(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>::node**){}
 
         //Does not invalidate node*
-        static void post_insert(binary_search_tree<tkey, tvalue, compare, SPL_TAG>& cont, binary_search_tree<tkey, tvalue, compare, SPL_TAG>::node**);
+        static void post_insert(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>::node**);
 
-        static void erase(binary_search_tree<tkey, tvalue, compare, SPL_TAG>& cont, binary_search_tree<tkey, tvalue, compare, SPL_TAG>::node**);
+        static void erase(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& cont, binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>::node**);
 
-        static void swap(binary_search_tree<tkey, tvalue, compare, SPL_TAG>& lhs, binary_search_tree<tkey, tvalue, compare, SPL_TAG>& rhs) noexcept;
+        static void swap(binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& lhs, binary_search_tree<tkey, tvalue, compare, SPL_TAG, tallocator>& rhs) noexcept;
     };
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>>
-class splay_tree final: public binary_search_tree<tkey, tvalue, compare, __detail::SPL_TAG>
+template<typename tkey, typename tvalue, compator<tkey> compare = std::less<tkey>, typename tallocator = pp_allocator<std::pair<const tkey, tvalue>>>
+class splay_tree final: public binary_search_tree<tkey, tvalue, compare, __detail::SPL_TAG, tallocator>
 {
 
-    using parent = binary_search_tree<tkey, tvalue, compare, __detail::SPL_TAG>;
+    using parent = binary_search_tree<tkey, tvalue, compare, __detail::SPL_TAG, tallocator>;
 public:
 
     using value_type = parent::value_type;
 
     explicit splay_tree(
             const compare& comp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger *logger = nullptr);
 
     explicit splay_tree(
-            pp_allocator<value_type> alloc,
+            tallocator alloc,
             const compare& comp = compare(),
             logger *logger = nullptr);
 
     template<input_iterator_for_pair<tkey, tvalue> iterator>
     explicit splay_tree(iterator begin, iterator end, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
     template<std::ranges::input_range Range>
     explicit splay_tree(Range&& range, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
 
     splay_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp = compare(),
-            pp_allocator<value_type> alloc = pp_allocator<value_type>(),
+            tallocator alloc = tallocator(),
             logger* logger = nullptr);
 
 public:
@@ -92,83 +92,83 @@ splay_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& c
 
 // region implementation
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::splay_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(
         const compare& comp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger *logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::splay_tree(const compare& comp, pp_allocator<value_type> alloc, logger *logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::splay_tree(
-        pp_allocator<value_type> alloc,
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(
+        tallocator alloc,
         const compare& comp,
         logger *logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::splay_tree(pp_allocator<value_type> alloc, const compare& comp, logger *logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<input_iterator_for_pair<tkey, tvalue> iterator>
-splay_tree<tkey, tvalue, compare>::splay_tree(
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(
         iterator begin,
         iterator end,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<input_iterator_for_pair<tkey, tvalue> iterator>splay_tree<tkey, tvalue, compare>::splay_tree(iterator begin,iterator end,const compare& cmp,pp_allocator<value_type> alloc,logger* logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
 template<std::ranges::input_range Range>
-splay_tree<tkey, tvalue, compare>::splay_tree(
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(
         Range&& range,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> template<std::ranges::input_range Range> splay_tree<tkey, tvalue, compare>::splay_tree(Range&& range, const compare& cmp, pp_allocator<value_type> alloc, logger* logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::splay_tree(
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(
         std::initializer_list<std::pair<tkey, tvalue>> data,
         const compare& cmp,
-        pp_allocator<value_type> alloc,
+        tallocator alloc,
         logger* logger)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::splay_tree(std::initializer_list<std::pair<tkey, tvalue>> data, const compare& cmp, pp_allocator<value_type> alloc, logger* logger)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::~splay_tree() noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::~splay_tree() noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::~splay_tree() noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::splay_tree(splay_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(splay_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::splay_tree(splay_tree const &other)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare> &splay_tree<tkey, tvalue, compare>::operator=(splay_tree const &other)
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator> &splay_tree<tkey, tvalue, compare, tallocator>::operator=(splay_tree const &other)
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare> &splay_tree<tkey, tvalue, compare>::operator=(splay_tree const &other)", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare>::splay_tree(splay_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator>::splay_tree(splay_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare>::splay_tree(splay_tree &&other) noexcept", "your code should be here...");
 }
 
-template<typename tkey, typename tvalue, compator<tkey> compare>
-splay_tree<tkey, tvalue, compare> &splay_tree<tkey, tvalue, compare>::operator=(splay_tree &&other) noexcept
+template<typename tkey, typename tvalue, compator<tkey> compare, typename tallocator>
+splay_tree<tkey, tvalue, compare, tallocator> &splay_tree<tkey, tvalue, compare, tallocator>::operator=(splay_tree &&other) noexcept
 {
     throw not_implemented("template<typename tkey, typename tvalue, compator<tkey> compare> splay_tree<tkey, tvalue, compare> &splay_tree<tkey, tvalue, compare>::operator=(splay_tree &&other) noexcept", "your code should be here...");
 }
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <binary_search_tree.h>
+#include <static_allocator.h>
 #include <logger_builder.h>
 #include <client_logger_builder.h>
 #include <ranges>
@@ -546,6 +547,36 @@ TEST(binarySearchTreePositiveTests, test10)
 }
 
 
+TEST(binarySearchTreePositiveTests, test11)
+{
+    static_heap<first_fit_policy, no_lock_policy> heap(4096);
+    using tree_allocator = static_allocator<std::pair<int const, std::string>, decltype(heap)>;
+
+    {
+        // nodes come from the heap without any virtual call in between
+        binary_search_tree<int, std::string, std::less<int>, __detail::BST_TAG, tree_allocator> bst{ tree_allocator(heap) };
+
+        bst.emplace(6, "l");
+        bst.emplace(8, "c");
+        bst.emplace(2, "e");
+
+        EXPECT_EQ(bst.at(8), "c");
+        EXPECT_EQ(bst.size(), 3);
+
+        auto const blocks_info = heap.get_blocks_info();
+        ASSERT_EQ(blocks_info.size(), 4);
+        EXPECT_TRUE(blocks_info[0].is_block_occupied);
+        EXPECT_TRUE(blocks_info[2].is_block_occupied);
+        EXPECT_FALSE(blocks_info[3].is_block_occupied);
+    }
+
+    std::vector<allocator_test_utils::block_info> const expected_blocks_info
+        {
+            { .block_size = 4096, .is_block_occupied = false }
+        };
+    EXPECT_EQ(heap.get_blocks_info(), expected_blocks_info);
+}
+
 int main(
     int argc,
     char **argv)
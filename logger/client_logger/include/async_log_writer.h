@@ -0,0 +1,154 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ASYNC_LOG_WRITER_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ASYNC_LOG_WRITER_H
+
+#include <logger.h>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** Moves log output off the callers' threads. Callers push records into a bounded ring without locks,
+ *  a single writer thread takes them out in batches and hands every batch to the sink.
+ *  Every record pushed before the destructor starts is written before it returns
+ */
+class async_log_writer final
+{
+
+public:
+
+    /** What a caller does when the ring is full */
+    enum class overflow_policy
+    {
+        block,
+        drop,
+        drop_oldest
+    };
+
+    struct record
+    {
+        std::string message;
+        logger::severity severity;
+        std::time_t time;
+    };
+
+    using sink = std::function<void(std::vector<record> const &batch)>;
+
+    static constexpr const size_t max_batch_size = 256;
+
+    /** Attempts a blocked caller makes with yields in between before it sleeps until the next batch is written */
+    static constexpr const size_t block_spin_attempts = 64;
+
+private:
+
+    /** Cell of the bounded queue by D. Vyukov: its sequence tells which lap of the ring may use it next */
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        record value;
+    };
+
+    std::unique_ptr<cell[]> _cells;
+
+    size_t _mask;
+
+    overflow_policy _policy;
+
+    alignas(64) std::atomic<size_t> _enqueue_position = 0;
+
+    alignas(64) std::atomic<size_t> _dequeue_position = 0;
+
+    alignas(64) std::atomic<size_t> _dropped = 0;
+
+    /** Callers wake the writer only while it sleeps */
+    std::atomic<bool> _writer_idle = false;
+
+    std::mutex _mutex;
+
+    std::condition_variable _wake_writer;
+
+    /** Notified after every batch, wakes flush and callers blocked on a full ring */
+    std::condition_variable _batch_written;
+
+    /** Guarded by _mutex: every position below it is written or dropped */
+    size_t _written_position = 0;
+
+    /** Guarded by _mutex */
+    bool _stopping = false;
+
+    /** Held by the writer while a batch is in the sink */
+    std::mutex _sink_mutex;
+
+    sink _sink;
+
+    std::thread _writer;
+
+public:
+
+    /** capacity is rounded up to a power of two */
+    async_log_writer(
+        size_t capacity,
+        overflow_policy policy,
+        sink sink);
+
+    async_log_writer(
+        async_log_writer const &other) = delete;
+
+    async_log_writer &operator=(
+        async_log_writer const &other) = delete;
+
+    async_log_writer(
+        async_log_writer &&other) = delete;
+
+    async_log_writer &operator=(
+        async_log_writer &&other) = delete;
+
+    ~async_log_writer() noexcept;
+
+public:
+
+    size_t capacity() const noexcept;
+
+    overflow_policy policy() const noexcept;
+
+    /** false when the record itself was dropped */
+    bool push(
+        record &&value);
+
+    /** Returns once every record pushed before the call is written or dropped */
+    void flush();
+
+    /** Records lost to overflow so far */
+    size_t dropped() const noexcept;
+
+    /** Replaces the sink between two batches */
+    void set_sink(
+        sink sink);
+
+private:
+
+    /** Leaves value untouched when the ring is full */
+    bool try_push(
+        record &value);
+
+    bool try_pop(
+        record &value);
+
+    bool empty() const noexcept;
+
+    bool full() const noexcept;
+
+    /** Sleeps until the writer frees a cell of a full ring */
+    void wait_for_space();
+
+    void wake_writer();
+
+    void run();
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ASYNC_LOG_WRITER_H
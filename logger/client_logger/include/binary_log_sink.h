@@ -0,0 +1,129 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_BINARY_LOG_SINK_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_BINARY_LOG_SINK_H
+
+#include <logger.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/** Append-only binary log in a memory-mapped file. A record keeps the timestamp in nanoseconds,
+ *  the severity, the id of its format and the raw arguments, text is rendered only by read.
+ *  A format is written once, before the first record using it.
+ *
+ *  File: magic, then records until a zero tag.
+ *  format record: tag 1, u32 id, u32 length, bytes.
+ *  event record: tag 2, u64 nanoseconds, u8 severity, u32 format id, u8 arguments count, arguments.
+ *  argument: u8 log_argument index, then 8 raw bytes or, for a string, u32 length and bytes.
+ *  Numbers are in host byte order, so a file is read on the kind of machine that wrote it
+ */
+class binary_log_sink final
+{
+
+public:
+
+    struct decoded_record
+    {
+        uint64_t nanoseconds;
+        logger::severity severity;
+        std::string message;
+    };
+
+    static constexpr const char magic[8] = { 'M', 'P', 'O', 'S', 'B', 'L', 'G', '1' };
+
+private:
+
+    enum class record_tag : uint8_t
+    {
+        end,
+        format,
+        event
+    };
+
+    static constexpr const size_t initial_mapping_size = size_t(1) << 20;
+
+    std::string _path;
+
+    int _file;
+
+    std::byte *_data = nullptr;
+
+    size_t _mapped = 0;
+
+    size_t _used = 0;
+
+    /** Formats are told apart by address, literals with equal text in different places get their own ids */
+    std::unordered_map<char const *, uint32_t> _format_ids;
+
+    uint32_t _next_format_id = 0;
+
+    std::mutex _mutex;
+
+public:
+
+    /** Sink of the file shared by every logger writing to it. An existing log is continued at its end */
+    static std::shared_ptr<binary_log_sink> open(
+        std::string const &path);
+
+    binary_log_sink(
+        binary_log_sink const &other) = delete;
+
+    binary_log_sink &operator=(
+        binary_log_sink const &other) = delete;
+
+    binary_log_sink(
+        binary_log_sink &&other) = delete;
+
+    binary_log_sink &operator=(
+        binary_log_sink &&other) = delete;
+
+    /** Cuts the file down to the records written */
+    ~binary_log_sink() noexcept;
+
+public:
+
+    std::string const &path() const noexcept;
+
+    void write(
+        logger::severity severity,
+        char const *format,
+        std::span<logger::log_argument const> arguments);
+
+    /** Records of the file with the arguments put into their formats */
+    static std::vector<decoded_record> read(
+        std::string const &path);
+
+private:
+
+    explicit binary_log_sink(
+        std::string path);
+
+    /** Makes room for bytes more behind _used */
+    void reserve(
+        size_t bytes);
+
+    template<typename value_t>
+    void put(
+        value_t value) noexcept;
+
+    void put_bytes(
+        void const *bytes,
+        size_t count) noexcept;
+
+    /** Walks the records in order and returns where they end, 0 when the data does not start with magic */
+    static size_t parse(
+        std::byte const *data,
+        size_t size,
+        std::function<void(uint32_t id, std::string_view format)> const &on_format,
+        std::function<void(uint64_t nanoseconds, logger::severity severity, uint32_t format_id,
+                           std::vector<logger::log_argument> const &arguments)> const &on_event);
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_BINARY_LOG_SINK_H
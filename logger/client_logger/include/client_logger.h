@@ -2,7 +2,10 @@
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_H
 
 #include <logger.h>
+#include "async_log_writer.h"
+#include "binary_log_sink.h"
 #include <array>
+#include <memory>
 #include <unordered_map>
 #include <forward_list>
 #include <fstream>
@@ -42,24 +45,43 @@ private:
 
     //region refcounted_stream
 
-    enum class flag
-    { DATE, TIME, SEVERITY, MESSAGE, NO_FLAG };
-
 private:
 
     std::unordered_map<logger::severity ,std::pair<std::forward_list<refcounted_stream>, bool>> _output_streams;
 
-    std::string _format;
+    std::unordered_map<logger::severity, std::vector<std::shared_ptr<binary_log_sink>>> _binary_streams;
+
+    compiled_format _format;
+
+    //severity_bit of every severity with at least one text or binary stream
+    unsigned _enabled_severities = 0;
+
+    //nullptr for synchronous logging, declared last so pending records are written while the streams are open
+    std::unique_ptr<async_log_writer> _writer;
 
 
 private:
 
-    //opens all streams
-    client_logger(const std::unordered_map<logger::severity ,std::pair<std::forward_list<refcounted_stream>, bool>>& streams, std::string format);
+    //opens all streams, async_capacity 0 writes on the caller's thread
+    client_logger(const std::unordered_map<logger::severity ,std::pair<std::forward_list<refcounted_stream>, bool>>& streams, std::string format,
+                  const std::unordered_map<logger::severity, std::vector<std::string>>& binary_paths = {},
+                  size_t async_capacity = 0, async_log_writer::overflow_policy policy = async_log_writer::overflow_policy::block);
+
+    //writes the message to the text streams of its severity
+    void write_text(const std::string& message, severity sev);
+
+    //appends the record to the binary streams of its severity
+    void write_binary(severity sev, char const *format, std::span<log_argument const> arguments);
 
-    std::string make_format(const std::string& message, severity sev) const;
+    //valid until the next make_format on the calling thread
+    const std::string& make_format(const std::string& message, severity sev, std::time_t time) const;
 
-    static flag char_to_flag(char c) noexcept;
+    //writes a batch of records and flushes every stream it touched once
+    void write_batch(const std::vector<async_log_writer::record>& batch);
+
+    std::unique_ptr<async_log_writer> make_writer(size_t capacity, async_log_writer::overflow_policy policy);
+
+    static unsigned enabled_severities(const std::unordered_map<logger::severity ,std::pair<std::forward_list<refcounted_stream>, bool>>& streams) noexcept;
 
     friend client_logger_builder;
 public:
@@ -80,6 +102,21 @@ public:
         const std::string &message,
         logger::severity severity) & override;
 
+    //binary streams keep the arguments raw, text streams get the rendered message
+    logger& log_arguments(
+        logger::severity severity,
+        char const *format,
+        std::span<log_argument const> arguments) & override;
+
+    bool is_enabled(
+        logger::severity severity) const noexcept override;
+
+    //waits until every record logged so far reaches the streams, no-op for synchronous logging
+    void flush();
+
+    //records lost to a full queue under the drop policies
+    size_t dropped() const noexcept;
+
 };
 
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_H
\ No newline at end of file
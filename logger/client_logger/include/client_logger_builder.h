@@ -14,10 +14,19 @@ private:
 
     std::unordered_map<logger::severity ,std::pair<std::forward_list<client_logger::refcounted_stream>, bool>> _output_streams;
 
+    std::unordered_map<logger::severity, std::vector<std::string>> _binary_paths;
+
     std::string _format;
 
+    //0 builds synchronous loggers
+    size_t _async_capacity = 0;
+
+    async_log_writer::overflow_policy _overflow_policy = async_log_writer::overflow_policy::block;
+
     void parse_severity(logger::severity, nlohmann::json& j);
 
+    void parse_async(nlohmann::json& j);
+
 public:
 
     client_logger_builder() : _format("%m"){};
@@ -42,6 +51,11 @@ public:
         std::string const &stream_file_path,
         logger::severity severity) & override;
 
+    //records of the severity are appended to a binary log, see binary_log_sink
+    client_logger_builder& add_binary_stream(
+        std::string const &stream_file_path,
+        logger::severity severity) &;
+
     logger_builder& add_console_stream(
         logger::severity severity) & override;
 
@@ -55,6 +69,11 @@ public:
 
     logger_builder& clear() & override;
 
+    //built loggers queue records and write them on a background thread, capacity 0 turns it off
+    client_logger_builder& set_async(
+        size_t capacity,
+        async_log_writer::overflow_policy policy = async_log_writer::overflow_policy::block) &;
+
     [[nodiscard]] logger *build() const override;
 
 };
@@ -0,0 +1,267 @@
+#include "../include/async_log_writer.h"
+#include <bit>
+#include <stdexcept>
+
+async_log_writer::async_log_writer(
+    size_t capacity,
+    overflow_policy policy,
+    sink sink)
+    : _policy(policy), _sink(std::move(sink))
+{
+    if (capacity == 0)
+    {
+        throw std::logic_error("async_log_writer: capacity must be positive");
+    }
+
+    capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+
+    _cells = std::make_unique<cell[]>(capacity);
+    _mask = capacity - 1;
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    _writer = std::thread(&async_log_writer::run, this);
+}
+
+async_log_writer::~async_log_writer() noexcept
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+
+    _wake_writer.notify_one();
+    _writer.join();
+}
+
+size_t async_log_writer::capacity() const noexcept
+{
+    return _mask + 1;
+}
+
+async_log_writer::overflow_policy async_log_writer::policy() const noexcept
+{
+    return _policy;
+}
+
+bool async_log_writer::push(
+    record &&value)
+{
+    size_t attempts = 0;
+
+    while (!try_push(value))
+    {
+        switch (_policy)
+        {
+            case overflow_policy::drop:
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            case overflow_policy::drop_oldest:
+            {
+                record oldest;
+                if (try_pop(oldest))
+                {
+                    _dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            }
+            case overflow_policy::block:
+                if (++attempts < block_spin_attempts)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    wait_for_space();
+                }
+                break;
+        }
+    }
+
+    // pairs with the fence in run: either the writer sees the record or the caller sees it asleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_writer_idle.load(std::memory_order_relaxed))
+    {
+        wake_writer();
+    }
+
+    return true;
+}
+
+void async_log_writer::flush()
+{
+    size_t const target = _enqueue_position.load(std::memory_order_acquire);
+
+    std::unique_lock lock(_mutex);
+
+    // a sleeping writer has to look again when callers dropped records behind its back
+    _wake_writer.notify_one();
+    _batch_written.wait(lock, [this, target] { return _written_position >= target; });
+}
+
+size_t async_log_writer::dropped() const noexcept
+{
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+void async_log_writer::set_sink(
+    sink sink)
+{
+    std::lock_guard lock(_sink_mutex);
+    _sink = std::move(sink);
+}
+
+bool async_log_writer::try_push(
+    record &value)
+{
+    size_t position = _enqueue_position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto &target = _cells[position & _mask];
+        size_t const sequence = target.sequence.load(std::memory_order_acquire);
+        auto const lap = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (lap < 0)
+        {
+            return false;
+        }
+
+        if (lap > 0)
+        {
+            position = _enqueue_position.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            target.value = std::move(value);
+            target.sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+bool async_log_writer::try_pop(
+    record &value)
+{
+    size_t position = _dequeue_position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto &target = _cells[position & _mask];
+        size_t const sequence = target.sequence.load(std::memory_order_acquire);
+        auto const lap = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+        if (lap < 0)
+        {
+            return false;
+        }
+
+        if (lap > 0)
+        {
+            position = _dequeue_position.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            value = std::move(target.value);
+            target.sequence.store(position + _mask + 1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+bool async_log_writer::empty() const noexcept
+{
+    size_t const position = _dequeue_position.load(std::memory_order_relaxed);
+    return _cells[position & _mask].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+bool async_log_writer::full() const noexcept
+{
+    size_t const position = _enqueue_position.load(std::memory_order_relaxed);
+    return _cells[position & _mask].sequence.load(std::memory_order_acquire) != position;
+}
+
+void async_log_writer::wait_for_space()
+{
+    std::unique_lock lock(_mutex);
+
+    // the writer frees cells before it takes the mutex to report a batch, so the check cannot miss it
+    _wake_writer.notify_one();
+    _batch_written.wait(lock, [this] { return !full(); });
+}
+
+void async_log_writer::wake_writer()
+{
+    // the writer checks the ring and falls asleep under the mutex, so the notification cannot slip in between
+    {
+        std::lock_guard lock(_mutex);
+    }
+
+    _wake_writer.notify_one();
+}
+
+void async_log_writer::run()
+{
+    std::vector<record> batch;
+    batch.reserve(max_batch_size);
+
+    while (true)
+    {
+        record value;
+        while (batch.size() < max_batch_size && try_pop(value))
+        {
+            batch.push_back(std::move(value));
+        }
+
+        bool const full_batch = batch.size() == max_batch_size;
+        size_t const consumed = _dequeue_position.load(std::memory_order_acquire);
+
+        if (!batch.empty())
+        {
+            std::lock_guard sink_lock(_sink_mutex);
+
+            try
+            {
+                _sink(batch);
+            }
+            catch (...)
+            {
+                // a failing stream must not take the process down with the writer thread
+            }
+
+            batch.clear();
+        }
+
+        std::unique_lock lock(_mutex);
+
+        _written_position = std::max(_written_position, consumed);
+        _batch_written.notify_all();
+
+        if (full_batch)
+        {
+            continue;
+        }
+
+        _writer_idle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (empty())
+        {
+            if (_stopping)
+            {
+                return;
+            }
+
+            _wake_writer.wait(lock);
+        }
+
+        _writer_idle.store(false, std::memory_order_relaxed);
+    }
+}
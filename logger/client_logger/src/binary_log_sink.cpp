@@ -0,0 +1,422 @@
+#include "../include/binary_log_sink.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    /** Stored argument kinds are the log_argument alternative indices */
+    enum argument_kind : uint8_t
+    {
+        signed_kind,
+        unsigned_kind,
+        floating_kind,
+        pointer_kind,
+        string_kind
+    };
+
+    static_assert(std::is_same_v<std::variant_alternative_t<signed_kind, logger::log_argument>, int64_t>);
+    static_assert(std::is_same_v<std::variant_alternative_t<floating_kind, logger::log_argument>, double>);
+    static_assert(std::is_same_v<std::variant_alternative_t<string_kind, logger::log_argument>, std::string_view>);
+
+    /** Bounds-checked reads over the bytes of a log, a record cut short ends the walk */
+    class cursor final
+    {
+
+    private:
+
+        std::byte const *_data;
+
+        size_t _size;
+
+        size_t _offset;
+
+    public:
+
+        cursor(
+            std::byte const *data,
+            size_t size,
+            size_t offset) noexcept
+            : _data(data), _size(size), _offset(offset) {}
+
+        size_t offset() const noexcept
+        {
+            return _offset;
+        }
+
+        template<typename value_t>
+        bool take(
+            value_t &value) noexcept
+        {
+            if (_size - _offset < sizeof(value_t))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, _data + _offset, sizeof(value_t));
+            _offset += sizeof(value_t);
+            return true;
+        }
+
+        bool take(
+            std::string_view &text,
+            size_t length) noexcept
+        {
+            if (_size - _offset < length)
+            {
+                return false;
+            }
+
+            text = std::string_view(reinterpret_cast<char const *>(_data + _offset), length);
+            _offset += length;
+            return true;
+        }
+
+    };
+}
+
+std::shared_ptr<binary_log_sink> binary_log_sink::open(
+    std::string const &path)
+{
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<binary_log_sink>> registry;
+
+    // a relative path to a missing file is not made absolute by weakly_canonical alone
+    std::string const key = std::filesystem::weakly_canonical(std::filesystem::absolute(path)).string();
+
+    std::lock_guard lock(registry_mutex);
+
+    if (auto existing = registry[key].lock(); existing != nullptr)
+    {
+        return existing;
+    }
+
+    std::shared_ptr<binary_log_sink> sink(new binary_log_sink(key));
+    registry[key] = sink;
+
+    return sink;
+}
+
+binary_log_sink::binary_log_sink(
+    std::string path)
+    : _path(std::move(path)),
+      _file(::open(_path.c_str(), O_RDWR | O_CREAT, 0644))
+{
+    if (_file == -1)
+    {
+        throw std::runtime_error("Unable to open binary log " + _path);
+    }
+
+    struct stat info{};
+    if (fstat(_file, &info) != 0)
+    {
+        ::close(_file);
+        throw std::runtime_error("Unable to open binary log " + _path);
+    }
+
+    try
+    {
+        reserve(std::max(static_cast<size_t>(info.st_size), sizeof(magic)));
+    }
+    catch (...)
+    {
+        ::close(_file);
+        throw;
+    }
+
+    if (info.st_size == 0)
+    {
+        put_bytes(magic, sizeof(magic));
+        return;
+    }
+
+    // ids of formats already in the file stay taken
+    auto const on_format = [this](uint32_t id, std::string_view) { _next_format_id = std::max(_next_format_id, id + 1); };
+
+    _used = parse(_data, static_cast<size_t>(info.st_size), on_format, {});
+    if (_used == 0)
+    {
+        munmap(_data, _mapped);
+        ::close(_file);
+        throw std::runtime_error("File " + _path + " is not a binary log");
+    }
+}
+
+binary_log_sink::~binary_log_sink() noexcept
+{
+    munmap(_data, _mapped);
+    (void)ftruncate(_file, static_cast<off_t>(_used));
+    ::close(_file);
+}
+
+std::string const &binary_log_sink::path() const noexcept
+{
+    return _path;
+}
+
+void binary_log_sink::write(
+    logger::severity severity,
+    char const *format,
+    std::span<logger::log_argument const> arguments)
+{
+    auto const nanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    size_t event_size = sizeof(record_tag) + sizeof(uint64_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint8_t);
+    size_t const count = std::min<size_t>(arguments.size(), UINT8_MAX);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto const *text = std::get_if<std::string_view>(&arguments[i]);
+        event_size += sizeof(uint8_t) + (text == nullptr ? sizeof(uint64_t) : sizeof(uint32_t) + text->size());
+    }
+
+    std::lock_guard lock(_mutex);
+
+    auto [format_id, is_new] = _format_ids.try_emplace(format, _next_format_id);
+    if (is_new)
+    {
+        ++_next_format_id;
+
+        auto const length = static_cast<uint32_t>(std::strlen(format));
+        reserve(sizeof(record_tag) + 2 * sizeof(uint32_t) + length);
+
+        put(record_tag::format);
+        put(format_id->second);
+        put(length);
+        put_bytes(format, length);
+    }
+
+    reserve(event_size);
+
+    put(record_tag::event);
+    put(nanoseconds);
+    put(static_cast<uint8_t>(severity));
+    put(format_id->second);
+    put(static_cast<uint8_t>(count));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        put(static_cast<uint8_t>(arguments[i].index()));
+
+        std::visit([this](auto const &value)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::string_view>)
+            {
+                put(static_cast<uint32_t>(value.size()));
+                put_bytes(value.data(), value.size());
+            }
+            else
+            {
+                // every other alternative is stored as its 8 raw bytes
+                static_assert(sizeof(value) == sizeof(uint64_t));
+                put(value);
+            }
+        }, arguments[i]);
+    }
+}
+
+std::vector<binary_log_sink::decoded_record> binary_log_sink::read(
+    std::string const &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open())
+    {
+        throw std::runtime_error("Unable to open binary log " + path);
+    }
+
+    std::vector<char> const bytes{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+    std::unordered_map<uint32_t, std::string_view> formats;
+    std::vector<decoded_record> res;
+
+    auto const on_format = [&formats](uint32_t id, std::string_view format) { formats[id] = format; };
+
+    auto const on_event = [&formats, &res](uint64_t nanoseconds, logger::severity severity, uint32_t format_id,
+                                           std::vector<logger::log_argument> const &arguments)
+    {
+        auto it = formats.find(format_id);
+        res.push_back({ .nanoseconds = nanoseconds,
+                        .severity = severity,
+                        .message = logger::render_arguments(it == formats.end() ? std::string_view() : it->second, arguments) });
+    };
+
+    if (parse(reinterpret_cast<std::byte const *>(bytes.data()), bytes.size(), on_format, on_event) == 0)
+    {
+        throw std::runtime_error("File " + path + " is not a binary log");
+    }
+
+    return res;
+}
+
+void binary_log_sink::reserve(
+    size_t bytes)
+{
+    // a zero byte always follows the records, so a reader stops there even after a crash
+    if (_used + bytes < _mapped)
+    {
+        return;
+    }
+
+    size_t new_size = std::max(_mapped == 0 ? initial_mapping_size : 2 * _mapped, initial_mapping_size);
+    while (_used + bytes >= new_size)
+    {
+        new_size *= 2;
+    }
+
+    if (ftruncate(_file, static_cast<off_t>(new_size)) != 0)
+    {
+        throw std::runtime_error("Unable to grow binary log " + _path);
+    }
+
+    void *mapping = mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Unable to map binary log " + _path);
+    }
+
+    if (_data != nullptr)
+    {
+        munmap(_data, _mapped);
+    }
+
+    _data = static_cast<std::byte *>(mapping);
+    _mapped = new_size;
+}
+
+template<typename value_t>
+void binary_log_sink::put(
+    value_t value) noexcept
+{
+    put_bytes(&value, sizeof(value_t));
+}
+
+void binary_log_sink::put_bytes(
+    void const *bytes,
+    size_t count) noexcept
+{
+    std::memcpy(_data + _used, bytes, count);
+    _used += count;
+}
+
+size_t binary_log_sink::parse(
+    std::byte const *data,
+    size_t size,
+    std::function<void(uint32_t id, std::string_view format)> const &on_format,
+    std::function<void(uint64_t nanoseconds, logger::severity severity, uint32_t format_id,
+                       std::vector<logger::log_argument> const &arguments)> const &on_event)
+{
+    if (size < sizeof(magic) || std::memcmp(data, magic, sizeof(magic)) != 0)
+    {
+        return 0;
+    }
+
+    std::vector<logger::log_argument> arguments;
+    size_t end = sizeof(magic);
+
+    while (true)
+    {
+        cursor record(data, size, end);
+
+        record_tag tag;
+        if (!record.take(tag))
+        {
+            return end;
+        }
+
+        if (tag == record_tag::format)
+        {
+            uint32_t id;
+            uint32_t length;
+            std::string_view format;
+
+            if (!record.take(id) || !record.take(length) || !record.take(format, length))
+            {
+                return end;
+            }
+
+            if (on_format)
+            {
+                on_format(id, format);
+            }
+        }
+        else if (tag == record_tag::event)
+        {
+            uint64_t nanoseconds;
+            uint8_t severity;
+            uint32_t format_id;
+            uint8_t count;
+
+            if (!record.take(nanoseconds) || !record.take(severity) || !record.take(format_id) || !record.take(count) ||
+                severity > static_cast<uint8_t>(logger::severity::critical))
+            {
+                return end;
+            }
+
+            arguments.clear();
+
+            for (uint8_t i = 0; i < count; ++i)
+            {
+                uint8_t kind;
+                if (!record.take(kind) || kind >= std::variant_size_v<logger::log_argument>)
+                {
+                    return end;
+                }
+
+                if (kind == string_kind)
+                {
+                    uint32_t length;
+                    std::string_view text;
+                    if (!record.take(length) || !record.take(text, length))
+                    {
+                        return end;
+                    }
+                    arguments.emplace_back(text);
+                    continue;
+                }
+
+                uint64_t raw;
+                if (!record.take(raw))
+                {
+                    return end;
+                }
+
+                switch (kind)
+                {
+                    case signed_kind:
+                        arguments.emplace_back(std::bit_cast<int64_t>(raw));
+                        break;
+                    case unsigned_kind:
+                        arguments.emplace_back(raw);
+                        break;
+                    case floating_kind:
+                        arguments.emplace_back(std::bit_cast<double>(raw));
+                        break;
+                    default:
+                        arguments.emplace_back(reinterpret_cast<void const *>(static_cast<uintptr_t>(raw)));
+                        break;
+                }
+            }
+
+            if (on_event)
+            {
+                on_event(nanoseconds, static_cast<logger::severity>(severity), format_id, arguments);
+            }
+        }
+        else
+        {
+            return end;
+        }
+
+        end = record.offset();
+    }
+}
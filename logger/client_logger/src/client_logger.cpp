@@ -1,5 +1,4 @@
 #include <string>
-#include <sstream>
 #include <algorithm>
 #include <utility>
 #include "../include/client_logger.h"
@@ -8,17 +7,57 @@
 std::unordered_map<std::string, std::pair<size_t, std::ofstream>> client_logger::refcounted_stream::_global_streams;
 
 
+namespace
+{
+    //text messages go to binary streams as the single argument of this format
+    constexpr char plain_message_format[] = "{}";
+}
+
 logger& client_logger::log(
     const std::string &text,
     logger::severity severity) &
 {
-    std::string log_text = make_format(text, severity);
+    if (_binary_streams.contains(severity)) {
+        const log_argument argument = std::string_view(text);
+        write_binary(severity, plain_message_format, { &argument, 1 });
+    }
+
+    write_text(text, severity);
+    return *this;
+}
+
+logger& client_logger::log_arguments(
+    logger::severity severity,
+    char const *format,
+    std::span<log_argument const> arguments) &
+{
+    write_binary(severity, format, arguments);
+
+    // the text is rendered only when some text stream shows it
+    if (_output_streams.contains(severity)) {
+        write_text(render_arguments(format, arguments), severity);
+    }
+
+    return *this;
+}
 
+void client_logger::write_text(
+    const std::string &text,
+    logger::severity severity)
+{
     auto iter = _output_streams.find(severity);
     if (iter == _output_streams.end()) {
-        throw std::runtime_error("No such severity");
+        // nobody listens to this severity
+        return;
     }
 
+    if (_writer) {
+        _writer->push({ .message = text, .severity = severity, .time = std::time(nullptr) });
+        return;
+    }
+
+    const std::string &log_text = make_format(text, severity, std::time(nullptr));
+
     const auto &file_streams = iter->second.first;
     const bool is_write_to_console = iter->second.second;
     for (const refcounted_stream& stream : file_streams) {
@@ -27,92 +66,174 @@ logger& client_logger::log(
     if (is_write_to_console) {
         std::cout << log_text << std::endl;
     }
+}
+
+void client_logger::write_binary(
+    logger::severity severity,
+    char const *format,
+    std::span<log_argument const> arguments)
+{
+    auto iter = _binary_streams.find(severity);
+    if (iter == _binary_streams.end()) {
+        return;
+    }
 
-    return *this;
+    for (const auto &sink : iter->second) {
+        sink->write(severity, format, arguments);
+    }
+}
+
+bool client_logger::is_enabled(
+    logger::severity severity) const noexcept
+{
+    return (_enabled_severities & severity_bit(severity)) != 0;
+}
+
+unsigned client_logger::enabled_severities(
+    const std::unordered_map<logger::severity, std::pair<std::forward_list<refcounted_stream>, bool>> &streams) noexcept
+{
+    unsigned res = 0;
+    for (const auto &[severity, outputs] : streams) {
+        res |= outputs.second || !outputs.first.empty() ? severity_bit(severity) : 0;
+    }
+    return res;
 }
 
-std::string client_logger::make_format(const std::string &message, severity sev) const
-{
-    std::stringstream res;
-    for (size_t i = 0; i < _format.size(); ++i) {
-        if (_format[i] == '%' && i + 1 < _format.size()) {
-            switch (char_to_flag(_format[i + 1])) {
-                case flag::DATE:
-                    res << current_date_to_string();
-                    break;
-                case flag::TIME:
-                    res << current_time_to_string();
-                    break;
-                case flag::SEVERITY:
-                    res << severity_to_string(sev);
-                    break;
-                case flag::MESSAGE:
-                    res << message;
-                    break;
-                default:
-                    break;
+void client_logger::flush()
+{
+    if (_writer) {
+        _writer->flush();
+    }
+}
+
+size_t client_logger::dropped() const noexcept
+{
+    return _writer ? _writer->dropped() : 0;
+}
+
+void client_logger::write_batch(const std::vector<async_log_writer::record> &batch)
+{
+    std::vector<std::ofstream*> touched;
+    bool is_console_touched = false;
+
+    for (const auto &record : batch) {
+        auto iter = _output_streams.find(record.severity);
+        if (iter == _output_streams.end()) {
+            continue;
+        }
+
+        const std::string &log_text = make_format(record.message, record.severity, record.time);
+
+        for (const refcounted_stream& stream : iter->second.first) {
+            *(stream._stream.second) << log_text << '\n';
+            if (std::find(touched.begin(), touched.end(), stream._stream.second) == touched.end()) {
+                touched.push_back(stream._stream.second);
             }
-            ++i;
-        } else {
-            res << _format[i];
+        }
+        if (iter->second.second) {
+            std::cout << log_text << '\n';
+            is_console_touched = true;
         }
     }
 
-    return res.str();
+    for (std::ofstream *stream : touched) {
+        stream->flush();
+    }
+    if (is_console_touched) {
+        std::cout.flush();
+    }
+}
+
+std::unique_ptr<async_log_writer> client_logger::make_writer(size_t capacity, async_log_writer::overflow_policy policy)
+{
+    return std::make_unique<async_log_writer>(capacity, policy,
+        [this](const std::vector<async_log_writer::record> &batch) { write_batch(batch); });
+}
+
+const std::string& client_logger::make_format(const std::string &message, severity sev, std::time_t time) const
+{
+    return _format.render(message, sev, time);
 }
 
 client_logger::client_logger(
         const std::unordered_map<logger::severity, std::pair<std::forward_list<refcounted_stream>, bool>> &streams,
-        std::string format)
-        : _output_streams(streams), _format(std::move(format))
-{}
-
-client_logger::flag client_logger::char_to_flag(char c) noexcept
+        std::string format,
+        const std::unordered_map<logger::severity, std::vector<std::string>> &binary_paths,
+        size_t async_capacity,
+        async_log_writer::overflow_policy policy)
+        : _output_streams(streams), _format(std::move(format)), _enabled_severities(enabled_severities(streams))
 {
-    // { DATE, TIME, SEVERITY, MESSAGE, NO_FLAG };
-    switch (c) {
-        case 'd':
-            return flag::DATE;
-        case 't':
-            return flag::TIME;
-        case 's':
-            return flag::SEVERITY;
-        case 'm':
-            return flag::MESSAGE;
-        default:
-            return flag::NO_FLAG;
+    for (const auto &[severity, paths] : binary_paths) {
+        for (const std::string &path : paths) {
+            _binary_streams[severity].push_back(binary_log_sink::open(path));
+        }
+        _enabled_severities |= paths.empty() ? 0 : severity_bit(severity);
+    }
+
+    if (async_capacity != 0) {
+        _writer = make_writer(async_capacity, policy);
     }
 }
 
-client_logger::client_logger(const client_logger &other) : _output_streams(other._output_streams), _format(other._format){}
+client_logger::client_logger(const client_logger &other) : _output_streams(other._output_streams),
+    _binary_streams(other._binary_streams), _format(other._format),
+    _enabled_severities(other._enabled_severities)
+{
+    // a copy gets its own writer thread with the same settings
+    if (other._writer) {
+        _writer = make_writer(other._writer->capacity(), other._writer->policy());
+    }
+}
 
 client_logger &client_logger::operator=(const client_logger &other)
 {
     if (this != &other) {
+        // pending records are written with the streams they were logged to
+        flush();
         _format = other._format;
         _output_streams = other._output_streams;
+        _binary_streams = other._binary_streams;
+        _enabled_severities = other._enabled_severities;
+        _writer = other._writer ? make_writer(other._writer->capacity(), other._writer->policy()) : nullptr;
     }
     return *this;
 }
 
 client_logger::client_logger(client_logger &&other) noexcept
 {
+    other.flush();
     _format = std::move(other._format);
     _output_streams = std::move(other._output_streams);
+    _binary_streams = std::move(other._binary_streams);
+    _enabled_severities = std::exchange(other._enabled_severities, 0);
+    _writer = std::move(other._writer);
+    if (_writer) {
+        // the writer thread moves along with the streams it writes to
+        _writer->set_sink([this](const std::vector<async_log_writer::record> &batch) { write_batch(batch); });
+    }
 }
 
 client_logger &client_logger::operator=(client_logger &&other) noexcept
 {
     if (this != &other) {
+        flush();
+        other.flush();
+        _writer.reset();
         _format = std::move(other._format);
         _output_streams = std::move(other._output_streams);
+        _binary_streams = std::move(other._binary_streams);
+        _enabled_severities = std::exchange(other._enabled_severities, 0);
+        _writer = std::move(other._writer);
+        if (_writer) {
+            _writer->set_sink([this](const std::vector<async_log_writer::record> &batch) { write_batch(batch); });
+        }
     }
     return *this;
 }
 
 client_logger::~client_logger() noexcept
 {
-    // seems it's okay
+    // the writer is destroyed first and writes out everything still queued
 }
 
 client_logger::refcounted_stream::refcounted_stream(const std::string &path)
@@ -30,6 +30,24 @@ logger_builder& client_logger_builder::add_file_stream(
     return *this;
 }
 
+client_logger_builder& client_logger_builder::add_binary_stream(
+    std::string const &stream_file_path,
+    logger::severity severity) &
+{
+    auto& paths = _binary_paths[severity];
+    bool is_existing = std::any_of(
+        paths.begin(),
+        paths.end(),
+        [&](const std::string &path) {
+            return std::filesystem::weakly_canonical(path) == std::filesystem::weakly_canonical(stream_file_path);
+        });
+
+    if (!is_existing) {
+        paths.push_back(stream_file_path);
+    }
+    return *this;
+}
+
 using namespace nlohmann;
 
 logger_builder& client_logger_builder::add_console_stream(
@@ -48,12 +66,15 @@ logger_builder& client_logger_builder::clear() &
 {
     _format = "%m";
     _output_streams.clear();
+    _binary_paths.clear();
+    _async_capacity = 0;
+    _overflow_policy = async_log_writer::overflow_policy::block;
     return *this;
 }
 
 logger *client_logger_builder::build() const
 {
-    return new client_logger(_output_streams, _format);
+    return new client_logger(_output_streams, _format, _binary_paths, _async_capacity, _overflow_policy);
 }
 
 logger_builder& client_logger_builder::transform_with_configuration(
@@ -85,6 +106,8 @@ logger_builder& client_logger_builder::transform_with_configuration(
         if (settings.contains("format")) {
             _format = settings["format"].get<std::string>();
         }
+
+        if (settings.contains("async")) parse_async(settings["async"]);
     } else {
         throw std::runtime_error("Failed to parse configuration file. No such configuration_path");
     }
@@ -116,6 +139,50 @@ void client_logger_builder::parse_severity(logger::severity sev, nlohmann::json&
     if (j["console"].get<bool>()) {
         add_console_stream(sev);
     }
+
+    if (j.contains("binary_paths")) {
+        if (!j["binary_paths"].is_array()) {
+            throw std::runtime_error("Failed to parse configuration file. 'binary_paths' must be an array");
+        }
+
+        for (const auto & binary_path : j["binary_paths"]) {
+            if (!binary_path.is_string()) {
+                throw std::runtime_error("Failed to parse configuration file. Each binary path must be a string");
+            }
+
+            add_binary_stream(binary_path.get<std::string>(), sev);
+        }
+    }
+}
+
+client_logger_builder& client_logger_builder::set_async(
+    size_t capacity,
+    async_log_writer::overflow_policy policy) &
+{
+    _async_capacity = capacity;
+    _overflow_policy = policy;
+    return *this;
+}
+
+void client_logger_builder::parse_async(nlohmann::json& j)
+{
+    if (!j.contains("capacity") || !j["capacity"].is_number_unsigned()) {
+        throw std::runtime_error("Failed to parse configuration file. The async object must contain an unsigned 'capacity'");
+    }
+
+    auto policy = async_log_writer::overflow_policy::block;
+    if (j.contains("overflow")) {
+        std::string overflow = j["overflow"].is_string() ? j["overflow"].get<std::string>() : "";
+        if (overflow == "drop") {
+            policy = async_log_writer::overflow_policy::drop;
+        } else if (overflow == "drop_oldest") {
+            policy = async_log_writer::overflow_policy::drop_oldest;
+        } else if (overflow != "block") {
+            throw std::runtime_error("Failed to parse configuration file. Overflow must be 'block', 'drop' or 'drop_oldest'");
+        }
+    }
+
+    set_async(j["capacity"].get<size_t>(), policy);
 }
 
 logger_builder& client_logger_builder::set_destination(const std::string &format) &
@@ -1,14 +1,193 @@
 #include <gtest/gtest.h>
 #include "../include/client_logger.h"
 #include "../include/client_logger_builder.h"
+#include "../include/binary_log_sink.h"
 
 #include <filesystem>
+#include <fstream>
+#include <regex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    size_t count_lines(const std::string &path)
+    {
+        std::ifstream in(path);
+        std::string line;
+        size_t count = 0;
+        while (std::getline(in, line)) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+TEST(clientLoggerTests, asyncBlockKeepsEveryRecord)
+{
+    std::filesystem::remove("async_block.txt");
+
+    {
+        client_logger_builder builder;
+        builder.add_file_stream("async_block.txt", logger::severity::debug)
+            .set_format("[%s] %m");
+        builder.set_async(8);
+
+        std::unique_ptr<logger> log(builder.build());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&log, t] {
+                for (int i = 0; i < 500; ++i) {
+                    log->debug("thread " + std::to_string(t) + " record " + std::to_string(i));
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        log->trace("nobody listens to trace");
+
+        auto *async_log = dynamic_cast<client_logger *>(log.get());
+        async_log->flush();
+        ASSERT_EQ(count_lines("async_block.txt"), 2000);
+        ASSERT_EQ(async_log->dropped(), 0);
+
+        log->debug("written by the destructor");
+    }
+
+    ASSERT_EQ(count_lines("async_block.txt"), 2001);
+}
+
+TEST(clientLoggerTests, asyncDropOldestAccountsForEveryRecord)
+{
+    std::filesystem::remove("async_drop.txt");
+
+    size_t dropped = 0;
+    {
+        client_logger_builder builder;
+        builder.add_file_stream("async_drop.txt", logger::severity::information);
+        builder.set_async(4, async_log_writer::overflow_policy::drop_oldest);
+
+        std::unique_ptr<logger> log(builder.build());
+        for (int i = 0; i < 10000; ++i) {
+            log->information(std::to_string(i));
+        }
+
+        dropped = dynamic_cast<client_logger *>(log.get())->dropped();
+    }
+
+    ASSERT_EQ(count_lines("async_drop.txt") + dropped, 10000);
+
+    // the newest record always survives, whatever was dropped before it
+    std::ifstream in("async_drop.txt");
+    std::string line;
+    std::string last;
+    while (std::getline(in, line)) {
+        last = line;
+    }
+    ASSERT_EQ(last, "9999");
+}
+
+TEST(clientLoggerTests, formatTokensRenderLikeTheFormatString)
+{
+    std::filesystem::remove("format_tokens.txt");
+
+    {
+        client_logger_builder builder;
+        builder.add_file_stream("format_tokens.txt", logger::severity::warning)
+            .set_format("<%s> %m%q %d %t%");
+
+        std::unique_ptr<logger> log(builder.build());
+        log->warning("first").warning("second");
+    }
+
+    std::ifstream in("format_tokens.txt");
+    std::string line;
+
+    // unknown %q prints nothing, a trailing % is plain text
+    std::regex const expected("<WARNING> (first|second) \\d{2}\\.\\d{2}\\.\\d{4} \\d{2}:\\d{2}:\\d{2}%");
+    ASSERT_TRUE(std::getline(in, line));
+    ASSERT_TRUE(std::regex_match(line, expected)) << line;
+    ASSERT_EQ(line.substr(0, 15), "<WARNING> first");
+    ASSERT_TRUE(std::getline(in, line));
+    ASSERT_TRUE(std::regex_match(line, expected)) << line;
+}
+
+TEST(clientLoggerTests, deferredMessagesAreBuiltOnlyForEnabledSeverities)
+{
+    client_logger_builder builder;
+    builder.add_console_stream(logger::severity::error)
+        .add_file_stream("deferred.txt", logger::severity::warning);
+
+    std::unique_ptr<logger> log(builder.build());
+
+    ASSERT_TRUE(log->is_enabled(logger::severity::error));
+    ASSERT_TRUE(log->is_enabled(logger::severity::warning));
+    ASSERT_FALSE(log->is_enabled(logger::severity::trace));
+
+    int built = 0;
+    auto const make_message = [&built] { ++built; return std::string("deferred"); };
+
+    log->log_deferred(logger::severity::trace, make_message)
+        .log_deferred(logger::severity::debug, make_message)
+        .log_deferred(logger::severity::warning, make_message);
+
+    ASSERT_EQ(built, 1);
+}
+
+TEST(clientLoggerTests, binaryStreamKeepsArgumentsAndDecodesThemLater)
+{
+    std::filesystem::remove("binary.log");
+    std::filesystem::remove("binary.txt");
+
+    int const value = 42;
+
+    {
+        client_logger_builder builder;
+        builder.add_binary_stream("binary.log", logger::severity::error)
+            .add_binary_stream("binary.log", logger::severity::information)
+            .add_file_stream("binary.txt", logger::severity::error);
+
+        std::unique_ptr<logger> log(builder.build());
+        ASSERT_TRUE(log->is_enabled(logger::severity::information));
+
+        log->log_structured(logger::severity::information, "block {} of {} bytes, {} used, {}", -3, 64u, 0.5, "free")
+            .log_structured(logger::severity::error, "pointer {}", static_cast<void const *>(&value))
+            .error("plain text");
+    }
+
+    {
+        // an existing log is continued
+        client_logger_builder builder;
+        builder.add_binary_stream("binary.log", logger::severity::debug);
+
+        std::unique_ptr<logger> log(builder.build());
+        log->log_structured(logger::severity::debug, "block {} of {} bytes, {} used, {}", 7, 8, 1, "taken");
+    }
+
+    auto const records = binary_log_sink::read("binary.log");
+    ASSERT_EQ(records.size(), 4);
+
+    ASSERT_EQ(records[0].severity, logger::severity::information);
+    ASSERT_EQ(records[0].message, "block -3 of 64 bytes, 0.5 used, free");
+    ASSERT_EQ(records[1].severity, logger::severity::error);
+    ASSERT_TRUE(records[1].message.starts_with("pointer 0x")) << records[1].message;
+    ASSERT_EQ(records[2].message, "plain text");
+    ASSERT_EQ(records[3].severity, logger::severity::debug);
+    ASSERT_EQ(records[3].message, "block 7 of 8 bytes, 1 used, taken");
+    ASSERT_LE(records[0].nanoseconds, records[3].nanoseconds);
+
+    // text streams of the severity still get the rendered message
+    ASSERT_EQ(count_lines("binary.txt"), 2);
+}
 
 int main(int argc, char *argv[])
 {
-    try {
-        testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleTest(&argc, argv);
 
+    try {
         client_logger_builder builder;
 
         builder.add_file_stream("a.txt" ,logger::severity::trace).
@@ -31,10 +210,9 @@ int main(int argc, char *argv[])
         logger2->trace("Another message from second logger");
 
         logger2->error("ERROR MSG second logger");
-
-        return RUN_ALL_TESTS();
     } catch (const std::exception &ex) {
         std::cerr << "exception : " << ex.what() << std::endl;
-        return 0;
     }
+
+    return RUN_ALL_TESTS();
 }
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include <binary_log_sink.h>
+#include <exception>
+#include <iostream>
+
+/** Prints a binary log as text: binary_log_decoder <file> [format], the format defaults to "%d %t %s %m" */
+int main(
+    int argc,
+    char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <binary log> [format]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        logger::compiled_format const format(argc == 3 ? argv[2] : "%d %t %s %m");
+
+        for (auto const &record : binary_log_sink::read(argv[1]))
+        {
+            auto const seconds = static_cast<std::time_t>(record.nanoseconds / 1'000'000'000);
+            std::cout << format.render(record.message, record.severity, seconds) << '\n';
+        }
+    }
+    catch (std::exception const &ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
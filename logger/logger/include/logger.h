@@ -1,7 +1,18 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_H
 
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <ctime>
+#include <functional>
 #include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
 class logger
 {
@@ -18,6 +29,9 @@ public:
         critical
     };
 
+    /** Value of a structured message, kept raw until some output needs it as text */
+    using log_argument = std::variant<int64_t, uint64_t, double, void const *, std::string_view>;
+
 public:
 
     virtual ~logger() noexcept = default;
@@ -28,6 +42,78 @@ public:
         std::string const &message,
         logger::severity severity) & = 0;
 
+    /** Whether a message of the severity reaches any output, loggers that cannot tell answer true */
+    virtual bool is_enabled(
+        logger::severity severity) const noexcept;
+
+    /** Calls make_message only when the severity is enabled, so disabled levels cost no string building */
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger& log_deferred(
+        logger::severity severity,
+        message_factory &&make_message) &
+    {
+        return is_enabled(severity)
+            ? log(std::invoke(make_message), severity)
+            : *this;
+    }
+
+    /** Message whose "{}" placeholders take the values in order. format has to outlive the logger,
+     *  like a string literal does: binary outputs store it once and refer to it afterwards
+     */
+    template<typename... values_t>
+    logger& log_structured(
+        logger::severity severity,
+        char const *format,
+        values_t const &...values) &
+    {
+        if (!is_enabled(severity))
+        {
+            return *this;
+        }
+
+        std::array<log_argument, sizeof...(values_t)> const arguments{ to_log_argument(values)... };
+        return log_arguments(severity, format, arguments);
+    }
+
+    /** Target of log_structured, outputs that do not keep values raw get the rendered text through log */
+    virtual logger& log_arguments(
+        logger::severity severity,
+        char const *format,
+        std::span<log_argument const> arguments) &;
+
+    /** Format with every "{}" replaced by the next argument, placeholders without one stay as they are */
+    static std::string render_arguments(
+        std::string_view format,
+        std::span<log_argument const> arguments);
+
+    template<typename value_t>
+    static log_argument to_log_argument(
+        value_t const &value) noexcept
+    {
+        if constexpr (std::is_convertible_v<value_t const &, std::string_view>)
+        {
+            return std::string_view(value);
+        }
+        else if constexpr (std::is_floating_point_v<value_t>)
+        {
+            return static_cast<double>(value);
+        }
+        else if constexpr (std::is_integral_v<value_t> && std::is_signed_v<value_t>)
+        {
+            return static_cast<int64_t>(value);
+        }
+        else if constexpr (std::is_integral_v<value_t> || std::is_enum_v<value_t>)
+        {
+            return static_cast<uint64_t>(value);
+        }
+        else
+        {
+            static_assert(std::is_pointer_v<value_t>, "log_structured takes numbers, strings and pointers");
+            return static_cast<void const *>(value);
+        }
+    }
+
 public:
 
     logger& trace(
@@ -48,8 +134,56 @@ public:
     logger& critical(
         std::string const &message) &;
 
+public:
+
+    /** Format like "[%d %t][%s] %m" split once into literal text and placeholders */
+    class compiled_format final
+    {
+
+    private:
+
+        enum class flag
+        { DATE, TIME, SEVERITY, MESSAGE, LITERAL };
+
+        struct token
+        {
+            flag kind;
+            std::string literal;
+        };
+
+        std::vector<token> _tokens;
+
+        bool _uses_time = false;
+
+    public:
+
+        explicit compiled_format(
+            std::string const &format = "%m");
+
+        /** Result lives in a buffer of the calling thread, valid until its next render.
+         *  Date and time text is rebuilt only when the second changes
+         */
+        std::string const &render(
+            std::string const &message,
+            logger::severity severity,
+            std::time_t time) const;
+
+    private:
+
+        static flag char_to_flag(
+            char c) noexcept;
+
+    };
+
 protected:
 
+    /** Bit of the severity in a set of enabled severities */
+    static constexpr unsigned severity_bit(
+        logger::severity severity) noexcept
+    {
+        return 1u << static_cast<unsigned>(severity);
+    }
+
     static std::string severity_to_string(
         logger::severity severity);
 
@@ -59,6 +193,12 @@ protected:
 
     static std::string current_time_to_string();
 
+    static std::string date_to_string(
+        std::time_t time);
+
+    static std::string time_to_string(
+        std::time_t time);
+
 };
 
 
@@ -34,6 +34,72 @@ public:
     logger_guardant &critical_with_guard(
         std::string const &message) &;
 
+public:
+
+    /** Calls make_message only when there is a logger and it listens to the severity */
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &log_with_guard(
+        message_factory &&make_message,
+        logger::severity severity) &
+    {
+        logger *got_logger = get_logger();
+        if (got_logger != nullptr && got_logger->is_enabled(severity))
+        {
+            got_logger->log(std::invoke(make_message), severity);
+        }
+
+        return *this;
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &trace_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::trace);
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &debug_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::debug);
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &information_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::information);
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &warning_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::warning);
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &error_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::error);
+    }
+
+    template<typename message_factory>
+    requires std::invocable<message_factory &>
+    logger_guardant &critical_with_guard(
+        message_factory &&make_message) &
+    {
+        return log_with_guard(std::forward<message_factory>(make_message), logger::severity::critical);
+    }
+
 protected:
 
     inline virtual logger *get_logger() const = 0;
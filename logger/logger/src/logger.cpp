@@ -1,7 +1,58 @@
 #include "../include/logger.h"
+#include <charconv>
 #include <iomanip>
 #include <sstream>
 
+bool logger::is_enabled(
+    logger::severity) const noexcept
+{
+    return true;
+}
+
+logger &logger::log_arguments(
+    logger::severity severity,
+    char const *format,
+    std::span<log_argument const> arguments) &
+{
+    return log(render_arguments(format, arguments), severity);
+}
+
+std::string logger::render_arguments(
+    std::string_view format,
+    std::span<log_argument const> arguments)
+{
+    std::string res;
+    res.reserve(format.size());
+
+    size_t next = 0;
+    for (size_t i = 0; i < format.size(); ++i) {
+        if (format[i] != '{' || i + 1 == format.size() || format[i + 1] != '}' || next == arguments.size()) {
+            res += format[i];
+            continue;
+        }
+
+        ++i;
+        std::visit([&res](auto const &value)
+        {
+            using value_t = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<value_t, std::string_view>) {
+                res += value;
+            } else if constexpr (std::is_same_v<value_t, void const *>) {
+                char digits[2 + 2 * sizeof(uintptr_t)] = { '0', 'x' };
+                auto end = std::to_chars(digits + 2, std::end(digits), reinterpret_cast<uintptr_t>(value), 16).ptr;
+                res.append(digits, end);
+            } else {
+                char digits[32];
+                auto end = std::to_chars(std::begin(digits), std::end(digits), value).ptr;
+                res.append(digits, end);
+            }
+        }, arguments[next++]);
+    }
+
+    return res;
+}
+
 logger & logger::trace(
     std::string const &message) &
 {
@@ -72,20 +123,117 @@ std::string logger::current_datetime_to_string()
 
 std::string logger::current_date_to_string()
 {
-    auto time = std::time(nullptr);
+    return date_to_string(std::time(nullptr));
+}
 
+std::string logger::current_time_to_string()
+{
+    return time_to_string(std::time(nullptr));
+}
+
+std::string logger::date_to_string(
+    std::time_t time)
+{
     std::ostringstream result_stream;
     result_stream << std::put_time(std::localtime(&time), "%d.%m.%Y");
 
     return result_stream.str();
 }
 
-std::string logger::current_time_to_string()
+std::string logger::time_to_string(
+    std::time_t time)
 {
-    auto time = std::time(nullptr);
-
     std::ostringstream result_stream;
     result_stream << std::put_time(std::localtime(&time), "%H:%M:%S");
 
     return result_stream.str();
 }
+
+logger::compiled_format::compiled_format(
+    std::string const &format)
+{
+    std::string literal;
+
+    for (size_t i = 0; i < format.size(); ++i) {
+        if (format[i] != '%' || i + 1 == format.size()) {
+            literal += format[i];
+            continue;
+        }
+
+        flag const kind = char_to_flag(format[++i]);
+        if (kind == flag::LITERAL) {
+            // unknown placeholders print nothing
+            continue;
+        }
+
+        if (!literal.empty()) {
+            _tokens.push_back({ .kind = flag::LITERAL, .literal = std::move(literal) });
+            literal.clear();
+        }
+
+        _tokens.push_back({ .kind = kind, .literal = {} });
+        _uses_time = _uses_time || kind == flag::DATE || kind == flag::TIME;
+    }
+
+    if (!literal.empty()) {
+        _tokens.push_back({ .kind = flag::LITERAL, .literal = std::move(literal) });
+    }
+}
+
+std::string const &logger::compiled_format::render(
+    std::string const &message,
+    logger::severity severity,
+    std::time_t time) const
+{
+    thread_local std::string buffer;
+    thread_local std::time_t cached_time = -1;
+    thread_local std::string cached_date;
+    thread_local std::string cached_time_of_day;
+
+    if (_uses_time && time != cached_time) {
+        cached_date = date_to_string(time);
+        cached_time_of_day = time_to_string(time);
+        cached_time = time;
+    }
+
+    buffer.clear();
+
+    for (auto const &item : _tokens) {
+        switch (item.kind) {
+            case flag::LITERAL:
+                buffer += item.literal;
+                break;
+            case flag::DATE:
+                buffer += cached_date;
+                break;
+            case flag::TIME:
+                buffer += cached_time_of_day;
+                break;
+            case flag::SEVERITY:
+                buffer += severity_to_string(severity);
+                break;
+            case flag::MESSAGE:
+                buffer += message;
+                break;
+        }
+    }
+
+    return buffer;
+}
+
+logger::compiled_format::flag logger::compiled_format::char_to_flag(
+    char c) noexcept
+{
+    switch (c) {
+        case 'd':
+            return flag::DATE;
+        case 't':
+            return flag::TIME;
+        case 's':
+            return flag::SEVERITY;
+        case 'm':
+            return flag::MESSAGE;
+        default:
+            return flag::LITERAL;
+    }
+}
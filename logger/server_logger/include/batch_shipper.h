@@ -0,0 +1,122 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_BATCH_SHIPPER_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_BATCH_SHIPPER_H
+
+#include <httplib.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** Sends log records of one process to the log server in batches from its own thread.
+ *  A batch leaves when batch_size records are waiting or flush_interval has passed since the last one,
+ *  over a single kept-alive connection. A batch the server does not take after the retries
+ *  is appended to the spill file instead as JSON lines shaped like the records of /logger/log_batch,
+ *  so nothing logged is lost while the server is down
+ */
+class batch_shipper final
+{
+
+public:
+
+    static constexpr const size_t max_attempts = 4;
+
+    static constexpr const std::chrono::milliseconds initial_backoff{ 50 };
+
+private:
+
+    struct record
+    {
+        std::string severity;
+        std::string message;
+    };
+
+    httplib::Client _client;
+
+    /** The connection is shared by the shipping thread and init/stop requests of the owner */
+    std::mutex _client_mutex;
+
+    int _pid;
+
+    size_t _batch_size;
+
+    std::chrono::milliseconds _flush_interval;
+
+    std::string _spill_path;
+
+    std::mutex _mutex;
+
+    std::condition_variable _wake_shipper;
+
+    std::condition_variable _batch_done;
+
+    /** Guarded by _mutex */
+    std::vector<record> _pending;
+
+    /** Guarded by _mutex: records pushed so far and records shipped or spilled so far */
+    size_t _pushed = 0;
+    size_t _done = 0;
+
+    /** Guarded by _mutex: the shipper does not wait for a full batch while _done is below it */
+    size_t _flush_target = 0;
+
+    /** Guarded by _mutex */
+    bool _stopping = false;
+
+    /** Only the shipping thread touches it: while the server is down every batch gets a single attempt */
+    bool _server_down = false;
+
+    std::thread _shipper;
+
+public:
+
+    batch_shipper(
+        std::string const &destination,
+        int pid,
+        size_t batch_size,
+        std::chrono::milliseconds flush_interval,
+        std::string spill_path);
+
+    batch_shipper(
+        batch_shipper const &other) = delete;
+
+    batch_shipper &operator=(
+        batch_shipper const &other) = delete;
+
+    batch_shipper(
+        batch_shipper &&other) = delete;
+
+    batch_shipper &operator=(
+        batch_shipper &&other) = delete;
+
+    /** Ships or spills every pushed record before returning */
+    ~batch_shipper() noexcept;
+
+public:
+
+    void push(
+        std::string severity,
+        std::string message);
+
+    /** Returns once every record pushed before the call is shipped or spilled */
+    void flush();
+
+    /** Single request on the shared connection, false when the server did not answer with 200 */
+    bool post(
+        std::string const &path,
+        std::string const &body);
+
+private:
+
+    void run();
+
+    void ship(
+        std::vector<record> const &batch);
+
+    void spill(
+        std::vector<record> const &batch);
+
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_BATCH_SHIPPER_H
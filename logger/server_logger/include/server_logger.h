@@ -2,26 +2,35 @@
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_SERVER_LOGGER_H
 
 #include <logger.h>
+#include "batch_shipper.h"
+#include <chrono>
+#include <memory>
 #include <unordered_map>
-#include <httplib.h>
 #include <forward_list>
 
 class server_logger_builder;
 class server_logger final:
     public logger
 {
-    httplib::Client _client;
     std::unordered_map<logger::severity, std::pair<std::forward_list<std::string>, bool>> _streams;
     std::string _dest;
-    std::string _format;
-public:
-    enum class flag
-    { DATE, TIME, SEVERITY, MESSAGE, NO_FLAG };
+    compiled_format _format;
+    //severity_bit of every severity with at least one stream
+    unsigned _enabled_severities;
+    //owns the connection, on the heap so the shipping thread keeps working when the logger is moved
+    std::unique_ptr<batch_shipper> _shipper;
 private:
-    server_logger(const std::string& dest, const std::unordered_map<logger::severity ,std::pair<std::forward_list<std::string>, bool>>& streams, const std::string &format);
+    server_logger(const std::string& dest, const std::unordered_map<logger::severity ,std::pair<std::forward_list<std::string>, bool>>& streams, const std::string &format,
+                  size_t batch_size, std::chrono::milliseconds flush_interval, const std::string &spill_path);
+
+    //registers the streams of this process on the server
+    void init_streams();
+
+    //unregisters them, a server that is down has nothing to forget
+    void stop_streams() noexcept;
 
-    std::string make_format(const std::string& message, severity sev) const;
-    static flag char_to_flag(char c) noexcept;
+    //valid until the next make_format on the calling thread
+    const std::string& make_format(const std::string& message, severity sev, std::time_t time) const;
 
     friend server_logger_builder;
 
@@ -46,6 +55,12 @@ public:
         const std::string &message,
         logger::severity severity) & override;
 
+    bool is_enabled(
+        logger::severity severity) const noexcept override;
+
+    //waits until every record logged so far is shipped or spilled
+    void flush();
+
 };
 
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_SERVER_LOGGER_H
\ No newline at end of file
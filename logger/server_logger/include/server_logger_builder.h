@@ -15,10 +15,17 @@ class server_logger_builder final:
     std::unordered_map<logger::severity ,std::pair<std::forward_list<std::string>, bool>> _output_streams;
     std::string _format;
 
+    size_t _batch_size;
+    std::chrono::milliseconds _flush_interval;
+    std::string _spill_path;
+
     void parse_severity(logger::severity sev, nlohmann::json& j);
+
+    void parse_batch(nlohmann::json& j);
 public:
 
-    server_logger_builder() : _destination("http://127.0.0.1:9200"), _format("%m"){}
+    server_logger_builder() : _destination("http://127.0.0.1:9200"), _format("%m"),
+        _batch_size(64), _flush_interval(200), _spill_path("server_logger_spill.jsonl"){}
 
 public:
 
@@ -39,6 +46,12 @@ public:
 
     logger_builder& set_format(const std::string& format) & override;
 
+    //a batch is shipped when batch_size records wait or flush_interval has passed
+    server_logger_builder& set_batching(size_t batch_size, std::chrono::milliseconds flush_interval) &;
+
+    //where batches go when the server does not take them
+    server_logger_builder& set_spill_file(const std::string& path) &;
+
     [[nodiscard]] logger *build() const override;
 
 };
@@ -0,0 +1,147 @@
+#include "../include/batch_shipper.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+batch_shipper::batch_shipper(
+    std::string const &destination,
+    int pid,
+    size_t batch_size,
+    std::chrono::milliseconds flush_interval,
+    std::string spill_path)
+    : _client(destination),
+      _pid(pid),
+      _batch_size(batch_size),
+      _flush_interval(flush_interval),
+      _spill_path(std::move(spill_path))
+{
+    if (_batch_size == 0) {
+        throw std::logic_error("batch_shipper: batch size must be positive");
+    }
+
+    _client.set_keep_alive(true);
+    _client.set_read_timeout(10);
+    _client.set_connection_timeout(10);
+
+    _pending.reserve(_batch_size);
+    _shipper = std::thread(&batch_shipper::run, this);
+}
+
+batch_shipper::~batch_shipper() noexcept
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+
+    _wake_shipper.notify_one();
+    _shipper.join();
+}
+
+void batch_shipper::push(
+    std::string severity,
+    std::string message)
+{
+    bool is_full;
+    {
+        std::lock_guard lock(_mutex);
+        _pending.push_back({ .severity = std::move(severity), .message = std::move(message) });
+        ++_pushed;
+        is_full = _pending.size() >= _batch_size;
+    }
+
+    if (is_full) {
+        _wake_shipper.notify_one();
+    }
+}
+
+void batch_shipper::flush()
+{
+    std::unique_lock lock(_mutex);
+
+    size_t const target = _pushed;
+    _flush_target = std::max(_flush_target, target);
+    _wake_shipper.notify_one();
+    _batch_done.wait(lock, [this, target] { return _done >= target; });
+}
+
+bool batch_shipper::post(
+    std::string const &path,
+    std::string const &body)
+{
+    std::lock_guard lock(_client_mutex);
+
+    auto response = _client.Post(path, body, "application/json");
+    return response && response->status == 200;
+}
+
+void batch_shipper::run()
+{
+    std::vector<record> batch;
+    std::unique_lock lock(_mutex);
+
+    while (true) {
+        // a flush request wakes the shipper early, the interval only bounds how long records may wait
+        _wake_shipper.wait_for(lock, _flush_interval, [this] { return _stopping || _pending.size() >= _batch_size || _done < _flush_target; });
+
+        if (_pending.empty()) {
+            if (_stopping) {
+                return;
+            }
+            continue;
+        }
+
+        batch.swap(_pending);
+        _pending.reserve(_batch_size);
+
+        lock.unlock();
+        ship(batch);
+        lock.lock();
+
+        _done += batch.size();
+        batch.clear();
+        _batch_done.notify_all();
+    }
+}
+
+void batch_shipper::ship(
+    std::vector<record> const &batch)
+{
+    json records = json::array();
+    for (const auto &item : batch) {
+        records.push_back({{"severity", item.severity}, {"message", item.message}});
+    }
+
+    std::string const body = json{{"pid", _pid}, {"records", std::move(records)}}.dump();
+
+    auto backoff = initial_backoff;
+    size_t const attempts = _server_down ? 1 : max_attempts;
+
+    for (size_t attempt = 0; attempt < attempts; ++attempt) {
+        if (attempt != 0) {
+            std::this_thread::sleep_for(backoff);
+            backoff *= 2;
+        }
+
+        if (post("/logger/log_batch", body)) {
+            _server_down = false;
+            return;
+        }
+    }
+
+    _server_down = true;
+    spill(batch);
+}
+
+void batch_shipper::spill(
+    std::vector<record> const &batch)
+{
+    std::ofstream stream(_spill_path, std::ios_base::app);
+
+    for (const auto &item : batch) {
+        stream << json{{"pid", _pid}, {"severity", item.severity}, {"message", item.message}}.dump() << '\n';
+    }
+}
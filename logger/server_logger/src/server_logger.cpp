@@ -2,6 +2,7 @@
 #include <httplib.h>
 #include "../include/server_logger.h"
 #include <nlohmann/json.hpp>
+#include <utility>
 
 #ifdef _WIN32
 #include <process.h>
@@ -13,13 +14,9 @@ using json = nlohmann::json;
 
 server_logger::~server_logger() noexcept
 {
-    nlohmann::json body = {
-        {"pid", inner_getpid()}
-    };
-    httplib::Headers headers = {{"Content-Type", "application/json"}};
-    auto response = _client.Post("/logger/stop", headers, body.dump(), "application/json");
-    if (!response) {
-        throw std::runtime_error("Timeout while sending request to server");
+    if (_shipper) {
+        flush();
+        stop_streams();
     }
 }
 
@@ -27,41 +24,57 @@ logger& server_logger::log(
     const std::string &text,
     logger::severity severity) &
 {
-    std::string formatted = make_format(text, severity);
-    nlohmann::json body = {
-        {"pid", inner_getpid()},
-        {"severity", severity_to_string(severity)},
-        {"message", formatted}
-    };
-    httplib::Headers headers = {{"Content-Type", "application/json"}};
-    auto response = _client.Post("/logger/log", headers, body.dump(), "application/json");
-    if (!response) {
-        throw std::runtime_error("Timeout while sending request to server");
+    if (!is_enabled(severity)) {
+        // neither the console nor any file of the server listens to it
+        return *this;
     }
 
+    std::string formatted = make_format(text, severity, std::time(nullptr));
+
     auto it = _streams.find(severity);
     if (it != _streams.end()) {
         if (it->second.second) {
             std::cout << formatted << std::endl;
         }
     }
+
+    _shipper->push(severity_to_string(severity), std::move(formatted));
     return *this;
 }
 
+bool server_logger::is_enabled(
+    logger::severity severity) const noexcept
+{
+    return (_enabled_severities & severity_bit(severity)) != 0;
+}
+
+void server_logger::flush()
+{
+    _shipper->flush();
+}
+
 server_logger::server_logger(const std::string& dest,
-                             const std::unordered_map<logger::severity, std::pair<std::forward_list<std::string>, bool>> &streams, const std::string &format):
-    _client(dest),
+                             const std::unordered_map<logger::severity, std::pair<std::forward_list<std::string>, bool>> &streams, const std::string &format,
+                             size_t batch_size, std::chrono::milliseconds flush_interval, const std::string &spill_path):
     _streams(streams),
     _dest(dest),
-    _format(format)
+    _format(format),
+    _enabled_severities(0),
+    _shipper(std::make_unique<batch_shipper>(dest, inner_getpid(), batch_size, flush_interval, spill_path))
 {
     std::cout << "builded!" << std::endl;
 
-    _client.set_read_timeout(10);
-    _client.set_connection_timeout(10);
+    for (const auto &[sev, stream_info]: _streams) {
+        _enabled_severities |= stream_info.second || !stream_info.first.empty() ? severity_bit(sev) : 0;
+    }
+
+    init_streams();
+}
 
+void server_logger::init_streams()
+{
     int pid = inner_getpid();
-    for (const auto &[sev, stream_info]: streams) {
+    for (const auto &[sev, stream_info]: _streams) {
         for (const auto& path : stream_info.first) {
             json body = {
                 {"pid", pid},
@@ -69,14 +82,23 @@ server_logger::server_logger(const std::string& dest,
                 {"path", path},
                 {"console", stream_info.second}
             };
-            httplib::Headers headers = {{"Content-Type", "application/json"}};
-            auto response = _client.Post("/logger/init", headers, body.dump(), "application/json");
-            if (!response) {
+            if (!_shipper->post("/logger/init", body.dump())) {
                 throw std::runtime_error("Timeout while sending request to server");
             }
         }
     }
+}
 
+void server_logger::stop_streams() noexcept
+{
+    try {
+        nlohmann::json body = {
+            {"pid", inner_getpid()}
+        };
+        _shipper->post("/logger/stop", body.dump());
+    } catch (...) {
+        // the server keeps the registration until it restarts, nothing to do about it here
+    }
 }
 
 int server_logger::inner_getpid()
@@ -90,10 +112,11 @@ int server_logger::inner_getpid()
 
 
 server_logger::server_logger(server_logger &&other) noexcept:
-    _client(std::move(other._client)),
     _streams(std::move(other._streams)),
     _dest(std::move(other._dest)),
-    _format(std::move(other._format))
+    _format(std::move(other._format)),
+    _enabled_severities(std::exchange(other._enabled_severities, 0)),
+    _shipper(std::move(other._shipper))
 {
 }
 
@@ -101,81 +124,24 @@ server_logger &server_logger::operator=(server_logger &&other) noexcept
 {
     if (this != &other) {
         //closing (this) connection with old destination
-        int this_pid = inner_getpid();
-        nlohmann::json body_for_this_old = {{"pid", this_pid}};
-        auto response = _client.Post("/logger/stop", "application/json", body_for_this_old.dump());
-        if (!response) {
-            throw std::runtime_error("Timeout while sending request to server");
+        if (_shipper) {
+            flush();
+            stop_streams();
         }
 
-        _client = std::move(other._client);
         _streams = std::move(other._streams);
         _dest = std::move(other._dest);
         _format = std::move(other._format);
+        _enabled_severities = std::exchange(other._enabled_severities, 0);
+        _shipper = std::move(other._shipper);
 
-        //openning new connection with moved destination
-        for (const auto &[sev, stream_info]: _streams) {
-            for (const auto& path : stream_info.first) {
-                json body = {
-                    {"pid", this_pid},
-                    {"severity", severity_to_string(sev)},
-                    {"path", path},
-                    {"console", stream_info.second}
-                };
-                httplib::Headers headers = {{"Content-Type", "application/json"}};
-                response = _client.Post("/logger/init", headers, body.dump(), "application/json");
-                if (!response) {
-                    throw std::runtime_error("Timeout while sending request to server");
-                }
-            }
-        }
+        //the server forgets streams by pid, so the moved ones are registered again
+        init_streams();
     }
     return *this;
 }
 
-server_logger::flag server_logger::char_to_flag(const char c) noexcept
+const std::string& server_logger::make_format(const std::string &message, severity sev, std::time_t time) const
 {
-    // { DATE, TIME, SEVERITY, MESSAGE, NO_FLAG };
-    switch (c) {
-        case 'd':
-            return flag::DATE;
-        case 't':
-            return flag::TIME;
-        case 's':
-            return flag::SEVERITY;
-        case 'm':
-            return flag::MESSAGE;
-        default:
-            return flag::NO_FLAG;
-    }
+    return _format.render(message, sev, time);
 }
-
-std::string server_logger::make_format(const std::string &message, severity sev) const
-{
-    std::stringstream res;
-    for (size_t i = 0; i < _format.size(); ++i) {
-        if (_format[i] == '%' && i + 1 < _format.size()) {
-            switch (char_to_flag(_format[i + 1])) {
-                case flag::DATE:
-                    res << current_date_to_string();
-                break;
-                case flag::TIME:
-                    res << current_time_to_string();
-                break;
-                case flag::SEVERITY:
-                    res << severity_to_string(sev);
-                break;
-                case flag::MESSAGE:
-                    res << message;
-                break;
-                default:
-                    break;
-            }
-            ++i;
-        } else {
-            res << _format[i];
-        }
-    }
-
-    return res.str();
-}
\ No newline at end of file
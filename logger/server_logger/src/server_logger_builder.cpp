@@ -72,6 +72,8 @@ logger_builder& server_logger_builder::transform_with_configuration(
         if (settings.contains("format")) {
             _format = settings["format"].get<std::string>();
         }
+
+        if (settings.contains("batch")) parse_batch(settings["batch"]);
     } else {
         throw std::runtime_error("Failed to parse configuration file. No such configuration_path");
     }
@@ -103,12 +105,15 @@ logger_builder& server_logger_builder::clear() &
 {
     _format = "%m";
     _output_streams.clear();
+    _batch_size = 64;
+    _flush_interval = std::chrono::milliseconds(200);
+    _spill_path = "server_logger_spill.jsonl";
     return *this;
 }
 
 logger *server_logger_builder::build() const
 {
-    return new server_logger(_destination, _output_streams, _format);
+    return new server_logger(_destination, _output_streams, _format, _batch_size, _flush_interval, _spill_path);
 }
 
 logger_builder& server_logger_builder::set_destination(const std::string& dest) &
@@ -122,3 +127,32 @@ logger_builder& server_logger_builder::set_format(const std::string &format) &
     _format = format;
     return *this;
 }
+
+server_logger_builder& server_logger_builder::set_batching(size_t batch_size, std::chrono::milliseconds flush_interval) &
+{
+    _batch_size = batch_size;
+    _flush_interval = flush_interval;
+    return *this;
+}
+
+server_logger_builder& server_logger_builder::set_spill_file(const std::string &path) &
+{
+    _spill_path = path;
+    return *this;
+}
+
+void server_logger_builder::parse_batch(nlohmann::json& j)
+{
+    if (!j.contains("size") || !j["size"].is_number_unsigned() || !j.contains("interval_ms") || !j["interval_ms"].is_number_unsigned()) {
+        throw std::runtime_error("Failed to parse configuration file. The batch object must contain unsigned 'size' and 'interval_ms'");
+    }
+
+    set_batching(j["size"].get<size_t>(), std::chrono::milliseconds(j["interval_ms"].get<size_t>()));
+
+    if (j.contains("spill_file")) {
+        if (!j["spill_file"].is_string()) {
+            throw std::runtime_error("Failed to parse configuration file. spill_file must be a string");
+        }
+        set_spill_file(j["spill_file"].get<std::string>());
+    }
+}
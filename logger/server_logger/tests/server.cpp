@@ -78,6 +78,66 @@ server::server(uint16_t port) {
         }
     });
 
+    CROW_ROUTE(app, "/logger/log_batch").methods("POST"_method)([&](const crow::request &req) {
+        try {
+            json body = json::parse(req.body);
+
+            if (!body.contains("pid") || !body.contains("records") || !body["records"].is_array()) {
+                return crow::response(400, "Missing one of required fields: pid, records");
+            }
+
+            int pid = body["pid"];
+
+            std::shared_lock lock(_mut);
+            auto it = _streams.find(pid);
+            if (it == _streams.end()) {
+                return crow::response(200);
+            }
+
+            // every file is opened once per batch instead of once per record
+            std::unordered_map<std::string, std::ofstream> files;
+            std::string console_text;
+
+            for (const auto& record : body["records"]) {
+                if (!record.contains("severity") || !record.contains("message")) {
+                    return crow::response(400, "Missing one of required record fields: severity, message");
+                }
+
+                logger::severity sev = logger_builder::string_to_severity(record["severity"]);
+                std::string message = record["message"];
+
+                auto file_streams_it = it->second.find(sev);
+                if (file_streams_it == it->second.end()) {
+                    continue;
+                }
+
+                for (const auto& path : file_streams_it->second.first) {
+                    if (path.empty()) {
+                        continue;
+                    }
+
+                    auto file_it = files.find(path);
+                    if (file_it == files.end()) {
+                        file_it = files.emplace(path, std::ofstream(path, std::ios_base::app)).first;
+                    }
+                    if (file_it->second.is_open()) {
+                        file_it->second << message << '\n';
+                    }
+                }
+
+                if (file_streams_it->second.second) {
+                    console_text += message + '\n';
+                }
+            }
+
+            if (!console_text.empty()) std::cout << console_text << std::flush;
+
+            return crow::response(200);
+        } catch (const std::exception& e) {
+            return crow::response(500, std::string("server error ") + e.what());
+        }
+    });
+
     CROW_ROUTE(app, "/logger/stop").methods("POST"_method)([&](const crow::request &req) {
         try {
             json body = json::parse(req.body);
@@ -1,19 +1,58 @@
+#include <gtest/gtest.h>
 #include "server.h"
 #include <server_logger_builder.h>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
 #include <unistd.h>
 
-int main() {
+TEST(serverLoggerTests, unreachableServerSpillsBatches)
+{
+    std::filesystem::remove("spill_test.jsonl");
+
+    {
+        server_logger_builder builder;
+        builder.set_destination("http://127.0.0.1:1");
+        builder.add_console_stream(logger::severity::information);
+        builder.set_batching(4, std::chrono::milliseconds(50)).set_spill_file("spill_test.jsonl");
+
+        std::unique_ptr<logger> log(builder.build());
+        for (int i = 0; i < 10; ++i) {
+            log->information(std::to_string(i));
+        }
+    }
+
+    std::ifstream spilled("spill_test.jsonl");
+    std::string line;
+    int expected = 0;
+    while (std::getline(spilled, line)) {
+        auto record = nlohmann::json::parse(line);
+        ASSERT_EQ(record["severity"], "INFORMATION");
+        ASSERT_EQ(record["message"], std::to_string(expected++));
+    }
+    ASSERT_EQ(expected, 10);
+}
+
+int main(int argc, char *argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+
     std::cout << "PID of client is: " << getpid() << std::endl;
 
-    server_logger_builder builder;
+    try {
+        server_logger_builder builder;
+
+        builder.add_file_stream("a.txt", logger::severity::trace).add_file_stream("b.txt", logger::severity::debug).
+                add_console_stream(logger::severity::trace).add_file_stream("a.txt", logger::severity::information);
 
-    builder.add_file_stream("a.txt", logger::severity::trace).add_file_stream("b.txt", logger::severity::debug).
-            add_console_stream(logger::severity::trace).add_file_stream("a.txt", logger::severity::information);
+        std::unique_ptr<logger> log(builder.build());
 
-    std::unique_ptr<logger> log(builder.build());
+        log->trace("good").debug("debug");
 
-    log->trace("good").debug("debug");
+        log->trace("IT is a very long strange message !!!!!!!!!!%%%%%%%%\tzdtjhdjh").
+            information("bfldknbpxjxjvpxvjbpzjbpsjbpsjkgbpsejegpsjpegesjpvbejpvjzepvgjs");
+    } catch (const std::exception &ex) {
+        std::cerr << "exception : " << ex.what() << std::endl;
+    }
 
-    log->trace("IT is a very long strange message !!!!!!!!!!%%%%%%%%\tzdtjhdjh").
-		information("bfldknbpxjxjvpxvjbpzjbpsjbpsjkgbpsejegpsjpegesjpvbejpvjzepvgjs");
-}
\ No newline at end of file
+    return RUN_ALL_TESTS();
+}